@@ -0,0 +1,57 @@
+#ifndef _BCENCODE_H
+#define _BCENCODE_H
+
+// Compressao de texturas em blocos de 4x4 texels (S3TC/BPTC), feita na CPU
+// ao gerar o cache de texturas (veja "texturecache.h"):
+//
+//   BC1 (DXT1): 8 bytes por bloco (4 bits por texel), cor sem alpha
+//   BC3 (DXT5): 16 bytes por bloco, cor do BC1 mais um bloco de alpha
+//   BC7 (BPTC): 16 bytes por bloco, somente o modo 6 (um subconjunto,
+//               extremos RGBA de 7 bits + bit p, indices de 4 bits)
+//
+// Os extremos de cada bloco saem do eixo principal das cores (PCA) e sao
+// refinados por minimos quadrados; a escolha do indice de cada texel e
+// feita com SIMD, 4 texels por vez (veja "simdvec.h"). As imagens sao
+// divididas em faixas de blocos comprimidas em paralelo. Veja
+// "bcencode.cpp" e "--bench-bc".
+
+#include <stddef.h>
+
+enum BcFormat
+{
+    BC_FORMAT_BC1,
+    BC_FORMAT_BC3,
+    BC_FORMAT_BC7
+};
+
+// Presets de qualidade: numero de iteracoes de refinamento dos extremos e,
+// no BC7, busca dos bits p
+enum BcQuality
+{
+    BC_QUALITY_FAST,
+    BC_QUALITY_NORMAL,
+    BC_QUALITY_HIGH
+};
+
+// Bytes por bloco (8 ou 16) e tamanho de uma imagem comprimida
+int    Bc_BlockSize(BcFormat format);
+size_t Bc_CompressedSize(BcFormat format, int width, int height);
+
+const char* Bc_FormatName(BcFormat format);
+const char* Bc_QualityName(BcQuality quality);
+
+// Comprime um bloco de 16 texels RGBA (64 bytes, linha a linha)
+void Bc_EncodeBlock(BcFormat format, BcQuality quality, const unsigned char* rgba, unsigned char* block);
+
+// Descomprime um bloco para 16 texels RGBA. No BC7, somente o modo 6 e
+// suportado (o unico produzido por Bc_EncodeBlock()).
+void Bc_DecodeBlock(BcFormat format, const unsigned char* block, unsigned char* rgba);
+
+// Comprime uma imagem com "channels" (3 ou 4) bytes por texel, linha a
+// linha. As bordas de imagens com dimensoes que nao sao multiplas de 4 sao
+// completadas repetindo o ultimo texel. Com num_threads <= 0, usa todos os
+// nucleos. "out" deve ter Bc_CompressedSize() bytes.
+void Bc_EncodeImage(BcFormat format, BcQuality quality, const unsigned char* pixels, int width, int height,
+                    int channels, unsigned char* out, int num_threads);
+
+#endif // _BCENCODE_H
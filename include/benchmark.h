@@ -0,0 +1,76 @@
+#ifndef _BENCHMARK_H
+#define _BENCHMARK_H
+
+// Modo de benchmark sem interacao ("--benchmark"): a cena e renderizada em um
+// framebuffer fora da tela, com resolucao fixa, enquanto a camera percorre um
+// caminho pre-definido em cada sala. Ao final, um relatorio JSON com os
+// percentis do tempo de quadro, desenhos, triangulos e tempo de carregamento
+// e gravado em disco. O caminho depende somente do numero do quadro, de forma
+// que execucoes em builds diferentes sao diretamente comparaveis. Veja
+// "benchmark.cpp".
+
+#include <glad/glad.h>
+
+// Resolucao fixa do framebuffer do benchmark
+#define BENCHMARK_WIDTH  1280
+#define BENCHMARK_HEIGHT 720
+
+// Pose da camera em um quadro do caminho
+struct BenchmarkCamera
+{
+    int   room;   // Sala atual (1, 2 ou 3)
+    float x, z;   // Posicao da camera no plano XZ (camera_movement)
+    float theta;  // Angulo no plano ZX em relacao ao eixo Z (g_CameraTheta)
+    float phi;    // Angulo em relacao ao eixo Y (g_CameraPhi)
+};
+
+// Cria o framebuffer fora da tela (requer contexto OpenGL)
+void Benchmark_Init(double load_time_seconds);
+
+// Passa a renderizar no framebuffer do benchmark
+void Benchmark_BindFramebuffer();
+
+// Pose da camera no quadro "frame". Retorna false quando o caminho terminou.
+bool Benchmark_CameraAtFrame(int frame, BenchmarkCamera* camera);
+
+// Guarda as estatisticas do quadro que acabou de ser encerrado pelo profiler
+void Benchmark_RecordFrame(int room);
+
+// Grava o relatorio JSON e imprime um resumo no terminal
+bool Benchmark_WriteReport(const char* filename);
+
+// Microbenchmarks executados sem janela nem contexto OpenGL
+// ("--bench-<nome>"); imprimem os resultados no terminal.
+
+// Mundo de colisao: consultas de capsula varrida por segundo em mundos com
+// numero crescente de caixas, usando a grade e uma busca exaustiva.
+void Benchmark_Collision();
+
+// Projeteis: passos de simulacao com milhares de projeteis simultaneos no
+// conjunto SoA, comparados ao antigo std::vector de RoomWallModel.
+void Benchmark_Projectiles();
+
+// Picking: constroi a BVH de cada malha dos arquivos ".obj" dados e mede
+// quantos raios por segundo cada uma responde.
+void Benchmark_Picking(const char* const* filenames, int num_files);
+
+// Hierarquia de transformacoes: atualizacao das matrizes globais quando nada
+// muda, quando uma subarvore muda e quando todas mudam, comparada a
+// recompor todas as matrizes a cada quadro.
+void Benchmark_Transforms();
+
+// Matrizes: funcoes de "matrices.h" comparadas as versoes SIMD e em lote de
+// "simdmath.h" (tempo por operacao e maior diferenca entre os resultados).
+void Benchmark_Matrices();
+
+// Transformacoes compactas (veja "transform.h"): matriz de modelagem,
+// composicao, inversa e matriz das normais, comparadas as cadeias de
+// "matrices.h" e a inversa geral do GLM.
+void Benchmark_TRS();
+
+// Compressao de texturas (veja "bcencode.h"): megatexels por segundo com
+// uma e com todas as threads e PSNR de cada formato e preset na imagem
+// "filename".
+void Benchmark_BlockCompression(const char* filename);
+
+#endif // _BENCHMARK_H
@@ -1,17 +1,56 @@
-struct RoomWallModel
-{
-	float positionX;
-	float positionY;
-	float positionZ;
-
-	float scaleX;
-	float scaleY;
-	float scaleZ;
-};
-
-bool CheckWallCollision(glm::vec4 charPos, RoomWallModel wall);
-bool CheckWallYZCollision(glm::vec4 charPos, RoomWallModel wall);
-bool CheckGetObjCollision(glm::vec4 charPos, RoomWallModel getObj);
-bool CollisionObj(float x1, float x2, RoomWallModel GetObj);
-
-
+#ifndef _COLLISIONS_H
+#define _COLLISIONS_H
+
+#include <glm/mat4x4.hpp>
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+
+struct RoomWallModel
+{
+	float positionX;
+	float positionY;
+	float positionZ;
+
+	float scaleX;
+	float scaleY;
+	float scaleZ;
+};
+
+bool CheckGetObjCollision(glm::vec4 charPos, RoomWallModel getObj);
+bool CollisionObj(float x1, float x2, RoomWallModel GetObj);
+
+// Mundo de colisao: caixas orientadas (rotacionadas somente em torno do eixo
+// Y) de paredes e moveis, registradas em uma grade uniforme no plano XZ. A
+// camera e tratada como uma capsula vertical, e CollisionWorld_MoveCapsule()
+// varre a capsula ao longo do deslocamento pedido, parando no primeiro
+// contato e deslizando ao longo da superficie atingida. Como o teste e
+// continuo, deslocamentos grandes nao atravessam paredes finas.
+//
+// Uso: CollisionWorld_Clear(), varios CollisionWorld_Add*Box(), e entao
+// CollisionWorld_Build() antes das consultas.
+
+void CollisionWorld_Clear();
+
+// Caixa com centro "center", meias dimensoes "half_size" e eixo local X
+// "axis_x" (no plano XZ; o eixo Y e sempre vertical).
+void CollisionWorld_AddBox(glm::vec4 center, glm::vec4 half_size, glm::vec4 axis_x);
+
+// Caixa de um objeto: a bounding box local [bbox_min, bbox_max] transformada
+// pela matriz de modelagem. Se a matriz tiver rotacoes fora do eixo Y, usamos
+// a AABB da caixa transformada.
+void CollisionWorld_AddModelBox(const glm::mat4& model, glm::vec3 bbox_min, glm::vec3 bbox_max);
+
+// Distribui as caixas na grade. "cell_size" e o lado de cada celula.
+void CollisionWorld_Build(float cell_size = 4.0f);
+
+int CollisionWorld_NumBoxes();
+
+// Move uma capsula vertical de raio "radius", que vai de position.y + bottom
+// ate position.y + top, pelo deslocamento "displacement" (somente X e Z sao
+// usados). Retorna a posicao final. Se a capsula ja intersecta uma caixa na
+// posicao inicial, ela e empurrada para fora pela face mais proxima antes de
+// continuar o deslocamento, de forma que nunca fica presa nem atravessa a
+// caixa.
+glm::vec4 CollisionWorld_MoveCapsule(glm::vec4 position, glm::vec4 displacement, float radius, float bottom, float top);
+
+#endif // _COLLISIONS_H
@@ -0,0 +1,1370 @@
+// Gerado por "src/sdfgen.cpp" (make sdf) a partir de "dejavufont.h"; nao
+// edite a mao. Campo de distancia com sinal da fonte: cada texel guarda
+// 0.5 + d / 8, com d a distancia ao contorno em pixels da fonte (positiva
+// dentro do glifo), saturada em 4 pixels. Os glifos tem 4 texels de margem.
+// Requer "dejavufont.h", que define texture_font_t.
+#ifndef _DEJAVUFONT_SDF_H
+#define _DEJAVUFONT_SDF_H
+
+#define DEJAVUFONT_SDF_SPREAD 4
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+texture_font_t dejavufont_sdf = {
+ 256, 156, 1,
+ {0,0,0,0,0,0,0,7,13,16,11,0,0,0,0,0,0,0,0,12,16,12,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,16,16,16,14,8,0,0,0,0,0,0,0,12,
+  16,16,16,14,8,0,0,0,0,0,0,0,0,0,0,0,0,8,14,16,16,11,0,0,0,0,0,0,0,0,12,16,
+  16,13,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,12,8,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,8,12,10,1,0,0,0,0,0,0,0,4,10,12,7,0,0,0,0,0,0,0,0,0,0,0,0,2,11,
+  16,16,15,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,13,16,12,0,0,0,0,0,0,0,
+  0,0,8,12,12,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,16,12,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,2,13,16,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,21,37,44,47,41,26,5,0,0,0,0,11,29,42,47,42,28,8,0,0,0,0,0,0,0,0,
+  0,0,8,14,16,16,16,11,0,0,0,0,0,0,0,0,5,26,41,47,48,48,46,38,23,3,0,0,0,5,27,42,
+  48,48,48,46,38,23,3,0,0,0,0,0,0,0,0,8,25,38,46,48,47,41,24,3,0,0,0,0,5,27,42,48,
+  48,45,38,23,3,0,0,0,0,0,0,0,0,0,0,0,3,23,38,44,38,23,3,0,0,0,0,0,0,0,0,0,
+  0,3,23,38,44,41,30,15,0,0,0,0,0,20,35,41,43,37,21,0,0,0,0,0,0,0,0,0,0,16,32,42,
+  47,48,47,41,29,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,30,43,48,42,28,8,0,0,0,0,0,
+  3,23,38,44,44,38,23,3,0,0,0,0,0,0,0,0,0,0,0,8,28,42,47,42,29,11,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,13,30,43,48,42,28,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,20,45,65,75,79,69,50,26,0,0,0,7,33,55,71,79,71,53,30,3,0,0,0,0,0,0,0,
+  8,25,38,46,48,48,47,41,29,12,0,0,0,0,0,0,26,50,69,79,80,80,77,67,48,23,0,0,0,27,51,71,
+  79,80,80,77,67,48,23,0,0,0,0,0,0,0,11,33,52,68,77,80,79,69,48,23,0,0,0,0,27,51,71,79,
+  80,76,67,48,28,5,0,0,0,0,0,0,0,0,0,0,23,48,67,75,67,48,24,4,0,0,0,0,0,0,0,0,
+  0,24,48,67,75,71,59,39,14,0,0,0,20,45,64,72,75,65,45,21,0,0,0,0,0,0,0,2,23,41,60,72,
+  79,80,78,71,57,38,18,0,0,0,0,0,0,0,0,0,0,0,0,11,36,57,73,79,71,53,30,3,0,0,0,0,
+  23,48,67,75,75,67,48,23,0,0,0,0,0,0,0,0,0,0,5,30,53,71,79,71,55,33,7,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,11,36,58,73,79,71,53,29,2,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,4,35,64,90,106,109,95,69,41,11,0,0,19,49,77,99,110,98,74,46,16,0,0,0,0,0,0,18,
+  36,52,68,77,80,80,79,71,57,37,16,0,0,0,0,11,41,69,95,110,112,112,108,92,67,38,8,0,12,42,71,95,
+  111,112,112,108,92,67,38,8,0,0,0,0,0,2,30,56,78,96,108,112,110,93,67,38,8,0,0,12,42,71,95,111,
+  111,107,93,73,50,26,0,0,0,0,0,0,0,0,0,20,40,67,92,106,92,67,44,33,18,0,0,0,0,0,0,0,
+  14,41,69,93,107,101,83,57,27,0,0,4,35,64,89,103,106,90,65,37,9,0,0,0,0,0,0,22,47,68,86,102,
+  110,112,109,100,83,63,42,18,0,0,0,0,0,0,0,0,0,0,0,29,55,81,101,110,98,74,46,16,0,0,0,8,
+  38,67,92,107,107,92,67,39,10,0,0,0,0,0,0,0,0,0,18,48,75,98,110,99,77,49,19,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,26,55,81,101,110,98,73,44,14,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,10,40,71,103,131,135,110,79,47,16,0,0,24,56,87,118,136,114,83,52,20,0,0,0,0,0,18,42,
+  62,79,96,108,112,112,110,100,81,61,39,15,0,0,0,16,47,79,110,136,143,139,131,106,75,44,12,0,16,47,79,110,
+  134,139,142,133,107,75,44,12,0,0,0,0,0,13,44,73,100,122,137,140,133,107,75,44,12,0,0,16,48,79,110,135,
+  140,135,117,95,69,41,11,0,0,0,0,0,0,3,24,45,64,79,107,129,107,82,73,62,42,18,0,0,0,0,0,2,
+  30,58,83,111,133,122,95,63,32,0,0,8,40,71,102,127,132,108,79,51,25,0,0,0,0,0,8,38,66,92,111,129,
+  139,141,138,126,107,87,62,34,5,0,0,0,0,0,0,0,0,0,11,41,71,99,124,136,114,83,52,20,0,0,0,12,
+  44,75,107,132,134,109,80,51,25,0,0,0,0,0,0,0,0,0,24,55,87,117,136,118,87,56,26,12,5,0,0,0,
+  0,0,0,0,0,0,0,0,7,14,32,63,95,124,137,114,83,51,20,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,13,30,46,72,103,131,135,110,79,47,16,0,0,24,56,88,120,141,116,84,52,20,0,0,0,0,11,37,62,
+  87,106,122,136,139,139,139,126,105,84,59,32,3,0,0,16,48,80,112,143,146,124,114,95,68,38,8,0,12,42,71,99,
+  118,124,148,139,108,76,44,12,0,0,0,0,0,20,52,83,113,141,144,127,117,97,69,40,9,0,0,13,43,73,100,120,
+  129,146,138,110,79,47,16,0,0,0,0,0,0,23,48,69,90,105,116,134,118,110,104,87,62,33,3,0,0,0,0,12,
+  42,72,101,126,139,113,85,57,27,0,0,4,35,64,90,117,139,121,95,68,38,8,0,0,0,0,22,50,79,108,134,145,
+  132,125,135,144,130,105,76,46,16,0,0,0,0,0,0,0,0,0,27,54,82,111,139,137,109,79,48,17,0,0,0,9,
+  40,69,98,124,141,120,95,68,38,8,0,0,0,0,0,0,0,0,24,56,88,120,143,120,88,58,48,43,35,20,0,0,
+  0,0,0,0,0,0,3,22,37,44,48,64,96,128,144,116,84,52,20,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,11,36,58,73,81,93,106,110,95,69,41,11,0,0,24,56,88,120,141,116,84,52,20,0,0,0,2,30,56,81,
+  106,130,140,134,122,121,133,142,128,103,74,43,13,0,0,16,48,80,112,143,137,107,85,72,50,25,0,0,0,28,55,77,
+  89,110,140,139,108,76,44,12,0,0,0,0,0,24,56,87,118,143,126,102,88,75,53,27,0,0,0,2,30,56,77,91,
+  107,133,143,113,82,51,19,0,0,0,0,0,9,39,67,93,113,132,140,151,142,139,129,103,73,42,10,0,0,0,0,25,
+  53,82,112,139,130,103,74,44,14,0,0,0,20,48,77,108,136,136,109,78,48,18,0,0,0,4,35,64,93,121,144,130,
+  107,97,111,136,143,116,86,56,27,0,0,0,0,0,0,0,0,10,40,69,97,123,141,120,95,68,38,8,0,0,0,0,
+  27,55,82,111,139,137,109,79,50,22,0,0,0,0,0,0,0,0,24,56,88,120,143,120,89,80,79,74,64,45,24,3,
+  0,0,0,0,0,5,27,47,65,76,80,80,96,128,144,116,84,52,20,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,26,55,81,101,111,112,112,110,95,69,41,11,0,0,24,56,88,120,141,116,84,52,20,0,0,0,12,42,72,100,
+  125,140,122,107,95,95,108,129,139,113,82,51,20,0,0,16,48,80,112,143,135,104,72,47,27,5,0,0,0,10,33,51,
+  76,108,139,139,108,76,44,12,0,0,0,0,0,24,56,88,120,143,120,88,61,48,30,8,0,0,0,0,11,33,50,67,
+  97,128,144,116,84,52,20,0,0,0,0,0,17,48,79,109,136,142,129,142,127,130,132,107,75,44,12,0,0,0,7,37,
+  67,96,123,141,117,88,61,32,3,0,0,0,7,37,67,96,123,141,117,88,59,30,1,0,0,11,42,73,104,133,145,117,
+  88,71,94,122,145,126,97,67,36,5,0,0,0,0,0,0,0,25,53,81,110,138,137,109,80,51,25,0,0,0,0,0,
+  12,41,71,99,125,141,119,93,66,37,7,0,0,0,0,0,0,0,24,56,88,120,143,120,105,111,111,105,90,69,48,23,
+  0,0,0,0,0,27,51,72,92,106,111,111,106,128,144,116,84,52,20,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,31,63,94,122,137,139,143,136,110,79,47,16,0,0,24,56,88,120,141,116,84,52,20,0,0,0,21,51,82,112,
+  138,127,103,95,107,112,111,118,139,118,87,55,24,0,0,16,48,80,112,143,135,104,72,40,9,0,0,0,0,0,14,44,
+  76,108,139,139,108,76,44,12,0,0,0,0,1,25,56,88,120,143,120,88,56,26,5,0,0,0,0,0,0,8,33,64,
+  96,128,144,116,84,52,21,0,0,0,0,0,20,52,84,115,141,126,113,132,111,101,107,92,67,38,8,0,0,0,13,44,
+  76,106,136,141,111,80,49,19,0,0,0,0,0,25,54,84,114,142,129,101,71,40,9,0,0,14,45,77,108,139,143,112,
+  81,59,84,116,146,134,104,73,41,10,0,0,0,0,0,0,10,39,68,96,122,141,122,96,68,39,10,0,0,0,0,0,
+  0,29,56,84,113,140,135,108,78,48,20,0,0,0,0,0,0,0,24,56,88,120,144,128,133,139,140,133,113,93,67,39,
+  10,0,0,0,15,43,71,96,116,134,140,139,133,134,145,116,84,52,20,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,27,57,84,106,119,124,146,143,112,80,48,16,0,0,24,56,88,120,141,116,84,52,20,0,0,1,32,62,91,120,
+  139,114,97,114,134,139,138,133,145,120,88,56,24,0,0,16,48,80,112,143,135,104,72,40,8,0,0,0,0,0,12,44,
+  76,108,139,139,108,76,44,12,0,0,0,8,28,43,61,90,121,143,119,88,56,24,0,0,0,0,0,0,0,0,32,63,
+  95,126,143,116,84,56,42,27,5,0,0,0,20,52,84,116,142,123,111,131,108,81,76,67,48,23,0,0,0,0,17,48,
+  80,111,142,137,106,75,44,12,0,0,0,0,0,16,48,79,110,141,138,108,77,46,14,0,0,16,48,80,111,142,143,112,
+  80,57,82,113,143,139,108,76,44,12,0,0,0,0,0,0,25,51,80,109,137,138,110,81,53,25,0,0,0,0,0,0,
+  0,13,42,72,101,127,142,118,91,64,35,6,0,0,0,0,0,0,24,56,88,120,150,148,138,126,132,145,136,110,81,52,
+  22,0,0,0,30,58,85,113,138,143,130,127,140,153,147,116,84,52,20,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,14,39,62,80,89,107,137,143,112,80,48,16,0,0,24,56,88,120,141,116,84,52,20,0,0,7,39,70,101,131,
+  137,108,109,135,140,125,123,139,147,120,88,56,24,0,0,16,48,80,112,143,135,104,72,40,8,0,0,0,0,0,12,44,
+  76,108,139,139,108,76,44,12,0,0,0,28,53,71,83,101,127,143,116,84,53,21,0,0,0,0,0,0,0,0,28,60,
+  91,122,143,120,96,80,71,50,26,0,0,0,19,50,81,112,139,140,124,136,114,96,82,67,48,24,0,0,0,0,20,52,
+  83,115,144,132,102,70,39,8,0,0,0,0,0,12,44,75,107,138,143,112,80,48,16,0,0,16,48,80,112,143,143,112,
+  80,56,80,112,143,139,108,76,44,12,0,0,0,0,0,9,38,68,95,120,141,124,98,69,40,10,0,0,0,0,0,0,
+  0,2,30,58,85,113,140,133,106,76,47,19,0,0,0,0,0,0,24,56,88,120,150,140,114,99,107,127,144,122,93,64,
+  35,4,0,9,40,70,100,128,144,123,104,100,117,143,147,116,84,52,20,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,17,37,52,72,104,135,143,112,80,48,16,0,0,24,56,88,120,141,116,84,52,20,0,0,10,42,73,104,135,
+  133,104,116,139,120,100,97,118,140,120,88,56,24,0,0,16,48,80,112,143,135,104,72,40,8,0,0,0,0,0,12,44,
+  76,108,139,139,108,76,44,12,0,0,12,42,71,97,113,121,142,138,111,81,49,18,0,0,0,0,0,0,0,0,23,54,
+  84,114,141,138,119,111,95,69,40,9,0,0,12,42,71,98,121,139,142,151,138,124,110,93,69,42,15,0,0,0,20,52,
+  84,116,144,128,97,65,34,3,0,0,0,0,0,9,40,72,104,135,143,112,80,48,16,0,0,16,48,80,111,142,143,112,
+  80,57,82,113,143,138,107,76,44,12,0,0,0,0,0,23,50,79,109,137,139,111,82,55,27,0,0,0,0,0,0,0,
+  0,0,15,43,73,102,128,141,117,90,63,34,4,0,0,0,0,0,24,56,88,120,146,128,100,74,86,115,143,133,103,72,
+  41,9,0,13,44,76,107,138,143,113,83,77,106,135,146,116,84,52,20,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,13,40,72,104,135,143,112,80,48,16,0,0,24,56,88,120,141,116,84,52,20,0,0,12,44,76,108,138,
+  131,103,119,139,113,83,81,112,139,120,88,56,24,0,0,16,48,80,112,143,135,104,72,40,8,0,0,0,0,0,12,44,
+  76,108,139,139,108,76,44,12,0,0,16,48,79,110,135,143,146,124,101,74,44,13,0,0,0,0,0,0,0,0,16,47,
+  77,105,127,148,142,133,107,76,44,12,0,0,0,28,53,76,98,112,123,145,143,142,135,112,85,58,30,0,0,0,20,52,
+  84,116,144,128,97,66,34,3,0,0,0,0,0,9,40,72,104,135,143,112,80,48,16,0,0,14,45,77,108,139,143,112,
+  81,59,84,116,146,134,104,72,41,9,0,0,0,0,7,37,66,93,119,142,125,99,71,41,12,0,0,0,0,0,0,0,
+  0,0,2,31,59,86,115,141,132,105,75,45,17,0,0,0,0,0,24,56,88,120,144,121,91,63,80,112,143,138,107,76,
+  44,12,0,16,48,79,111,141,140,109,78,68,98,129,145,116,84,52,20,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,8,40,72,104,135,143,112,80,48,16,0,0,24,56,88,120,141,116,84,52,20,0,0,10,42,73,104,135,
+  133,104,116,139,118,95,93,115,140,120,88,56,24,0,0,16,48,80,112,143,135,104,72,40,8,0,0,0,0,0,12,44,
+  76,108,139,139,108,76,44,12,0,0,13,43,73,98,117,126,145,138,110,80,49,17,0,0,0,0,0,0,0,0,23,54,
+  84,114,140,141,123,114,95,69,40,9,0,0,0,15,37,56,72,84,110,133,117,123,143,128,100,70,39,8,0,0,20,52,
+  83,115,144,132,102,70,39,8,0,0,0,0,0,12,44,75,107,138,143,112,80,48,16,0,0,11,42,73,104,133,145,117,
+  88,71,94,122,144,125,96,66,36,5,0,0,0,0,21,48,78,108,135,140,113,83,56,29,0,0,0,0,0,0,0,0,
+  0,0,0,16,45,75,103,130,141,115,88,61,32,4,0,0,0,0,24,56,88,120,144,121,91,63,80,112,143,138,107,75,
+  44,12,0,16,48,79,111,141,140,109,78,68,98,129,145,116,84,52,20,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,8,40,72,104,135,143,112,80,48,16,0,0,24,56,88,120,141,116,84,52,20,0,0,7,39,70,101,131,
+  137,108,110,137,137,119,118,135,147,120,88,56,24,0,0,16,48,80,112,143,135,104,72,40,8,0,0,0,0,0,12,44,
+  76,108,139,139,108,76,44,12,0,0,2,29,53,75,88,104,128,143,116,84,53,22,0,0,0,0,0,0,0,0,28,60,
+  91,122,143,122,99,85,72,50,26,0,0,0,7,33,56,73,80,81,108,131,108,112,143,136,107,75,44,12,0,0,17,48,
+  80,111,142,137,106,75,44,13,0,0,0,0,0,16,48,79,110,141,138,108,77,46,14,0,0,4,35,64,93,121,144,130,
+  107,97,111,136,143,116,86,56,26,0,0,0,0,6,35,64,91,118,142,127,101,72,42,13,0,0,0,0,0,0,0,0,
+  0,0,0,4,32,61,88,115,141,130,103,75,45,16,0,0,0,0,24,56,88,120,146,128,100,74,86,115,143,133,103,71,
+  40,9,0,13,44,76,107,138,143,113,83,77,106,135,146,116,84,52,20,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,8,40,72,104,135,143,112,80,48,16,0,0,24,56,88,120,141,116,84,52,20,0,0,1,32,62,91,120,
+  139,114,99,118,137,139,138,137,140,118,87,56,24,0,0,16,48,80,112,143,135,104,72,40,8,0,0,0,0,0,12,44,
+  76,108,139,139,108,76,44,12,0,0,0,8,30,48,62,90,121,143,119,88,56,25,1,0,0,0,0,0,0,4,32,63,
+  95,126,143,116,84,58,44,27,5,0,0,0,19,49,77,100,111,105,111,132,113,117,143,133,103,72,41,9,0,0,13,44,
+  76,106,135,141,111,80,49,19,0,0,0,0,0,25,54,84,114,142,129,101,71,40,9,0,0,0,22,50,79,108,134,145,
+  132,125,135,146,131,105,76,46,16,0,0,0,0,19,47,76,106,133,140,113,85,58,30,2,0,0,0,0,0,0,0,0,
+  0,0,0,0,17,45,75,105,132,141,114,86,59,31,2,0,0,0,24,56,88,120,150,140,114,99,107,127,144,121,93,64,
+  34,3,0,9,40,70,100,127,144,123,104,100,117,143,147,116,84,52,20,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,8,40,72,104,135,143,112,80,48,16,0,0,24,56,88,120,141,116,84,52,20,0,0,0,21,51,82,112,
+  138,129,105,97,110,115,115,109,114,101,77,49,19,0,0,16,48,80,112,143,135,104,72,43,24,3,0,0,0,5,27,47,
+  76,108,139,139,108,76,44,12,0,0,0,0,5,26,56,88,120,143,120,88,58,42,27,5,0,0,0,0,8,28,43,65,
+  96,128,144,116,84,52,22,2,0,0,0,0,24,55,87,117,137,134,128,144,132,139,140,118,92,64,35,4,0,0,7,37,
+  66,95,122,141,118,89,61,32,3,0,0,0,8,38,68,96,123,141,117,88,59,30,1,0,0,0,8,38,66,92,111,130,
+  139,141,153,140,113,88,62,34,5,0,0,0,3,33,62,90,117,141,128,102,73,43,15,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,4,34,63,90,117,141,128,102,73,43,13,0,0,0,24,56,88,120,150,148,138,126,132,145,136,110,81,51,
+  22,0,0,0,29,57,85,113,138,143,130,127,140,153,147,116,84,52,20,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,7,21,43,74,105,136,143,112,80,48,16,0,0,24,56,88,120,141,116,84,52,20,0,0,0,12,42,71,99,
+  124,140,123,107,94,92,91,89,87,75,56,33,7,0,0,16,48,80,112,143,135,104,80,67,48,23,0,0,0,27,51,71,
+  83,108,139,139,108,76,44,12,0,0,0,0,0,24,56,88,119,143,122,95,80,71,50,26,0,0,0,0,28,53,71,82,
+  102,130,143,115,84,52,20,0,0,0,0,0,19,49,78,103,125,137,140,151,142,135,118,98,74,48,21,0,0,0,0,23,
+  52,82,112,139,130,103,74,44,14,0,0,0,21,49,78,108,136,136,109,78,48,18,0,0,0,0,0,22,47,68,87,103,
+  110,115,134,144,121,93,64,35,4,0,0,0,8,39,71,102,130,139,114,86,59,31,2,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,19,47,76,106,133,138,111,79,48,16,0,0,0,24,55,87,117,137,127,134,140,141,132,113,93,67,39,
+  10,0,0,0,14,42,71,96,116,134,140,139,132,130,137,114,83,51,20,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,14,35,49,57,76,108,139,140,109,78,46,15,0,0,24,56,88,120,141,116,84,52,20,0,0,0,0,29,55,80,
+  106,129,140,133,119,116,116,114,98,71,43,15,0,0,0,16,48,80,112,143,140,117,109,92,67,38,8,0,12,42,71,95,
+  111,118,143,139,108,76,44,12,0,0,0,0,0,22,54,85,116,144,137,118,111,95,69,40,9,0,0,12,42,71,97,112,
+  120,141,141,111,80,49,17,0,0,0,0,0,7,34,59,81,98,107,116,134,117,107,92,74,53,30,4,0,0,0,0,12,
+  42,72,101,126,139,113,85,57,27,0,0,4,35,64,92,118,139,121,95,68,38,8,0,0,0,0,0,2,24,42,61,72,
+  79,90,112,133,128,102,71,40,8,0,0,0,4,35,66,96,119,118,100,73,44,15,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,6,35,64,90,110,123,103,74,43,13,0,0,0,18,48,75,98,110,102,105,111,111,104,89,69,48,23,
+  0,0,0,0,0,27,51,72,92,106,111,111,103,102,110,98,73,44,14,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,7,35,59,78,87,93,113,141,137,107,75,44,12,0,0,24,56,88,120,141,116,84,52,20,0,0,0,0,11,36,62,
+  86,105,122,136,138,139,139,133,110,79,47,16,0,0,0,16,48,79,111,138,144,138,131,106,75,44,12,0,16,47,79,110,
+  133,138,145,135,107,75,44,12,0,0,0,0,0,17,47,78,107,132,142,139,133,107,76,44,12,0,0,16,48,79,110,134,
+  140,140,127,103,74,43,13,0,0,0,0,0,0,14,36,55,69,81,107,129,107,80,66,48,30,8,0,0,0,0,0,2,
+  30,58,83,111,133,122,95,63,32,0,0,8,40,71,102,127,132,108,79,51,25,0,0,0,0,0,0,0,0,17,32,42,
+  49,68,92,106,103,89,64,35,4,0,0,0,0,25,53,78,91,88,77,55,29,2,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,20,45,66,84,95,84,60,32,3,0,0,0,5,30,53,71,79,73,75,80,80,75,63,45,24,3,
+  0,0,0,0,0,5,27,47,65,76,80,79,73,73,79,71,53,29,2,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,19,49,78,104,118,122,134,143,123,96,68,38,8,0,0,24,56,88,120,141,116,84,52,20,0,0,0,0,0,17,42,
+  61,79,96,109,114,116,116,111,95,71,42,12,0,0,0,12,42,71,97,114,116,116,112,95,68,38,8,0,12,42,71,98,
+  114,116,116,111,93,67,38,8,0,0,0,0,0,7,36,64,89,106,114,116,114,95,69,40,9,0,0,13,43,73,98,114,
+  116,112,103,84,59,32,3,0,0,0,0,0,0,0,11,27,42,67,92,106,92,67,41,22,4,0,0,0,0,0,0,0,
+  14,41,69,93,107,101,83,57,27,0,0,4,35,64,89,103,106,90,65,37,9,0,0,0,0,0,0,0,0,0,2,11,
+  24,47,66,75,72,64,45,20,0,0,0,0,0,9,33,51,59,56,49,33,11,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,22,40,57,63,57,39,16,0,0,0,0,0,8,28,42,47,43,44,48,48,44,34,19,0,0,
+  0,0,0,0,0,0,3,22,37,44,48,48,42,43,48,42,28,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,24,55,87,117,136,139,139,127,104,80,53,25,0,0,0,24,56,87,118,136,114,83,52,20,0,0,0,0,0,0,17,
+  35,52,68,78,83,84,84,81,71,51,27,0,0,0,0,0,27,53,74,83,84,84,82,71,50,25,0,0,0,28,53,74,
+  83,84,84,81,69,48,23,0,0,0,0,0,0,0,20,45,64,76,83,84,83,72,50,26,0,0,0,2,29,53,74,83,
+  84,81,74,59,39,15,0,0,0,0,0,0,0,0,0,0,23,48,67,75,67,48,23,0,0,0,0,0,0,0,0,0,
+  0,24,48,67,75,71,59,39,14,0,0,0,20,45,64,72,75,65,45,21,0,0,0,0,0,0,0,0,0,0,0,0,
+  2,22,37,43,41,35,20,0,0,0,0,0,0,0,8,22,28,25,19,7,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,14,27,32,27,14,0,0,0,0,0,0,0,0,12,16,12,13,16,16,13,4,0,0,0,
+  0,0,0,0,0,0,0,0,7,13,16,16,12,13,16,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,19,49,77,99,111,112,110,101,83,60,35,9,0,0,0,19,49,77,99,110,98,74,46,16,0,0,0,0,0,0,0,
+  8,25,38,47,51,52,52,49,42,27,5,0,0,0,0,0,8,30,46,52,52,52,51,42,27,5,0,0,0,8,30,46,
+  52,52,52,50,41,24,3,0,0,0,0,0,0,0,0,20,35,45,51,52,51,44,27,5,0,0,0,0,8,30,46,52,
+  52,50,43,32,15,0,0,0,0,0,0,0,0,0,0,0,3,23,38,44,38,23,3,0,0,0,0,0,0,0,0,0,
+  0,3,23,38,44,41,30,15,0,0,0,0,0,20,35,41,43,37,21,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,7,12,10,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,7,33,55,71,79,80,79,71,58,39,15,0,0,0,0,7,33,55,71,79,71,53,30,3,0,0,0,0,0,0,0,
+  0,0,8,15,19,20,20,18,12,0,0,0,0,0,0,0,0,3,16,20,20,20,19,12,0,0,0,0,0,0,3,16,
+  20,20,20,19,11,0,0,0,0,0,0,0,0,0,0,0,6,14,19,20,20,14,1,0,0,0,0,0,0,3,16,20,
+  20,19,13,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,12,8,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,8,12,10,1,0,0,0,0,0,0,0,4,10,12,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,11,29,42,48,48,47,41,30,14,0,0,0,0,0,0,11,29,42,47,42,28,8,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,12,16,16,16,11,1,0,0,0,0,0,0,0,0,0,12,16,12,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,10,15,16,16,12,0,0,0,0,0,0,0,0,0,0,7,13,16,16,12,13,16,12,0,
+  0,0,0,0,0,0,0,0,12,16,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,16,12,
+  2,0,0,0,0,0,0,0,0,0,0,11,16,13,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,13,16,
+  16,16,13,4,0,0,0,0,0,0,0,0,0,0,0,0,12,16,12,13,16,16,12,4,0,0,0,0,0,0,0,0,
+  0,0,0,5,13,16,16,12,12,16,12,0,0,0,0,0,0,0,0,0,8,12,12,8,0,0,0,7,13,16,11,0,
+  0,0,0,0,0,0,0,0,12,16,12,0,0,0,0,0,0,0,0,0,0,0,0,2,10,12,9,11,16,12,2,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,11,
+  16,16,15,10,0,0,0,0,0,0,0,0,0,0,0,0,0,1,10,15,16,15,9,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,12,29,41,47,48,48,42,29,11,0,0,0,0,0,0,2,22,37,44,48,48,42,43,48,42,28,
+  8,0,0,0,0,0,8,28,42,47,42,29,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,28,42,47,42,
+  30,11,0,0,0,0,0,0,0,5,26,41,47,44,37,21,0,0,0,0,0,0,0,0,0,0,0,0,18,33,43,48,
+  48,48,44,34,18,0,0,0,0,0,0,0,0,0,11,29,42,47,42,44,48,48,43,34,18,0,0,0,0,0,0,0,
+  0,0,20,35,44,48,48,43,42,47,42,28,8,0,0,0,0,0,3,23,38,44,44,38,23,8,22,37,44,47,41,26,
+  5,0,0,0,0,0,11,29,42,47,42,28,8,0,0,0,0,0,0,0,0,0,15,31,41,44,40,41,47,42,30,12,
+  0,0,0,0,0,0,0,0,3,13,16,16,13,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,32,42,
+  47,48,47,41,29,12,0,0,0,0,0,0,0,0,0,0,14,30,41,47,48,46,40,27,10,0,0,0,0,0,0,0,
+  0,0,0,0,0,14,36,57,71,79,80,79,71,55,33,7,0,0,0,0,5,27,47,65,76,80,79,73,73,79,71,53,
+  29,2,0,0,0,5,30,53,71,79,71,55,33,7,0,0,0,0,0,0,0,0,0,0,0,0,3,30,53,71,79,72,
+  56,33,8,0,0,0,0,0,0,26,50,69,79,76,65,45,21,0,0,0,0,0,0,0,0,0,0,17,42,62,74,80,
+  80,80,75,62,42,18,0,0,0,0,0,0,0,7,33,55,71,79,72,75,80,79,74,62,43,24,3,0,0,0,0,0,
+  3,24,45,64,75,80,79,74,73,79,71,53,30,3,0,0,0,0,23,48,67,75,75,67,48,30,47,66,76,79,69,50,
+  26,0,0,0,0,7,33,55,71,79,71,53,30,3,0,0,0,0,0,0,0,15,39,59,72,76,69,69,79,72,57,36,
+  10,0,0,0,0,0,0,16,32,43,48,48,44,35,20,0,0,0,0,0,0,0,0,0,0,0,0,0,19,42,61,72,
+  79,80,78,71,57,36,10,0,0,0,0,0,0,0,0,19,39,58,71,79,80,78,69,54,35,14,0,0,0,0,0,0,
+  0,0,0,0,6,33,59,81,100,110,112,111,99,77,49,19,0,0,0,0,27,51,71,92,106,111,111,103,102,110,98,73,
+  44,14,0,0,0,18,48,75,98,110,99,77,49,19,0,0,0,0,0,0,0,0,0,0,0,0,16,46,74,98,110,100,
+  78,51,22,0,0,0,0,0,11,41,69,95,110,106,90,65,37,7,0,0,0,0,0,0,0,0,0,31,60,87,104,111,
+  112,111,104,87,62,33,3,0,0,0,0,0,0,19,49,77,99,110,101,105,111,111,104,87,69,48,23,0,0,0,0,0,
+  23,48,69,90,105,111,111,104,101,110,98,74,46,16,0,0,0,8,38,67,92,107,107,92,67,45,66,92,106,110,95,69,
+  41,11,0,0,0,19,49,77,99,110,98,74,46,16,0,0,0,0,0,0,0,30,58,84,102,107,95,95,109,101,80,53,
+  23,0,0,0,0,0,16,39,60,74,80,80,75,64,45,21,0,0,0,0,0,0,0,0,0,0,0,18,42,64,87,103,
+  110,112,109,100,80,53,24,0,0,0,0,0,0,0,18,42,63,84,101,110,112,109,98,80,59,36,12,0,0,0,0,0,
+  0,0,0,0,20,48,77,103,126,139,139,136,117,87,55,24,0,0,0,14,42,71,95,115,134,140,139,132,130,137,114,83,
+  51,20,0,0,0,24,55,87,117,136,118,87,56,26,13,6,0,0,0,0,0,0,0,0,0,0,20,52,83,114,136,120,
+  91,59,28,0,0,0,0,0,16,47,79,110,135,132,106,75,43,18,16,13,2,0,0,0,0,0,4,36,67,99,125,137,
+  140,141,130,102,71,40,8,0,0,0,0,0,0,24,56,87,118,137,127,134,140,140,131,112,93,67,39,10,0,0,0,10,
+  39,67,93,113,133,141,139,133,127,136,114,83,52,20,0,0,0,12,44,75,107,133,134,109,78,55,77,108,133,134,109,79,
+  47,16,0,0,0,24,56,87,118,136,114,83,52,20,0,0,0,0,0,0,14,39,70,100,126,134,107,110,134,121,91,59,
+  28,0,0,0,0,9,36,61,84,103,111,111,105,89,65,42,17,0,0,0,0,0,0,0,0,0,3,33,62,87,109,129,
+  139,140,138,122,93,63,32,0,0,0,0,0,0,5,34,62,87,108,127,139,140,137,124,104,81,57,30,2,0,0,0,0,
+  0,0,8,28,42,61,90,118,143,136,123,118,104,78,49,19,0,0,0,29,57,85,113,138,143,131,127,139,152,147,116,84,
+  52,20,0,0,0,24,56,88,120,143,120,88,58,48,44,35,20,0,0,0,0,0,0,0,0,21,37,54,83,114,137,120,
+  91,59,28,0,0,0,0,0,16,48,80,112,143,139,108,76,46,43,48,43,30,13,0,0,0,0,0,31,60,87,108,119,
+  125,149,135,104,72,40,8,0,0,0,0,0,0,24,56,88,120,150,148,137,126,132,145,136,110,80,50,20,0,0,0,23,
+  52,81,110,136,145,132,127,138,149,147,116,84,52,20,0,0,0,10,41,71,101,128,142,117,88,66,86,115,142,130,103,73,
+  43,12,0,0,0,24,56,88,120,141,116,84,52,20,0,0,0,0,5,27,42,51,76,107,137,135,106,116,139,117,86,56,
+  28,3,0,0,0,23,52,80,105,128,139,139,132,109,87,61,32,12,6,0,0,0,0,0,0,0,11,42,73,104,130,145,
+  132,124,127,124,98,67,35,4,0,0,0,0,0,16,46,76,105,131,145,134,126,137,144,126,101,73,43,13,0,0,0,0,
+  0,3,30,53,71,81,100,129,142,115,97,92,82,63,39,11,0,0,8,39,70,99,127,144,123,104,99,116,143,147,116,84,
+  52,20,0,0,0,24,56,88,120,143,120,89,79,80,75,64,45,24,2,0,0,0,0,0,20,45,65,77,84,99,110,100,
+  78,51,22,0,0,0,0,0,16,48,80,112,143,139,108,76,60,73,79,73,58,36,10,0,0,0,0,17,42,64,80,90,
+  113,143,135,104,72,40,8,0,0,0,0,0,0,24,56,88,120,150,139,114,98,107,128,143,120,91,62,32,2,0,4,35,
+  65,94,122,144,127,106,99,114,141,147,116,84,52,20,0,0,0,1,30,58,86,115,142,130,102,79,100,127,142,117,88,61,
+  32,3,0,0,0,24,56,88,120,141,116,84,52,20,0,0,0,0,27,51,71,79,86,113,139,124,103,124,140,112,85,67,
+  48,23,0,0,4,35,65,94,122,140,126,123,139,129,103,72,47,43,35,20,0,0,0,0,0,0,12,44,76,108,139,138,
+  111,94,96,99,84,58,30,5,0,0,0,0,0,28,57,87,116,143,134,110,98,113,139,141,113,82,52,21,0,0,0,0,
+  0,16,46,74,98,111,115,136,144,118,112,111,99,77,49,19,0,0,13,44,76,107,137,143,113,83,76,105,134,146,116,84,
+  52,20,0,0,0,24,56,88,120,143,120,103,110,111,106,90,68,47,22,0,0,0,0,4,35,64,90,107,112,112,111,100,
+  78,51,22,0,0,0,0,0,16,48,80,112,143,139,108,78,84,102,111,101,81,53,23,0,0,0,0,0,19,37,54,80,
+  112,143,135,104,72,40,8,0,0,0,0,0,0,24,56,88,120,146,127,100,74,87,116,143,131,102,71,39,8,0,10,41,
+  72,103,133,143,114,85,75,102,130,144,116,84,52,20,0,0,0,0,16,46,77,108,136,140,111,88,110,139,138,109,79,48,
+  18,0,0,0,0,24,56,88,120,141,116,84,52,20,0,0,0,12,42,71,95,111,114,123,142,124,117,136,141,118,109,92,
+  67,38,8,0,8,40,71,103,132,134,108,103,125,137,108,80,76,75,64,44,19,0,0,0,0,0,12,43,75,106,135,140,
+  110,82,68,67,60,49,42,31,15,0,0,0,6,37,68,98,127,144,120,93,83,98,125,144,120,90,60,29,0,0,0,0,
+  0,20,52,83,114,136,140,153,157,140,139,136,117,87,55,24,0,0,16,48,79,111,141,140,109,78,68,98,129,145,116,84,
+  52,20,0,0,0,24,56,88,120,144,126,129,138,141,133,113,92,66,37,7,0,0,0,8,40,71,103,129,139,141,140,120,
+  91,59,28,0,0,0,0,0,16,48,80,112,143,139,108,88,107,128,136,120,91,59,28,0,0,0,0,0,0,17,48,80,
+  112,143,135,104,72,40,8,0,0,0,0,0,0,24,56,88,120,143,120,89,62,80,112,143,135,104,72,40,8,0,12,44,
+  76,108,139,143,112,80,64,93,124,143,116,84,52,20,0,0,0,0,7,37,67,96,123,142,120,97,117,141,125,98,69,40,
+  9,0,0,0,0,24,56,88,120,141,116,84,52,20,0,0,0,16,47,79,110,133,139,147,155,143,141,154,150,139,131,106,
+  75,44,12,0,5,36,67,97,125,139,120,119,137,132,106,102,108,105,89,62,32,1,0,0,0,0,21,46,72,99,124,143,
+  124,100,74,55,67,75,72,59,39,14,0,0,11,42,74,105,135,143,114,102,110,100,117,144,128,98,67,36,5,0,0,0,
+  0,17,47,76,101,118,124,145,150,125,120,118,104,78,49,19,0,0,16,48,79,111,141,140,109,78,68,98,129,145,116,84,
+  52,20,0,0,0,24,56,88,120,149,146,136,126,132,146,134,108,77,46,15,0,0,0,5,36,66,94,113,121,131,148,124,
+  92,60,28,0,0,0,0,0,16,48,80,112,143,139,108,107,129,142,126,104,81,53,23,0,0,0,0,0,0,16,48,80,
+  112,143,135,104,72,40,8,0,0,0,0,0,0,24,56,88,120,143,120,89,62,80,112,143,135,104,72,40,8,0,12,44,
+  76,108,139,143,112,80,64,93,124,143,116,84,52,20,0,0,0,0,0,25,53,83,113,141,133,112,130,141,114,84,55,27,
+  0,0,0,0,0,24,56,88,120,141,116,84,52,20,0,0,0,13,42,71,98,114,121,145,141,122,128,146,128,118,112,95,
+  68,38,8,0,0,27,55,82,109,133,139,141,141,120,110,125,131,125,99,67,36,4,0,0,0,7,37,65,90,112,136,143,
+  140,118,95,75,92,107,102,83,57,27,0,0,12,44,76,108,139,143,113,124,137,117,116,146,134,103,71,40,8,0,0,0,
+  0,5,32,56,77,88,106,136,143,113,90,87,78,59,35,7,0,0,13,44,76,107,138,143,113,83,76,105,135,146,116,84,
+  52,20,0,0,0,24,56,88,120,150,139,113,98,109,135,143,114,83,51,19,0,0,0,0,23,50,71,83,93,118,143,124,
+  92,60,28,0,0,0,0,0,16,48,80,112,143,140,115,129,142,125,104,82,59,36,10,0,0,0,0,0,0,16,48,80,
+  112,143,135,104,72,40,8,0,0,0,0,0,0,24,56,88,120,146,127,100,74,87,116,143,132,102,71,40,8,0,10,41,
+  72,103,133,143,114,85,75,102,130,144,116,84,52,20,0,0,0,0,0,13,43,74,104,132,141,122,141,135,106,76,45,15,
+  0,0,0,0,0,24,56,88,120,141,116,84,52,20,0,0,0,27,51,71,84,92,113,140,124,105,126,141,113,92,84,71,
+  50,25,0,0,0,12,38,66,92,110,120,124,130,135,136,123,117,107,88,62,33,4,0,0,0,17,47,78,107,133,136,119,
+  134,137,114,92,108,133,124,95,64,32,0,0,12,44,76,108,139,143,114,128,139,121,116,146,135,104,72,40,8,0,0,0,
+  0,0,11,33,50,72,104,135,143,112,80,58,49,35,14,0,0,0,9,40,70,100,127,144,124,105,99,116,143,147,116,84,
+  52,20,0,0,0,24,56,88,120,146,127,98,75,95,125,143,116,84,52,20,0,0,0,0,5,27,43,57,84,116,143,124,
+  92,60,28,0,0,0,0,0,16,48,80,112,143,151,135,146,128,105,81,59,36,14,0,0,0,0,0,0,0,16,48,80,
+  112,143,135,104,72,40,8,0,0,0,0,0,0,24,56,88,120,150,139,114,98,107,128,144,121,92,63,33,3,0,4,35,
+  65,94,122,144,127,106,99,114,141,147,116,84,52,20,0,0,0,0,0,3,33,62,90,118,144,142,145,120,93,66,36,6,
+  0,0,0,0,0,24,56,88,120,141,116,84,52,20,0,0,12,42,71,95,111,114,123,141,123,117,137,140,117,109,92,67,
+  39,10,0,0,0,0,24,53,83,114,131,132,117,119,141,143,138,121,100,73,44,14,0,0,0,24,55,86,117,139,120,99,
+  115,138,133,110,112,140,125,94,63,31,0,0,12,44,76,108,139,143,112,105,111,102,116,146,134,103,71,40,8,0,0,0,
+  0,0,0,11,40,72,104,135,143,112,80,48,22,7,0,0,0,0,0,29,57,85,113,138,144,131,127,138,152,147,116,84,
+  52,20,0,0,0,24,56,88,120,144,121,90,67,92,124,143,116,84,52,20,0,0,0,0,0,1,22,52,84,116,143,124,
+  92,60,28,0,0,0,0,0,16,48,80,112,143,161,149,153,133,106,79,54,29,4,0,0,0,0,0,0,0,16,48,80,
+  112,143,135,104,72,40,8,0,0,0,0,0,0,24,56,88,120,150,148,137,126,132,145,136,110,80,51,21,0,0,0,23,
+  52,82,111,137,145,132,127,138,149,147,116,84,52,20,0,0,0,0,0,0,20,49,79,110,139,161,141,112,81,51,23,0,
+  0,0,0,0,0,24,56,87,118,136,114,83,52,20,0,0,16,47,79,110,133,139,148,153,142,142,154,148,139,131,106,75,
+  44,12,0,0,0,0,17,47,76,99,108,106,109,132,139,124,131,138,114,84,53,22,0,0,0,28,60,92,123,141,115,86,
+  98,120,141,129,119,138,118,88,57,26,0,0,11,42,74,105,135,143,113,86,80,88,117,144,128,98,67,36,5,0,0,0,
+  0,0,0,8,40,72,104,135,143,112,80,48,16,0,0,0,0,0,0,14,42,71,96,116,134,140,139,130,134,144,115,84,
+  52,20,0,0,0,24,56,88,120,143,120,88,66,92,124,143,116,84,52,20,0,0,0,0,0,9,25,52,84,116,143,124,
+  92,60,30,9,0,0,0,0,16,48,80,112,143,147,125,133,143,122,98,73,48,23,0,0,0,0,0,0,0,16,48,80,
+  112,143,135,104,72,40,20,7,0,0,0,0,0,24,56,88,120,144,128,134,140,140,131,113,93,67,39,10,0,0,0,11,
+  41,69,95,114,133,141,139,133,130,143,116,84,52,20,0,0,0,0,0,0,13,40,70,100,127,149,130,103,73,43,12,0,
+  0,0,0,0,0,20,50,77,99,110,98,74,46,16,0,0,12,42,71,98,114,122,146,139,121,129,146,125,118,112,95,68,
+  38,8,0,0,0,0,5,32,55,71,76,83,111,137,120,99,111,137,122,91,59,28,0,0,0,28,60,92,123,143,119,93,
+  82,104,128,146,141,138,111,81,50,19,0,0,6,37,68,98,127,144,120,92,75,98,125,144,120,90,60,29,0,0,0,0,
+  0,0,0,8,40,72,104,135,143,112,80,48,16,0,0,0,0,0,0,2,30,55,76,93,106,111,111,109,133,142,112,81,
+  49,18,0,0,0,24,56,88,120,143,120,88,66,92,124,143,116,84,52,20,0,0,0,0,14,35,51,59,84,116,143,124,
+  92,63,51,37,19,0,0,0,16,48,80,112,143,140,110,113,138,140,117,93,67,40,14,0,0,0,0,0,0,16,48,80,
+  112,143,136,104,74,56,49,33,11,0,0,0,0,24,56,88,120,143,120,106,111,111,104,89,69,48,23,0,0,0,0,0,
+  25,50,70,90,105,111,111,105,120,141,116,84,52,20,0,0,0,0,0,14,35,50,72,100,127,143,117,89,61,32,3,0,
+  0,0,0,0,0,26,55,81,103,114,100,77,49,19,0,0,0,28,53,74,88,113,139,123,104,127,140,112,89,82,71,50,
+  25,0,0,0,0,0,0,11,29,41,51,80,111,137,121,102,112,137,122,91,60,28,0,0,0,24,55,86,116,142,136,114,
+  100,97,116,141,154,128,102,73,43,13,0,0,0,28,57,87,116,143,134,110,98,113,139,141,113,82,52,21,0,0,0,0,
+  0,0,0,8,40,72,104,135,143,112,80,48,16,0,0,0,0,0,0,8,38,67,92,107,105,98,99,114,140,137,109,78,
+  47,15,0,0,0,24,56,88,120,143,120,88,66,92,124,143,116,84,52,20,0,0,0,10,36,59,79,88,93,118,143,124,
+  97,88,80,64,42,17,0,0,16,48,80,112,143,139,108,96,119,142,136,111,84,59,32,4,0,0,0,0,0,15,47,78,
+  109,139,140,112,92,87,77,56,30,2,0,0,0,24,56,88,120,143,120,89,80,79,74,63,45,24,3,0,0,0,0,0,
+  5,26,45,64,75,80,80,89,120,141,116,84,52,20,0,0,0,0,9,35,59,78,93,113,140,138,110,79,48,18,0,0,
+  0,0,0,0,0,32,63,95,124,139,118,87,56,24,0,0,0,8,33,59,88,118,139,115,107,136,136,106,75,53,42,27,
+  5,0,0,0,0,0,0,0,0,15,44,75,104,131,140,127,134,138,114,84,54,23,0,0,0,16,46,75,103,128,144,140,
+  128,125,135,145,151,136,109,80,51,20,0,0,0,16,46,76,105,131,145,134,126,137,143,126,101,73,43,13,0,0,0,0,
+  0,0,0,8,40,72,104,135,143,112,80,48,16,0,0,0,0,0,0,12,44,75,107,132,134,126,126,138,142,122,96,69,
+  40,9,0,0,0,24,56,88,120,143,120,88,66,92,124,143,116,84,52,20,0,0,0,23,53,81,104,119,121,131,152,137,
+  122,119,108,87,60,31,0,0,16,48,80,112,143,139,108,83,103,127,144,128,103,75,46,16,0,0,0,0,0,10,41,71,
+  100,127,145,133,122,118,100,73,43,13,0,0,0,24,56,88,120,143,120,88,58,48,43,34,19,0,0,0,0,0,0,0,
+  0,0,20,35,44,48,58,88,120,141,116,84,52,20,0,0,0,0,20,51,79,104,121,134,143,122,97,69,40,10,0,0,
+  0,0,0,0,0,32,63,95,124,138,117,87,55,24,0,0,0,0,32,63,95,123,133,110,110,134,123,96,67,37,14,0,
+  0,0,0,0,0,0,0,0,0,4,34,63,89,110,132,139,136,119,98,73,44,14,0,0,0,4,32,60,84,105,122,137,
+  141,139,135,120,126,137,118,87,56,24,0,0,0,5,34,62,87,108,127,139,140,137,124,104,81,57,30,2,0,0,0,0,
+  0,0,0,8,40,71,103,130,136,111,79,48,16,0,0,0,0,0,0,9,40,70,99,125,138,140,140,136,121,101,78,52,
+  26,0,0,0,0,24,55,87,117,136,118,87,65,91,120,136,114,83,52,20,0,0,0,28,59,91,119,137,139,141,143,142,
+  139,137,125,99,67,36,4,0,16,47,79,110,135,132,106,76,83,109,133,136,113,83,51,20,0,0,0,0,0,0,29,57,
+  84,107,128,139,139,135,110,79,48,16,0,0,0,24,56,87,118,136,117,87,55,26,12,4,0,0,0,0,0,0,0,0,
+  0,0,0,5,13,26,56,87,118,136,114,83,52,20,0,0,0,0,24,56,87,117,136,140,126,104,79,53,27,0,0,0,
+  0,0,0,0,0,26,55,81,101,110,98,75,48,18,0,0,0,0,27,57,83,101,107,93,95,109,101,80,54,25,0,0,
+  0,0,0,0,0,0,0,0,0,0,19,44,66,89,105,111,108,95,75,53,29,2,0,0,0,0,16,39,61,79,97,108,
+  112,111,106,94,101,110,100,77,49,19,0,0,0,0,18,42,63,84,101,110,112,109,98,80,59,36,12,0,0,0,0,0,
+  0,0,0,4,35,64,89,105,110,95,71,42,12,0,0,0,0,0,0,0,29,57,81,99,108,112,112,108,95,77,56,33,
+  8,0,0,0,0,18,48,75,98,110,99,77,58,78,100,110,98,74,46,16,0,0,0,23,53,80,101,111,112,112,112,112,
+  112,111,104,87,60,31,0,0,11,41,69,95,110,106,90,65,65,90,106,111,98,74,46,16,0,0,0,0,0,0,14,39,
+  62,84,102,110,112,111,95,71,42,12,0,0,0,19,49,77,99,110,98,75,48,18,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,19,49,77,99,110,98,74,46,16,0,0,0,0,19,49,77,99,111,111,101,82,59,35,9,0,0,0,
+  0,0,0,0,0,11,36,58,73,79,71,53,30,5,0,0,0,0,14,39,59,71,75,67,69,79,72,57,36,10,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,22,45,64,75,80,77,69,51,30,8,0,0,0,0,0,0,16,35,53,69,77,
+  80,80,76,67,73,79,72,56,33,7,0,0,0,0,0,19,39,58,71,79,80,78,69,54,35,14,0,0,0,0,0,0,
+  0,0,0,0,20,45,64,75,79,71,51,27,0,0,0,0,0,0,0,0,12,36,57,70,77,80,80,77,68,51,33,11,
+  0,0,0,0,0,5,30,53,71,79,71,55,39,56,72,79,71,53,30,3,0,0,0,10,36,57,73,80,80,80,80,80,
+  80,80,74,62,42,17,0,0,0,26,50,69,79,76,65,45,45,65,76,79,71,53,30,3,0,0,0,0,0,0,0,17,
+  39,60,72,79,80,79,71,51,27,0,0,0,0,7,33,55,71,79,71,53,30,5,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,7,33,55,71,79,71,53,30,3,0,0,0,0,7,33,55,71,79,79,72,58,36,14,0,0,0,0,
+  0,0,0,0,0,0,13,30,43,48,42,28,8,0,0,0,0,0,0,15,30,41,44,38,41,47,42,30,12,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,20,35,44,48,46,40,26,6,0,0,0,0,0,0,0,0,9,27,39,46,
+  48,48,44,38,43,48,42,30,11,0,0,0,0,0,0,0,14,30,41,47,48,46,40,27,10,0,0,0,0,0,0,0,
+  0,0,0,0,0,20,35,44,48,42,27,5,0,0,0,0,0,0,0,0,0,12,29,40,46,48,48,46,38,25,7,0,
+  0,0,0,0,0,0,8,28,42,47,42,29,16,30,42,47,42,28,8,0,0,0,0,0,12,30,43,48,48,48,48,48,
+  48,48,43,33,18,0,0,0,0,5,26,41,47,44,37,21,21,37,45,48,42,28,8,0,0,0,0,0,0,0,0,0,
+  16,32,42,47,48,48,42,27,5,0,0,0,0,0,11,29,42,47,42,28,8,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,11,29,42,47,42,28,8,0,0,0,0,0,0,11,29,42,48,48,42,30,13,0,0,0,0,0,
+  0,0,0,0,0,0,0,2,13,16,12,0,0,0,0,0,0,0,0,0,1,10,12,8,11,16,12,2,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,5,13,16,14,9,0,0,0,0,0,0,0,0,0,0,0,0,8,14,
+  16,16,13,8,13,16,12,2,0,0,0,0,0,0,0,0,0,1,10,15,16,15,9,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,5,13,16,12,0,0,0,0,0,0,0,0,0,0,0,0,0,9,14,16,16,14,8,0,0,0,
+  0,0,0,0,0,0,0,0,12,16,12,0,0,2,12,16,12,0,0,0,0,0,0,0,0,2,13,16,16,16,16,16,
+  16,16,13,3,0,0,0,0,0,0,0,11,16,13,7,0,0,7,14,16,12,0,0,0,0,0,0,0,0,0,0,0,
+  0,2,11,16,16,16,12,0,0,0,0,0,0,0,0,0,12,16,12,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,12,16,12,0,0,0,0,0,0,0,0,0,0,12,16,16,12,2,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,4,11,15,16,16,11,0,0,0,0,0,0,0,0,0,0,0,1,10,14,16,16,14,8,0,0,0,0,
+  0,0,0,0,0,0,0,4,11,15,16,16,14,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,16,
+  16,12,0,0,0,0,0,0,0,0,0,0,12,16,16,16,16,16,16,13,2,0,0,0,0,0,0,0,0,0,0,0,
+  7,13,16,16,15,9,0,0,0,0,0,0,0,0,0,8,14,16,16,16,16,16,16,16,13,2,0,0,0,0,0,0,
+  0,0,0,4,11,16,16,15,10,2,0,0,0,0,0,0,0,0,0,0,0,7,13,16,16,14,9,0,0,0,0,0,
+  0,0,0,0,0,0,3,11,15,16,15,10,1,0,0,0,0,0,0,0,0,0,0,0,0,0,8,15,16,13,4,0,
+  0,0,0,0,0,0,0,0,0,0,3,13,16,16,16,16,15,11,3,0,0,0,0,0,0,0,0,0,0,0,0,3,
+  11,16,16,16,12,5,0,0,0,0,0,0,0,0,8,14,16,16,16,14,10,1,0,0,0,0,0,0,0,0,0,0,
+  0,0,6,22,35,42,47,48,47,41,24,3,0,0,0,0,0,0,0,0,17,31,41,46,48,48,45,38,25,7,0,0,
+  0,0,0,0,0,0,20,35,42,47,48,48,45,39,27,10,0,0,0,0,0,0,0,0,0,0,0,0,8,27,42,48,
+  48,42,28,8,0,0,0,0,0,0,8,28,42,48,48,48,48,48,48,43,30,13,0,0,0,0,0,0,0,0,5,22,
+  37,44,48,48,46,40,28,11,0,0,0,0,0,3,23,38,46,48,48,48,48,48,48,48,43,30,13,0,0,0,0,0,
+  0,2,20,35,43,47,48,47,41,32,17,0,0,0,0,0,0,0,0,4,22,37,44,48,48,46,40,27,10,0,0,0,
+  0,0,0,0,1,19,33,42,47,48,47,41,30,15,0,0,0,0,0,0,0,0,0,0,3,23,38,46,48,44,34,18,
+  0,0,0,0,0,0,0,0,0,16,32,43,48,48,48,48,47,42,33,19,2,0,0,0,0,0,0,0,0,1,18,33,
+  42,47,48,47,43,35,20,0,0,0,0,0,3,23,38,46,48,48,48,46,41,30,16,0,0,0,0,0,0,0,0,0,
+  0,8,31,50,64,73,79,80,79,69,48,24,0,0,0,0,0,0,0,20,42,60,71,77,80,80,76,68,51,34,14,0,
+  0,0,0,0,0,21,45,64,73,78,80,80,76,69,54,37,19,0,0,0,0,0,0,0,0,0,0,3,29,53,71,79,
+  79,71,53,30,3,0,0,0,0,3,30,53,71,79,80,80,80,80,80,73,58,36,10,0,0,0,0,0,0,11,32,49,
+  66,76,80,80,78,70,55,33,8,0,0,0,0,23,48,67,77,80,80,80,80,80,80,80,73,58,36,10,0,0,0,0,
+  8,29,46,64,74,79,80,78,72,61,44,27,5,0,0,0,0,0,8,30,48,66,76,80,80,77,69,54,35,14,0,0,
+  0,0,0,5,27,45,62,73,78,80,78,71,59,40,21,0,0,0,0,0,0,0,0,0,23,48,67,77,80,75,62,42,
+  18,0,0,0,0,0,0,0,15,39,60,74,80,80,80,80,79,73,62,46,29,8,0,0,0,0,0,0,8,28,45,62,
+  73,79,80,79,74,64,45,21,0,0,0,0,23,48,67,77,80,80,80,77,71,59,43,28,8,0,0,0,0,0,0,0,
+  0,27,53,76,93,104,110,112,110,93,69,41,11,0,0,0,0,0,17,42,65,87,101,108,112,111,107,95,78,59,36,13,
+  0,0,0,0,7,37,65,90,104,109,112,111,107,97,81,63,42,18,0,0,0,0,0,0,0,0,0,22,48,73,97,111,
+  111,98,74,46,16,0,0,0,0,16,46,74,98,111,112,112,112,112,111,101,81,53,23,0,0,0,0,0,11,34,56,76,
+  93,106,111,112,109,99,78,51,22,0,0,0,8,38,67,92,108,112,112,112,112,112,112,111,101,81,53,23,0,0,0,2,
+  29,53,73,90,104,110,112,109,103,87,71,50,26,0,0,0,0,2,29,53,74,92,106,111,112,108,97,80,59,36,12,0,
+  0,0,0,25,50,71,89,104,109,112,109,101,84,65,45,20,0,0,0,0,0,0,0,8,38,67,92,108,111,105,87,62,
+  34,4,0,0,0,0,0,0,30,58,84,103,111,112,112,112,110,104,90,73,53,28,0,0,0,0,0,6,30,53,72,88,
+  104,110,112,110,105,90,65,38,9,0,0,8,38,67,92,108,112,112,112,108,101,87,71,53,29,5,0,0,0,0,0,0,
+  9,40,69,97,120,133,140,143,136,110,79,47,16,0,0,0,0,0,31,60,87,110,129,138,140,140,136,121,103,82,58,30,
+  2,0,0,0,17,47,78,107,131,138,140,140,137,123,107,87,62,34,5,0,0,0,0,0,0,0,11,38,66,92,117,138,
+  139,114,83,52,20,0,0,0,0,20,52,83,114,139,143,139,139,139,137,120,91,59,28,0,0,0,0,2,29,55,79,101,
+  119,135,140,140,137,121,93,63,32,1,0,0,12,44,75,106,131,138,139,139,139,139,143,140,121,91,59,28,0,0,0,15,
+  44,73,98,116,132,139,140,139,130,114,95,69,41,11,0,0,0,19,46,73,98,118,135,140,140,137,123,104,81,57,30,2,
+  0,0,8,38,68,95,114,132,138,140,139,128,109,89,64,35,6,0,0,0,0,0,0,16,47,78,109,134,142,130,104,75,
+  44,13,0,0,0,0,0,4,36,67,99,127,142,141,139,139,139,132,116,98,71,43,14,0,0,0,0,26,51,75,98,115,
+  131,139,140,139,132,109,80,51,20,0,0,12,44,75,107,133,142,140,140,138,129,114,98,74,50,26,0,0,0,0,0,0,
+  12,44,75,107,133,141,141,155,143,112,80,48,16,0,0,0,0,4,36,67,99,125,138,133,124,126,139,143,126,101,73,43,
+  13,0,0,0,20,51,83,113,133,129,124,126,136,144,131,105,76,45,14,0,0,0,0,0,0,0,29,55,80,108,135,159,
+  147,116,84,52,20,0,0,0,0,20,52,84,116,146,140,122,120,120,119,104,81,53,23,0,0,0,0,13,44,73,100,123,
+  141,137,126,124,128,125,98,67,35,4,0,0,8,38,68,95,114,119,120,120,120,124,147,145,116,86,55,24,0,0,0,26,
+  55,85,114,140,144,130,124,132,146,137,111,81,51,20,0,0,3,33,62,90,116,140,142,129,126,137,143,126,101,73,43,13,
+  0,0,12,44,75,107,132,137,127,125,136,146,132,106,76,45,13,0,0,0,0,0,0,25,54,84,115,144,154,141,112,81,
+  50,19,0,0,0,0,0,4,36,68,100,131,152,132,121,121,130,144,139,113,84,55,24,0,0,0,11,41,69,95,119,139,
+  141,130,123,128,136,117,87,56,24,0,0,12,44,76,108,139,149,126,124,133,141,138,118,95,69,41,11,0,0,0,0,0,
+  8,38,67,93,110,111,115,141,143,112,80,48,16,0,0,0,0,0,31,60,87,104,111,104,94,98,116,142,141,111,80,49,
+  18,0,0,0,14,44,72,95,104,99,92,97,113,139,143,112,80,48,17,0,0,0,0,0,0,18,44,71,99,123,145,160,
+  147,116,84,52,20,0,0,0,0,20,52,84,116,143,126,99,92,91,89,79,59,36,10,0,0,0,0,25,54,84,113,139,
+  134,112,99,95,98,99,84,58,30,0,0,0,0,25,50,72,84,88,88,88,91,113,143,137,109,78,47,16,0,0,0,31,
+  63,94,124,145,125,105,94,107,132,146,118,87,56,24,0,0,11,42,73,104,132,144,121,103,97,113,138,141,112,82,51,20,
+  0,0,9,40,69,95,111,109,98,96,113,141,142,111,80,48,16,0,0,0,0,0,7,37,67,96,124,144,131,142,119,90,
+  61,32,2,0,0,0,0,4,36,68,100,131,146,118,93,91,105,125,145,123,92,60,28,0,0,0,20,50,81,111,138,142,
+  118,103,92,100,107,99,77,49,19,0,0,12,44,76,108,139,144,113,95,104,118,142,138,111,81,50,19,0,0,0,0,0,
+  0,23,48,69,79,83,108,139,143,112,80,48,16,0,0,0,0,0,17,42,62,75,79,74,64,76,106,136,145,115,84,52,
+  20,0,0,0,1,27,50,67,74,80,82,87,109,137,143,113,83,51,20,0,0,0,0,0,7,34,62,87,113,137,127,137,
+  146,116,84,52,20,0,0,0,0,20,52,84,116,143,128,113,112,109,97,79,59,36,12,0,0,0,5,36,66,95,124,142,
+  118,110,112,111,106,90,72,51,26,0,0,0,0,5,27,44,53,56,56,69,94,122,143,124,97,69,39,8,0,0,0,28,
+  60,91,122,144,123,98,85,102,130,145,118,87,55,24,0,0,12,44,76,108,139,143,112,82,72,98,126,144,119,89,58,27,
+  0,0,0,26,50,71,79,78,72,82,110,140,142,111,80,48,16,0,0,0,0,0,14,46,77,107,136,139,120,141,131,103,
+  72,42,11,0,0,0,0,4,36,68,100,131,145,116,88,83,99,123,145,123,92,60,28,0,0,1,32,62,91,120,144,129,
+  103,77,63,71,76,71,55,33,7,0,0,12,44,76,108,139,143,112,81,78,103,131,145,119,89,59,30,0,0,0,0,0,
+  0,3,24,41,51,76,108,139,143,112,80,48,16,0,0,0,0,0,0,18,34,44,48,45,53,78,109,138,143,113,82,50,
+  19,0,0,0,0,6,31,57,84,103,112,117,127,143,132,106,76,46,15,0,0,0,0,0,25,50,77,105,131,136,113,131,
+  145,116,84,52,20,0,0,0,0,20,52,84,115,145,145,139,140,138,122,104,81,57,30,2,0,0,10,41,73,104,134,146,
+  125,136,139,140,133,114,95,69,41,11,0,0,0,0,1,14,22,27,47,77,108,136,142,113,83,54,27,0,0,0,0,23,
+  53,82,111,136,138,120,116,121,140,134,108,79,49,18,0,0,12,44,76,108,139,143,112,80,67,94,125,148,126,96,65,33,
+  2,0,0,5,27,42,49,59,79,101,123,144,131,105,75,44,13,0,0,0,0,0,22,52,83,114,141,129,111,135,140,110,
+  80,48,17,0,0,0,0,4,36,68,100,131,149,124,114,114,121,140,139,114,85,55,24,0,0,8,39,70,101,131,145,118,
+  88,60,36,41,44,41,29,11,0,0,0,12,44,76,108,139,143,112,80,64,91,121,146,128,99,68,37,6,0,0,0,0,
+  0,0,0,16,44,76,108,139,143,112,80,48,16,0,0,0,0,0,0,0,4,15,27,47,71,95,119,143,133,106,76,45,
+  14,0,0,0,0,0,32,63,95,123,137,142,149,132,112,92,66,37,8,0,0,0,0,12,39,68,95,118,138,120,105,131,
+  145,116,84,52,20,0,0,0,0,17,48,78,108,130,123,120,126,140,144,126,101,73,43,13,0,0,12,44,76,108,139,158,
+  143,131,122,130,144,137,111,81,51,21,0,0,0,0,0,0,3,31,59,86,115,143,133,105,75,44,14,0,0,0,0,16,
+  44,72,99,119,141,144,141,145,138,116,95,69,40,11,0,0,12,43,75,106,135,144,117,93,86,107,134,155,131,100,68,36,
+  4,0,0,0,1,21,46,75,101,123,142,135,112,89,63,34,4,0,0,0,0,5,35,64,93,121,141,118,100,124,141,117,
+  87,57,29,0,0,0,0,4,36,68,100,131,156,145,139,140,144,144,122,102,76,48,20,0,0,12,43,75,106,137,145,115,
+  84,52,21,10,12,10,0,0,0,0,0,12,44,76,108,139,143,112,80,59,84,116,146,135,104,72,40,8,0,0,0,0,
+  0,0,0,12,44,76,108,139,143,112,80,48,16,0,0,0,0,0,0,0,0,21,45,68,92,114,138,139,115,90,64,35,
+  6,0,0,0,0,0,27,57,84,105,118,123,136,143,125,102,74,45,15,0,0,0,0,29,55,82,110,136,133,107,100,131,
+  145,116,84,53,28,5,0,0,0,8,37,65,90,103,95,88,99,117,141,141,113,82,51,20,0,0,12,44,76,108,139,156,
+  132,108,93,105,128,145,121,92,62,32,1,0,0,0,0,0,11,42,72,102,128,143,119,91,64,35,5,0,0,0,0,29,
+  57,84,111,135,142,128,121,130,142,131,107,79,50,21,0,0,7,37,66,94,121,144,137,119,116,127,144,157,131,100,68,36,
+  4,0,0,0,0,31,60,88,116,141,136,113,92,68,44,19,0,0,0,0,0,13,44,75,105,134,141,112,92,115,142,128,
+  100,70,40,9,0,0,0,4,36,68,100,131,151,129,119,120,127,141,137,114,88,62,33,3,0,12,44,76,108,139,143,112,
+  81,50,18,0,0,0,0,0,0,0,0,12,44,76,108,139,143,112,80,58,84,116,146,135,104,72,40,8,0,0,0,0,
+  0,0,0,12,44,76,108,139,143,112,80,48,16,0,0,0,0,0,0,0,19,42,65,90,112,135,140,119,98,71,45,20,
+  0,0,0,0,0,0,17,39,61,77,87,95,111,136,142,115,84,54,23,0,0,0,12,42,71,99,125,139,116,93,100,131,
+  145,116,88,71,51,27,0,0,0,0,21,45,64,71,66,59,75,102,131,146,118,87,56,24,0,0,12,44,76,108,139,147,
+  118,90,68,87,117,145,131,101,70,38,7,0,0,0,0,0,23,51,81,111,140,140,111,80,50,21,0,0,0,0,8,39,
+  70,99,127,143,122,102,91,105,127,143,120,92,62,32,1,0,0,23,51,78,103,126,140,140,139,137,128,147,130,99,68,36,
+  4,0,0,0,6,38,69,100,129,143,118,93,69,48,24,0,0,0,0,0,0,21,50,81,112,142,141,117,112,118,144,138,
+  109,78,47,16,0,0,0,4,36,68,100,131,146,118,92,89,101,120,143,131,104,73,42,11,0,12,43,75,106,137,145,115,
+  84,52,21,10,12,10,0,0,0,0,0,12,44,76,108,139,143,112,80,59,84,116,146,135,104,72,40,8,0,0,0,0,
+  0,0,0,17,44,76,108,139,143,112,80,48,19,0,0,0,0,0,0,18,42,64,87,110,133,141,121,100,76,53,28,2,
+  0,0,0,0,3,23,38,44,47,52,56,69,95,123,144,122,91,60,28,0,0,0,16,48,79,111,140,138,117,112,116,135,
+  148,124,113,95,71,42,12,0,0,2,24,39,48,49,44,40,65,95,125,146,120,88,56,24,0,0,11,42,74,105,135,146,
+  116,84,60,84,115,144,135,104,72,40,8,0,0,0,0,6,36,66,93,120,143,128,101,71,41,11,0,0,0,0,12,44,
+  75,107,137,143,113,82,65,86,117,145,131,101,70,39,7,0,0,7,34,59,82,101,112,116,115,111,118,143,124,94,63,32,
+  0,0,0,0,8,40,71,103,133,141,111,80,51,25,3,0,0,0,0,0,2,32,62,90,119,147,147,140,139,140,150,144,
+  115,84,54,25,0,0,0,4,36,68,100,131,145,116,84,62,81,110,141,141,110,79,47,16,0,8,39,70,101,131,145,118,
+  88,60,36,41,44,41,29,11,0,0,0,12,44,76,108,139,143,112,80,64,90,120,146,129,99,68,37,6,0,0,0,0,
+  0,2,24,42,57,77,108,139,143,112,80,58,42,24,2,0,0,0,11,37,63,87,109,132,141,123,101,78,63,50,33,11,
+  0,0,0,0,23,48,67,75,75,70,62,71,96,123,145,123,92,60,28,0,0,0,16,48,80,111,140,146,140,139,140,152,
+  161,145,135,110,79,47,16,0,0,22,47,67,75,75,69,62,76,103,131,146,118,87,55,24,0,0,6,38,69,100,128,144,
+  119,91,70,88,117,145,130,100,69,38,6,0,0,0,0,15,45,76,106,135,143,115,86,58,30,1,0,0,0,0,12,44,
+  76,108,139,144,113,84,67,87,117,146,134,103,72,40,8,0,0,0,25,49,70,82,84,84,87,102,128,142,117,86,55,25,
+  0,0,0,0,4,35,65,94,117,126,103,74,43,13,0,0,0,0,0,0,11,42,72,103,131,145,124,120,120,120,128,145,
+  124,96,67,37,7,0,0,4,36,68,100,131,145,116,84,64,80,110,140,142,111,80,48,16,0,1,32,62,91,120,144,129,
+  103,77,63,71,76,71,55,33,7,0,0,12,44,76,108,139,143,112,81,77,103,131,145,119,90,60,30,0,0,0,0,0,
+  0,20,47,69,86,96,112,141,144,113,96,86,69,47,20,0,0,0,27,55,82,107,130,145,125,103,91,88,87,77,56,32,
+  5,0,0,8,38,67,92,107,107,100,92,98,114,138,144,117,86,55,24,0,0,0,13,43,73,100,117,120,120,120,122,141,
+  153,129,117,98,71,42,12,0,5,36,66,92,107,106,99,93,102,117,142,140,112,81,50,19,0,0,0,30,59,88,117,144,
+  133,110,97,107,129,144,120,91,62,32,1,0,0,0,0,29,57,85,114,143,136,108,77,46,16,0,0,0,0,0,10,42,
+  73,103,132,146,123,105,95,107,128,146,125,96,66,36,5,0,0,8,38,67,92,107,100,93,102,118,141,136,109,78,48,17,
+  0,0,0,0,4,35,64,90,109,115,99,72,42,12,0,0,0,0,0,0,18,49,80,111,140,138,109,89,88,90,113,142,
+  136,107,77,46,14,0,0,4,36,68,100,131,146,118,93,91,102,119,144,136,107,76,45,14,0,0,20,50,81,111,138,142,
+  118,103,92,100,107,99,77,49,19,0,0,12,44,76,108,139,144,113,95,104,118,142,138,111,81,50,20,0,0,0,0,0,
+  1,32,62,90,113,126,130,151,151,130,126,113,90,62,32,1,0,5,36,67,97,125,149,149,125,120,120,120,118,101,76,47,
+  17,0,0,12,44,75,106,131,137,129,124,127,139,145,132,106,77,47,17,0,0,0,2,29,55,76,87,88,88,88,102,132,
+  146,117,91,75,53,28,0,0,8,40,72,103,131,136,128,124,130,141,142,123,99,71,42,12,0,0,0,17,48,78,107,132,
+  145,135,125,133,145,135,110,80,50,20,0,0,0,0,10,41,71,100,127,144,122,95,67,37,7,0,0,0,0,0,3,33,
+  62,90,116,140,144,131,124,133,145,137,112,83,55,26,0,0,0,12,44,75,107,132,128,124,130,141,139,118,95,68,38,8,
+  0,0,0,0,8,40,71,103,131,137,111,79,48,16,0,0,0,0,0,0,27,57,87,117,143,129,101,71,57,76,107,136,
+  143,114,83,52,21,0,0,4,36,68,100,131,152,132,121,122,129,141,141,119,95,68,38,8,0,0,11,41,69,95,119,139,
+  141,130,123,128,136,117,87,56,24,0,0,12,44,76,108,139,149,125,123,132,141,139,119,95,69,41,11,0,0,0,0,0,
+  4,36,67,99,127,139,142,143,143,142,139,127,99,67,36,4,0,8,40,71,103,130,142,143,139,139,139,139,136,114,83,52,
+  20,0,0,8,38,68,96,120,136,139,140,140,137,124,108,89,64,35,6,0,0,0,0,11,32,48,55,56,56,68,99,127,
+  137,114,83,54,31,8,0,0,6,37,67,96,122,138,140,140,140,135,119,101,79,55,29,0,0,0,0,7,36,64,89,109,
+  128,139,141,140,130,112,92,67,39,10,0,0,0,0,12,44,75,107,133,137,112,82,52,25,0,0,0,0,0,0,0,19,
+  46,73,98,116,133,140,140,140,131,113,95,69,41,13,0,0,0,10,41,72,103,129,139,140,140,133,116,98,74,50,25,0,
+  0,0,0,0,8,40,71,103,131,136,111,79,48,16,0,0,0,0,0,0,32,63,95,123,137,118,89,59,42,68,97,125,
+  137,117,87,56,24,0,0,4,36,67,99,127,142,141,139,139,140,134,118,101,76,50,25,0,0,0,0,26,51,75,98,115,
+  132,139,140,139,132,109,80,51,20,0,0,12,44,75,107,133,142,140,140,138,130,114,98,75,51,26,0,0,0,0,0,0,
+  0,31,60,87,104,111,112,112,112,112,111,104,87,60,31,0,0,4,35,64,89,106,111,112,112,112,112,112,111,98,74,46,
+  16,0,0,0,25,52,76,96,106,110,112,112,108,98,81,64,45,20,0,0,0,0,0,0,5,18,24,24,32,58,84,103,
+  110,98,74,46,16,0,0,0,0,25,53,78,98,107,111,112,111,106,93,76,56,34,11,0,0,0,0,0,20,45,65,84,
+  101,110,112,110,103,87,68,48,23,0,0,0,0,0,8,38,67,92,108,110,95,71,42,12,0,0,0,0,0,0,0,2,
+  29,53,73,90,105,111,112,110,104,88,70,50,26,0,0,0,0,3,33,62,87,104,110,112,111,105,90,73,53,29,5,0,
+  0,0,0,0,4,35,64,90,106,111,95,71,42,12,0,0,0,0,0,0,27,57,83,103,110,98,75,48,30,55,81,101,
+  110,99,77,49,19,0,0,0,30,58,84,103,111,112,112,112,111,105,92,75,56,31,6,0,0,0,0,6,30,53,73,89,
+  104,110,112,110,105,90,65,38,9,0,0,8,38,67,92,108,112,112,112,109,102,87,71,53,30,6,0,0,0,0,0,0,
+  0,17,42,62,75,80,80,80,80,80,80,75,62,42,17,0,0,0,20,45,64,76,80,80,80,80,80,80,79,71,53,30,
+  3,0,0,0,7,31,52,67,75,79,80,80,77,69,55,37,20,0,0,0,0,0,0,0,0,0,0,0,15,39,60,74,
+  79,71,53,30,3,0,0,0,0,9,34,54,69,76,80,80,80,76,66,49,32,11,0,0,0,0,0,0,0,20,40,59,
+  71,79,80,79,72,61,42,24,3,0,0,0,0,0,0,23,48,67,77,79,69,50,27,0,0,0,0,0,0,0,0,0,
+  8,29,46,64,74,79,80,79,73,62,43,26,5,0,0,0,0,0,18,42,62,73,79,80,79,74,64,46,29,8,0,0,
+  0,0,0,0,0,20,45,65,76,79,71,51,27,0,0,0,0,0,0,0,14,39,59,74,79,71,53,30,15,36,58,73,
+  79,71,55,33,7,0,0,0,15,39,60,74,80,80,80,80,79,75,64,48,31,11,0,0,0,0,0,0,8,29,46,62,
+  73,79,80,79,74,64,45,21,0,0,0,0,23,48,67,77,80,80,80,78,72,61,44,28,8,0,0,0,0,0,0,0,
+  0,0,18,34,44,48,48,48,48,48,48,44,34,18,0,0,0,0,0,20,35,45,48,48,48,48,48,48,48,42,28,8,
+  0,0,0,0,0,7,25,37,44,47,48,48,46,40,27,11,0,0,0,0,0,0,0,0,0,0,0,0,0,16,32,43,
+  48,42,28,8,0,0,0,0,0,0,10,27,40,45,48,48,48,44,37,22,5,0,0,0,0,0,0,0,0,0,15,30,
+  41,47,48,47,42,32,17,0,0,0,0,0,0,0,0,3,23,38,46,47,41,26,5,0,0,0,0,0,0,0,0,0,
+  0,2,20,35,43,48,48,47,42,33,18,0,0,0,0,0,0,0,0,18,33,42,47,48,48,43,35,20,2,0,0,0,
+  0,0,0,0,0,0,21,37,45,48,42,27,5,0,0,0,0,0,0,0,0,15,32,43,48,42,28,8,0,13,30,43,
+  48,42,29,11,0,0,0,0,0,16,32,43,48,48,48,48,48,44,35,21,4,0,0,0,0,0,0,0,0,2,19,33,
+  42,47,48,47,43,35,20,0,0,0,0,0,3,23,38,46,48,48,48,46,41,32,17,0,0,0,0,0,0,0,0,0,
+  0,0,0,4,13,16,16,16,16,16,16,13,4,0,0,0,0,0,0,0,6,13,16,16,16,16,16,16,16,12,0,0,
+  0,0,0,0,0,0,0,7,12,16,16,16,14,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,13,
+  16,12,0,0,0,0,0,0,0,0,0,0,9,13,16,16,16,13,7,0,0,0,0,0,0,0,0,0,0,0,0,1,
+  10,15,16,16,11,2,0,0,0,0,0,0,0,0,0,0,0,8,15,16,11,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,5,12,16,16,16,11,3,0,0,0,0,0,0,0,0,0,0,3,11,16,16,16,12,5,0,0,0,0,0,
+  0,0,0,0,0,0,0,7,14,16,12,0,0,0,0,0,0,0,0,0,0,0,3,13,16,12,0,0,0,0,2,13,
+  16,12,0,0,0,0,0,0,0,0,3,13,16,16,16,16,16,12,6,0,0,0,0,0,0,0,0,0,0,0,0,3,
+  11,16,16,16,12,5,0,0,0,0,0,0,0,0,8,14,16,16,16,15,10,2,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,12,16,16,16,16,16,16,16,13,3,0,0,0,0,0,0,0,12,16,16,16,16,16,16,16,14,7,0,
+  0,0,0,0,0,0,0,0,0,0,7,13,16,16,14,9,0,0,0,0,0,0,0,0,0,8,14,16,12,0,0,0,
+  12,16,13,4,0,0,0,0,0,0,0,0,12,16,16,16,16,16,16,16,12,0,0,0,0,0,0,0,0,0,0,0,
+  7,14,16,16,16,16,13,2,0,0,0,0,0,0,0,8,14,16,12,0,0,0,8,15,16,12,0,0,0,0,0,0,
+  0,0,0,12,16,13,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,16,16,12,0,0,2,13,16,16,
+  12,0,0,0,0,0,0,0,0,8,14,16,13,6,0,0,12,16,13,4,0,0,0,0,0,0,0,0,0,2,11,16,
+  16,15,10,0,0,0,0,0,0,0,0,0,0,0,12,16,16,16,16,16,13,7,0,0,0,0,0,0,0,0,0,0,
+  7,14,16,16,16,16,14,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,8,28,42,48,48,48,48,48,48,48,43,32,16,0,0,0,0,5,27,42,48,48,48,48,48,48,48,45,37,22,
+  2,0,0,0,0,0,0,0,6,23,37,44,48,48,46,40,27,11,0,0,0,0,0,3,23,38,46,48,42,27,12,28,
+  42,48,44,34,18,0,0,0,0,0,8,28,42,48,48,48,48,48,48,48,42,27,5,0,0,0,0,0,0,0,0,21,
+  37,45,48,48,48,48,43,30,11,0,0,0,0,3,23,38,46,48,42,27,11,25,38,46,48,42,27,8,0,0,0,0,
+  0,5,27,42,48,45,35,20,0,0,0,0,0,0,0,0,0,0,0,0,8,28,42,48,48,42,28,16,30,43,48,48,
+  42,27,5,0,0,0,0,3,23,38,46,48,45,35,21,27,42,48,44,34,18,0,0,0,0,0,0,0,16,32,42,47,
+  48,47,41,29,12,0,0,0,0,0,0,0,8,28,42,48,48,48,48,48,44,37,23,7,0,0,0,0,0,0,0,21,
+  37,45,48,48,48,48,46,40,29,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,3,30,53,71,79,80,80,80,80,80,80,74,60,39,14,0,0,0,27,51,71,79,80,80,80,80,80,80,77,66,47,
+  22,0,0,0,0,0,0,14,33,50,66,76,80,80,77,69,55,36,13,0,0,0,0,23,48,67,77,79,71,51,34,53,
+  71,79,75,62,42,18,0,0,0,3,30,53,71,79,80,80,80,80,80,79,71,51,27,0,0,0,0,0,0,0,20,45,
+  65,76,80,80,80,80,73,56,33,8,0,0,0,23,48,67,77,79,71,51,33,50,68,77,79,71,53,29,2,0,0,0,
+  0,27,51,71,79,76,64,45,20,0,0,0,0,0,0,0,0,0,0,3,30,53,71,79,79,71,53,40,58,73,80,79,
+  71,51,27,0,0,0,0,23,48,67,77,80,76,64,45,51,71,79,75,62,42,17,0,0,0,0,2,23,41,60,72,79,
+  80,78,71,57,38,18,0,0,0,0,0,3,30,53,71,79,80,80,80,80,76,66,51,33,11,0,0,0,0,0,21,45,
+  65,77,80,80,80,80,77,70,57,39,21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,16,46,74,98,111,112,112,112,112,112,111,103,84,57,27,0,0,12,42,71,95,111,112,112,112,112,112,112,107,92,66,
+  37,7,0,0,0,0,14,36,59,77,94,106,111,112,108,98,81,58,31,4,0,0,8,38,67,92,108,111,95,71,51,73,
+  98,110,104,87,62,33,3,0,0,16,46,74,98,111,112,112,112,112,112,111,95,71,42,12,0,0,0,0,0,4,35,64,
+  90,106,111,112,112,111,100,78,51,22,0,0,8,38,67,92,108,111,95,71,52,71,94,108,111,97,73,43,13,0,0,0,
+  12,42,71,95,111,106,89,64,35,4,0,0,0,0,0,0,0,0,0,16,46,74,98,111,111,98,75,60,81,101,111,111,
+  95,71,42,12,0,0,8,38,67,92,108,111,106,89,64,71,95,110,104,87,60,31,0,0,0,0,22,47,68,86,102,110,
+  112,109,100,83,63,42,18,0,0,0,0,16,46,74,98,111,112,112,112,111,106,94,77,56,34,10,0,0,0,7,37,65,
+  90,107,112,112,112,112,108,99,83,65,45,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,20,52,83,114,139,143,139,139,139,139,137,123,95,63,32,0,0,16,48,79,111,137,143,139,139,139,139,138,130,106,75,
+  43,12,0,0,0,4,32,58,82,103,120,135,140,139,137,125,102,75,46,16,0,0,12,44,75,107,133,137,111,79,57,83,
+  114,137,130,102,71,40,8,0,0,20,52,83,114,136,139,143,143,142,139,135,110,79,48,16,0,0,0,0,0,8,40,71,
+  103,129,138,139,142,141,120,91,59,28,0,0,12,44,75,107,133,137,111,79,71,93,115,135,134,111,79,48,16,0,0,0,
+  16,48,79,111,136,131,103,71,40,8,0,0,0,0,0,0,0,0,0,20,52,83,114,139,140,119,92,75,99,125,141,137,
+  111,79,48,16,0,0,12,44,75,107,133,142,132,106,76,79,111,136,128,99,68,36,4,0,0,8,38,66,92,111,129,139,
+  141,138,126,107,87,62,34,5,0,0,0,20,52,83,114,139,143,139,139,140,135,121,101,79,54,27,0,0,0,12,43,75,
+  106,132,142,140,139,140,138,126,109,90,64,36,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,20,52,84,116,147,142,122,120,120,120,119,106,84,57,27,0,0,16,48,80,112,143,148,124,120,120,120,119,114,94,67,
+  38,8,0,0,0,20,47,75,103,126,143,138,127,123,131,135,113,83,51,20,0,0,12,44,76,108,139,143,112,80,58,84,
+  116,146,135,104,72,40,8,0,0,17,47,76,101,118,122,141,155,133,122,118,100,73,43,13,0,0,0,0,0,5,36,66,
+  92,112,119,122,137,151,124,92,60,28,0,0,12,44,76,108,139,143,112,83,93,114,136,140,119,98,73,43,13,0,0,0,
+  16,48,80,112,143,135,104,72,40,8,0,0,0,0,0,0,0,0,0,20,52,84,116,147,159,133,105,85,110,139,163,143,
+  112,80,48,16,0,0,12,44,76,108,139,164,144,115,86,80,112,142,131,100,68,36,4,0,0,22,50,79,108,134,145,132,
+  125,135,144,130,105,76,46,16,0,0,0,20,52,84,116,147,142,122,121,129,142,143,123,98,69,40,10,0,0,12,44,76,
+  108,139,150,126,120,126,138,146,133,107,78,47,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,20,52,84,116,145,129,101,88,88,88,88,80,62,39,14,0,0,16,48,80,112,143,140,110,89,88,88,88,84,72,50,
+  24,0,0,0,5,35,64,91,117,142,136,113,98,93,103,110,98,74,46,16,0,0,12,44,76,108,139,143,112,80,59,84,
+  116,146,135,104,72,40,8,0,0,5,32,56,77,87,100,129,147,120,94,87,77,56,30,2,0,0,0,0,0,0,22,48,
+  69,83,88,96,122,146,124,92,60,28,0,0,12,44,76,108,139,143,112,95,114,136,140,120,98,76,53,29,2,0,0,0,
+  16,48,80,112,143,135,104,72,40,8,0,0,0,0,0,0,0,0,0,20,52,84,116,146,152,141,112,92,116,146,168,143,
+  112,80,48,16,0,0,12,44,76,108,139,166,152,128,101,84,112,142,131,100,68,36,4,0,4,35,64,93,121,144,130,107,
+  97,111,136,143,116,86,56,27,0,0,0,20,52,84,116,145,129,101,91,102,119,145,139,110,79,47,15,0,0,12,44,76,
+  108,139,144,113,92,98,114,140,145,116,85,54,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,20,52,84,116,144,128,97,81,80,80,80,73,54,31,5,0,0,16,48,80,112,143,139,108,83,80,80,80,74,56,34,
+  9,0,0,0,12,43,74,105,133,144,119,93,71,65,74,79,71,54,32,7,0,0,12,44,76,108,139,143,112,85,80,88,
+  116,146,135,104,72,40,8,0,0,0,11,33,50,66,96,128,147,120,88,61,49,33,11,0,0,0,0,0,0,0,3,24,
+  41,52,61,88,120,145,124,92,60,28,0,0,12,44,76,108,139,143,113,113,135,141,121,100,76,53,31,8,0,0,0,0,
+  16,48,80,112,143,135,104,72,40,8,0,0,0,0,0,0,0,0,0,20,52,84,116,143,131,142,120,104,128,147,160,143,
+  112,80,48,16,0,0,12,44,76,108,139,154,138,138,111,88,112,142,131,100,68,36,4,0,11,42,73,104,133,145,117,88,
+  71,94,122,145,126,97,67,36,5,0,0,20,52,84,116,144,128,96,69,81,111,142,143,112,80,48,16,0,0,12,44,76,
+  108,139,143,112,80,75,102,132,148,119,88,56,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,20,52,84,116,145,134,115,112,112,112,111,98,74,46,16,0,0,16,48,80,112,143,143,118,112,112,112,111,98,74,46,
+  16,0,0,0,16,48,79,111,141,142,111,81,71,79,80,80,77,65,45,20,0,0,12,44,76,108,139,145,119,112,112,113,
+  122,147,135,104,72,40,8,0,0,0,0,8,33,64,96,128,147,120,88,56,26,7,0,0,0,0,0,0,0,0,0,0,
+  12,27,56,88,120,145,124,92,60,28,0,0,12,44,76,108,139,144,120,135,144,122,101,78,56,31,8,0,0,0,0,0,
+  16,48,80,112,143,135,104,72,40,8,0,0,0,0,0,0,0,0,0,20,52,84,116,143,127,135,133,116,137,126,140,143,
+  112,80,48,16,0,0,12,44,76,108,139,145,123,139,121,96,112,142,131,100,68,36,4,0,14,45,77,108,139,143,112,81,
+  59,84,116,146,134,104,73,41,10,0,0,20,52,84,116,144,128,97,83,93,116,144,141,111,79,48,16,0,0,12,44,76,
+  108,139,143,112,86,86,108,136,145,116,85,54,23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,20,52,84,116,147,151,139,137,137,137,135,114,83,52,20,0,0,16,48,80,112,143,155,139,137,137,137,135,113,83,51,
+  20,0,0,0,16,48,80,112,143,139,108,81,95,111,112,112,107,90,64,35,4,0,12,44,76,108,139,155,139,137,137,138,
+  143,156,135,104,72,40,8,0,0,0,0,0,32,64,96,128,147,120,88,56,24,0,0,0,0,0,0,0,0,0,0,0,
+  0,24,56,88,120,145,124,92,60,28,0,0,12,44,76,108,139,155,142,153,140,111,83,60,36,12,0,0,0,0,0,0,
+  16,48,80,112,143,135,104,72,40,8,0,0,0,0,0,0,0,0,0,20,52,84,116,143,124,118,139,126,138,116,132,142,
+  112,80,48,16,0,0,12,44,76,108,139,143,117,135,135,108,112,142,131,100,68,36,4,0,16,48,80,111,142,143,112,80,
+  57,82,113,143,139,108,76,44,12,0,0,20,52,84,116,145,134,115,114,119,136,146,129,103,73,43,12,0,0,12,44,76,
+  108,139,146,120,112,116,127,143,133,107,78,47,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,20,52,84,116,146,139,119,116,116,116,115,101,76,47,17,0,0,16,48,80,112,143,146,121,116,116,116,115,101,75,46,
+  16,0,0,0,16,48,80,112,143,139,108,84,107,133,138,142,131,103,71,40,8,0,12,44,76,108,139,148,123,116,116,118,
+  126,150,135,104,72,40,8,0,0,0,0,0,32,64,96,128,147,120,88,56,24,0,0,0,0,0,0,0,0,0,0,0,
+  0,24,56,88,120,145,124,92,60,28,0,0,12,44,76,108,139,162,150,142,145,122,98,71,45,20,0,0,0,0,0,0,
+  16,48,80,112,143,135,104,72,40,8,0,0,0,0,0,0,0,0,0,20,52,84,116,143,124,112,140,147,135,111,131,142,
+  112,80,48,16,0,0,12,44,76,108,139,143,113,121,139,116,112,142,131,100,68,36,4,0,16,48,80,112,143,143,112,80,
+  56,80,112,143,139,108,76,44,12,0,0,20,52,84,116,147,151,139,138,140,140,130,108,86,61,32,3,0,0,12,44,76,
+  108,139,156,141,138,142,149,132,111,90,65,37,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,20,52,84,116,145,129,100,84,84,84,84,76,56,32,5,0,0,16,48,80,112,143,140,109,86,84,84,84,76,56,31,
+  4,0,0,0,16,48,80,112,143,139,108,81,97,114,123,147,135,104,72,40,8,0,12,44,76,108,139,143,112,87,84,91,
+  116,146,135,104,72,40,8,0,0,0,0,0,32,64,96,128,147,120,88,56,24,0,0,0,0,0,0,0,0,7,19,24,
+  19,25,56,88,120,145,124,92,60,28,0,0,12,44,76,108,139,150,125,118,140,140,115,90,64,37,11,0,0,0,0,0,
+  16,48,80,112,143,135,104,72,40,10,0,0,0,0,0,0,0,0,0,20,52,84,116,143,124,106,129,142,122,105,131,142,
+  112,80,48,16,0,0,12,44,76,108,139,143,112,111,138,131,118,143,131,100,68,36,4,0,16,48,80,111,142,143,112,80,
+  57,82,113,143,139,108,76,44,12,0,0,20,52,84,116,146,139,119,116,116,112,104,87,64,42,17,0,0,0,12,44,76,
+  108,139,149,124,119,126,142,139,113,87,62,34,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,20,52,84,116,144,128,96,65,52,52,52,47,33,13,0,0,0,16,48,80,112,143,139,108,76,54,52,52,47,32,11,
+  0,0,0,0,16,48,79,111,141,142,111,80,73,87,113,143,135,104,72,40,8,0,12,44,76,108,139,143,112,80,60,84,
+  116,146,135,104,72,40,8,0,0,0,0,8,33,64,96,128,147,120,88,56,26,7,0,0,0,0,0,0,11,33,49,55,
+  50,41,59,90,121,145,123,92,60,28,0,0,12,44,76,108,139,144,113,99,122,144,133,107,80,55,29,3,0,0,0,0,
+  16,48,80,112,143,135,104,72,42,32,32,32,26,11,0,0,0,0,0,20,52,84,116,143,124,97,106,117,103,100,131,142,
+  112,80,48,16,0,0,12,44,76,108,139,143,112,102,128,140,123,145,131,100,68,36,4,0,14,45,77,108,139,143,112,81,
+  59,84,116,146,134,104,73,41,10,0,0,20,52,84,116,145,129,100,84,84,81,74,62,42,19,0,0,0,0,12,44,76,
+  108,139,144,113,91,100,120,142,131,105,75,46,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,20,52,84,116,144,128,96,66,56,56,56,52,41,24,2,0,0,16,48,80,112,143,139,108,76,44,22,20,17,5,0,
+  0,0,0,0,12,43,74,105,133,143,118,91,70,80,112,143,135,104,72,40,8,0,12,44,76,108,139,143,112,80,58,84,
+  116,146,135,104,72,40,8,0,0,0,11,33,50,66,96,128,147,120,88,61,49,33,11,0,0,0,0,2,30,56,77,87,
+  80,69,68,95,125,145,120,88,57,26,0,0,12,44,76,108,139,143,112,87,107,133,145,124,100,73,48,22,0,0,0,0,
+  16,48,80,112,143,135,104,74,64,64,64,63,55,36,13,0,0,0,0,20,52,84,116,143,124,92,80,87,80,100,131,142,
+  112,80,48,16,0,0,12,44,76,108,139,143,112,91,115,141,136,151,131,100,68,36,4,0,11,42,73,104,133,145,117,88,
+  71,94,122,145,126,97,67,36,5,0,0,20,52,84,116,144,128,96,65,52,50,43,33,18,0,0,0,0,0,12,44,76,
+  108,139,143,112,80,79,107,134,142,116,89,62,34,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,20,52,84,116,145,129,101,88,88,88,88,83,69,47,21,0,0,16,48,80,112,143,139,108,76,44,12,0,0,0,0,
+  0,0,0,0,5,35,64,91,117,142,134,112,98,96,115,144,135,104,72,40,8,0,12,44,76,108,139,143,112,80,58,84,
+  116,146,135,104,72,40,8,0,0,5,32,56,77,87,100,129,147,120,94,87,77,56,30,2,0,0,0,13,43,73,100,117,
+  109,98,94,110,135,144,116,85,54,22,0,0,12,44,76,108,139,143,112,81,90,115,141,141,116,92,66,38,10,0,0,0,
+  16,48,80,112,143,137,108,96,96,96,96,95,81,58,30,2,0,0,0,20,52,84,116,143,124,92,62,56,69,100,131,142,
+  112,80,48,16,0,0,12,44,76,108,139,143,112,86,106,134,156,161,131,100,68,36,4,0,4,35,64,93,121,144,130,107,
+  97,111,136,143,116,86,56,27,0,0,0,20,52,84,116,144,128,96,64,33,18,13,3,0,0,0,0,0,0,12,44,76,
+  108,139,143,112,80,66,92,118,143,132,105,75,45,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,20,52,84,116,147,142,122,120,120,120,119,112,92,64,35,4,0,16,48,80,112,143,139,108,76,44,12,0,0,0,0,
+  0,0,0,0,0,20,47,75,103,126,142,138,126,125,137,146,131,103,71,40,8,0,12,44,76,108,139,143,112,80,58,84,
+  116,146,135,104,72,40,8,0,0,17,47,76,101,118,122,141,155,133,122,118,100,73,43,13,0,0,0,16,48,79,111,137,
+  137,127,124,134,147,135,109,78,48,17,0,0,12,44,76,108,139,143,112,80,72,99,124,145,135,109,81,53,23,0,0,0,
+  16,48,80,112,143,149,130,128,128,128,128,124,101,73,43,13,0,0,0,20,52,84,116,143,124,92,60,40,68,100,131,142,
+  112,80,48,16,0,0,12,44,76,108,139,143,112,82,92,119,147,161,131,100,68,36,4,0,0,22,51,80,109,135,145,132,
+  125,135,144,130,105,76,46,16,0,0,0,20,52,84,116,144,128,96,64,32,1,0,0,0,0,0,0,0,0,12,44,76,
+  108,139,143,112,80,56,78,109,137,142,115,88,60,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,20,52,83,114,139,143,139,139,139,139,138,128,102,71,40,8,0,16,48,79,111,137,133,107,75,44,12,0,0,0,0,
+  0,0,0,0,0,4,32,58,82,103,120,135,140,140,138,126,109,89,64,35,4,0,12,44,75,107,133,137,111,79,57,83,
+  114,137,130,102,71,40,8,0,0,20,52,83,114,136,139,143,143,142,139,135,110,79,48,16,0,0,0,13,43,73,101,124,
+  137,139,140,140,131,113,93,67,38,8,0,0,12,44,75,107,133,137,111,79,59,80,108,132,138,119,90,59,27,0,0,0,
+  16,48,79,111,137,143,142,141,141,141,141,135,110,79,48,16,0,0,0,20,52,83,114,136,120,91,59,40,68,99,127,136,
+  111,79,48,16,0,0,12,44,75,107,133,136,110,79,80,109,135,142,128,99,68,36,4,0,0,9,39,67,92,111,130,139,
+  141,138,126,107,87,62,34,5,0,0,0,20,52,83,114,137,124,95,64,32,0,0,0,0,0,0,0,0,0,12,43,75,
+  106,132,137,111,79,51,68,95,120,137,125,99,67,36,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,16,46,74,98,111,112,112,112,112,112,111,106,89,64,35,4,0,12,42,71,95,111,108,92,67,38,8,0,0,0,0,
+  0,0,0,0,0,0,14,36,59,78,94,106,111,112,109,100,83,65,45,20,0,0,8,38,67,92,108,111,95,71,51,73,
+  98,110,104,87,62,33,3,0,0,16,46,74,98,111,112,112,112,112,112,111,95,71,42,12,0,0,0,2,30,58,81,98,
+  107,111,112,110,104,88,69,48,23,0,0,0,8,38,67,92,108,111,95,71,47,65,90,106,111,100,78,51,22,0,0,0,
+  12,42,71,95,111,112,112,112,112,112,112,111,95,71,42,12,0,0,0,16,46,74,98,110,100,78,51,35,60,86,103,110,
+  95,71,42,12,0,0,8,38,67,92,107,110,95,69,67,92,109,111,104,87,60,31,0,0,0,0,23,48,68,87,103,110,
+  112,109,100,83,63,42,18,0,0,0,0,16,46,74,98,110,103,83,57,27,0,0,0,0,0,0,0,0,0,7,37,65,
+  90,107,111,95,71,43,51,76,98,110,103,86,60,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,3,30,53,71,79,80,80,80,80,80,80,76,64,45,20,0,0,0,27,51,71,79,77,67,48,23,0,0,0,0,0,
+  0,0,0,0,0,0,0,14,34,51,66,76,80,80,78,71,57,39,20,0,0,0,0,23,48,67,77,79,71,51,34,53,
+  71,79,75,62,42,18,0,0,0,3,30,53,71,79,80,80,80,80,80,79,71,51,27,0,0,0,0,0,13,36,55,69,
+  76,79,80,79,73,62,43,24,3,0,0,0,0,23,48,67,77,79,71,51,31,45,64,76,80,73,56,33,8,0,0,0,
+  0,27,51,71,79,80,80,80,80,80,80,79,71,51,27,0,0,0,0,3,30,53,71,79,72,56,33,20,42,61,74,79,
+  71,51,27,0,0,0,0,23,48,67,76,79,69,50,48,67,78,80,75,62,42,17,0,0,0,0,3,24,42,61,72,79,
+  80,78,71,57,38,18,0,0,0,0,0,3,30,53,71,79,74,59,39,14,0,0,0,0,0,0,0,0,0,0,21,45,
+  65,77,79,71,51,27,31,53,71,79,74,61,42,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,8,28,42,48,48,48,48,48,48,48,45,35,20,0,0,0,0,5,27,42,48,46,38,23,3,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,7,23,37,44,48,48,46,41,29,13,0,0,0,0,0,3,23,38,46,48,42,27,12,28,
+  42,48,44,34,18,0,0,0,0,0,8,28,42,48,48,48,48,48,48,48,42,27,5,0,0,0,0,0,0,11,27,39,
+  44,48,48,47,42,33,18,0,0,0,0,0,0,3,23,38,46,48,42,27,9,20,35,45,48,43,30,11,0,0,0,0,
+  0,5,27,42,48,48,48,48,48,48,48,48,42,27,5,0,0,0,0,0,8,28,42,47,42,30,11,0,17,32,43,48,
+  42,27,5,0,0,0,0,3,23,38,45,47,41,26,23,38,47,48,44,34,18,0,0,0,0,0,0,0,17,32,42,47,
+  48,47,41,29,12,0,0,0,0,0,0,0,8,28,42,48,43,32,15,0,0,0,0,0,0,0,0,0,0,0,0,21,
+  37,45,48,42,27,5,8,28,42,48,43,32,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,12,16,16,16,16,16,16,16,13,6,0,0,0,0,0,0,0,12,16,14,8,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,7,13,16,16,15,10,0,0,0,0,0,0,0,0,0,8,14,16,12,0,0,0,
+  12,16,13,4,0,0,0,0,0,0,0,0,12,16,16,16,16,16,16,16,12,0,0,0,0,0,0,0,0,0,0,8,
+  13,16,16,16,11,3,0,0,0,0,0,0,0,0,0,8,14,16,12,0,0,0,6,13,16,13,2,0,0,0,0,0,
+  0,0,0,12,16,16,16,16,16,16,16,16,12,0,0,0,0,0,0,0,0,0,12,16,12,2,0,0,0,3,13,16,
+  12,0,0,0,0,0,0,0,0,8,14,16,11,0,0,8,15,16,13,4,0,0,0,0,0,0,0,0,0,2,11,16,
+  16,15,10,0,0,0,0,0,0,0,0,0,0,0,12,16,13,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  7,14,16,12,0,0,0,0,12,16,13,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,3,11,16,16,16,13,7,0,0,0,0,0,0,0,0,0,3,13,16,16,16,16,16,16,16,16,16,
+  13,2,0,0,0,0,0,0,0,6,13,16,12,0,0,0,12,16,13,3,0,0,0,0,0,0,0,0,12,16,13,2,
+  0,0,0,4,13,16,12,0,0,0,0,0,0,0,0,11,16,13,8,0,0,0,0,0,12,16,14,7,0,0,0,0,
+  0,0,0,0,11,16,16,11,0,0,0,8,14,16,12,0,0,0,0,0,0,0,0,2,12,16,13,2,0,0,0,6,
+  13,16,12,0,0,0,0,0,0,0,0,2,13,16,16,16,16,16,16,16,16,12,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,10,12,9,0,0,0,0,0,0,0,0,0,0,9,
+  13,16,16,15,10,1,0,0,0,0,0,0,0,0,0,0,0,0,3,11,16,16,15,11,2,0,0,0,0,0,0,0,
+  0,0,0,0,10,15,16,16,12,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,18,33,42,47,48,48,44,37,25,9,0,0,0,0,0,0,18,33,43,48,48,48,48,48,48,48,48,48,
+  43,30,11,0,0,0,0,0,20,35,45,48,42,27,12,28,42,48,43,32,16,0,0,0,0,0,11,29,42,48,43,30,
+  13,0,18,34,44,48,42,28,8,0,0,0,0,5,26,41,47,45,38,23,3,0,5,27,42,48,45,37,22,2,0,0,
+  0,0,5,26,41,47,47,41,26,10,23,38,45,48,42,27,5,0,0,0,0,0,11,30,42,48,43,30,13,2,20,35,
+  45,48,42,28,8,0,0,0,0,0,12,30,43,48,48,48,48,48,48,48,48,42,27,5,0,0,0,0,0,0,0,0,
+  14,27,32,27,14,0,0,0,0,0,0,0,0,0,0,0,17,32,41,44,40,28,11,0,0,0,0,0,0,14,29,40,
+  45,48,48,47,41,30,14,0,0,0,0,0,0,0,0,0,1,18,33,42,47,48,47,42,32,17,0,0,0,0,0,0,
+  0,0,12,29,41,46,48,48,43,33,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,5,27,44,62,73,79,80,79,75,67,53,34,11,0,0,0,0,17,42,62,74,80,80,80,80,80,80,80,80,80,
+  73,56,33,8,0,0,0,20,45,64,76,79,71,51,35,53,71,79,74,60,39,15,0,0,0,7,33,55,71,79,73,58,
+  36,22,42,62,75,79,71,53,30,3,0,0,0,26,50,69,79,76,67,48,23,5,27,51,71,79,76,66,47,22,0,0,
+  0,0,26,50,69,79,79,69,50,31,48,67,76,79,71,51,27,0,0,0,0,7,33,56,72,79,73,58,36,24,45,64,
+  76,79,71,53,30,3,0,0,0,10,36,57,73,80,80,80,80,80,80,80,79,71,51,27,0,0,0,0,0,0,0,16,
+  39,57,63,57,39,17,0,0,0,0,0,0,0,0,0,17,42,61,72,76,70,55,33,8,0,0,0,0,15,39,57,70,
+  76,80,80,78,71,58,39,21,0,0,0,0,0,0,0,8,28,45,62,73,79,80,79,72,61,42,18,0,0,0,0,0,
+  0,21,39,57,71,78,80,79,74,62,43,24,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,27,51,71,88,104,110,112,111,106,96,79,55,29,0,0,0,0,31,60,87,104,111,112,112,112,112,112,112,112,111,
+  100,78,51,22,0,0,4,35,64,89,106,111,95,71,51,74,98,110,103,84,58,30,0,0,0,19,49,77,99,110,101,81,
+  55,38,62,87,104,110,98,74,46,16,0,0,11,41,69,95,110,107,92,67,38,20,42,71,95,111,107,92,66,37,7,0,
+  0,11,41,69,95,110,110,95,69,47,67,92,107,111,95,71,42,12,0,0,0,19,49,77,100,110,101,82,58,40,64,89,
+  106,111,98,74,46,16,0,0,0,23,53,80,101,111,112,112,112,112,112,112,111,95,71,42,12,0,0,0,0,0,10,33,
+  60,84,95,84,62,38,18,12,0,0,0,0,0,0,1,31,60,86,103,107,99,78,51,22,0,0,0,4,32,59,83,100,
+  107,111,112,109,101,84,65,45,20,0,0,0,0,0,3,29,53,72,88,104,110,112,110,103,87,62,34,6,0,0,0,0,
+  21,45,65,83,100,109,112,111,104,87,69,48,23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,17,44,71,95,114,131,140,140,139,136,123,99,71,41,10,0,0,4,36,67,99,125,137,139,139,143,143,142,139,139,137,
+  119,90,59,27,0,0,8,40,71,103,131,136,111,79,58,83,114,137,127,99,67,36,4,0,0,24,56,87,117,137,125,98,
+  69,48,73,104,130,137,114,83,52,20,0,0,16,47,79,110,134,133,107,76,50,48,52,79,111,136,132,106,75,43,12,0,
+  0,16,47,79,109,133,136,112,85,64,82,110,134,134,110,79,48,16,0,0,0,24,56,87,118,137,126,101,73,55,78,107,
+  132,136,114,83,52,20,0,0,0,28,59,91,119,137,139,139,139,139,141,143,137,111,79,48,16,0,0,0,3,23,38,51,
+  77,104,123,107,82,55,48,42,27,5,0,0,0,0,7,39,70,101,128,137,121,92,61,30,0,0,0,13,44,75,103,126,
+  138,139,140,138,127,109,90,64,35,6,0,0,0,0,23,48,73,98,115,131,140,140,138,129,105,77,47,17,0,0,0,9,
+  38,65,90,109,126,138,140,140,131,112,93,67,39,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  1,31,60,87,114,138,142,131,124,126,136,133,107,76,44,12,0,0,0,31,60,87,108,119,120,122,141,156,135,122,120,118,
+  104,81,53,23,0,0,8,40,72,104,135,143,112,80,58,84,116,145,131,100,68,36,4,0,0,21,52,83,114,143,137,107,
+  76,55,80,110,141,141,110,80,48,17,0,0,13,45,76,108,139,142,111,81,75,79,73,82,113,143,133,103,72,41,9,0,
+  0,12,42,71,97,122,143,129,103,80,99,125,143,125,100,73,43,13,0,0,0,20,51,81,110,137,141,114,88,72,95,120,
+  143,131,105,77,47,17,0,0,0,23,53,81,104,119,120,120,120,121,132,154,138,110,79,47,16,0,0,0,23,48,67,78,
+  87,115,140,122,93,80,79,71,51,27,0,0,0,0,8,40,72,104,135,154,127,96,64,32,0,0,0,16,48,79,111,135,
+  134,125,124,134,144,132,106,76,46,15,0,0,0,8,38,67,93,117,139,142,132,124,127,134,114,83,52,20,0,0,0,25,
+  53,80,109,133,142,133,125,130,141,135,110,82,53,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  8,39,70,101,129,143,121,104,93,97,106,110,95,69,40,9,0,0,0,17,42,64,80,88,88,100,129,147,121,95,88,87,
+  78,59,36,10,0,0,8,40,72,104,135,143,112,80,58,84,116,145,131,100,68,36,4,0,0,14,46,77,108,137,142,113,
+  82,61,86,116,144,132,104,73,42,11,0,0,10,41,72,103,134,143,112,91,104,111,101,90,116,143,126,96,65,34,3,0,
+  0,0,27,53,79,107,133,141,117,96,114,140,136,109,81,56,30,2,0,0,0,10,39,68,94,119,142,131,105,85,109,137,
+  141,114,88,62,34,6,0,0,0,10,36,59,79,88,88,88,91,108,136,145,120,95,69,41,11,0,0,8,38,67,92,109,
+  112,122,144,127,113,112,111,95,71,42,12,0,0,0,8,40,71,103,131,140,124,95,64,32,0,0,0,12,42,71,97,111,
+  105,97,96,109,133,143,114,83,52,20,0,0,0,15,46,77,108,135,143,120,104,94,100,107,97,74,46,16,0,0,7,37,
+  67,96,123,143,125,107,97,103,121,142,123,95,66,36,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  12,44,75,107,136,143,113,86,74,71,75,79,71,50,26,0,0,0,0,0,19,37,51,56,66,96,128,147,120,88,61,56,
+  49,35,14,0,0,0,8,40,72,104,135,143,112,80,58,84,116,145,131,100,68,36,4,0,0,8,39,69,98,126,143,119,
+  89,71,96,125,143,120,91,63,33,3,0,0,4,35,66,97,127,143,115,104,130,140,123,100,120,142,119,89,58,27,0,0,
+  0,0,9,36,64,90,116,141,134,115,131,141,117,93,67,39,12,0,0,0,0,0,24,50,77,105,131,142,117,101,122,143,
+  126,101,73,45,18,0,0,0,0,0,14,35,51,56,58,73,98,122,143,130,105,77,51,26,0,0,0,12,44,75,107,131,
+  139,144,158,149,140,139,135,110,79,48,16,0,0,0,4,35,64,89,106,111,103,83,57,27,0,0,0,9,36,62,82,98,
+  109,112,112,114,128,144,118,87,55,24,0,0,0,20,51,83,114,144,136,107,79,64,70,76,69,53,30,3,0,0,12,44,
+  75,106,136,144,120,112,112,112,119,143,134,104,73,41,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  9,41,72,103,132,146,123,109,99,88,80,70,55,36,14,0,0,0,0,0,0,9,20,34,64,96,128,147,120,88,56,29,
+  19,7,0,0,0,0,8,40,72,104,135,143,112,80,58,84,116,145,131,100,68,36,4,0,0,0,27,56,86,116,143,129,
+  101,81,106,136,142,113,82,51,21,0,0,0,0,27,58,89,120,142,118,109,139,158,134,108,125,142,115,84,53,21,0,0,
+  0,0,0,20,46,73,101,126,144,135,144,127,103,75,48,23,0,0,0,0,0,0,6,34,62,88,115,141,136,118,138,138,
+  111,83,57,30,2,0,0,0,0,0,0,9,22,37,62,88,114,139,138,113,87,61,34,7,0,0,0,9,40,69,96,115,
+  121,131,152,138,122,120,118,100,73,43,13,0,0,0,0,20,45,64,76,80,74,59,39,14,0,0,0,25,52,79,104,122,
+  137,139,139,139,147,150,120,88,56,24,0,0,0,20,52,84,116,145,129,99,68,40,40,44,40,27,8,0,0,0,16,47,
+  79,110,141,154,139,137,137,137,138,145,134,106,75,43,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  4,35,64,91,117,140,145,138,128,118,110,97,77,56,30,3,0,0,0,0,0,0,1,32,64,96,128,147,120,88,56,24,
+  0,0,0,0,0,0,8,40,72,104,135,143,112,80,58,84,116,145,131,100,68,36,4,0,0,0,17,48,80,110,140,139,
+  109,87,112,141,136,107,76,45,14,0,0,0,0,22,53,84,116,141,122,113,142,145,139,113,131,142,112,81,49,18,0,0,
+  0,0,0,2,30,58,83,111,140,159,140,111,84,58,32,4,0,0,0,0,0,0,0,18,45,73,101,126,145,141,144,120,
+  95,69,41,13,0,0,0,0,0,0,0,0,26,51,77,105,131,143,120,97,70,43,17,0,0,0,0,0,26,52,74,85,
+  93,117,143,125,97,88,87,77,56,30,2,0,0,0,0,17,42,62,74,79,75,62,42,18,0,0,8,38,68,96,122,143,
+  137,123,120,119,133,148,120,88,56,24,0,0,0,20,52,84,116,145,129,99,68,40,40,44,40,26,7,0,0,0,16,47,
+  79,110,141,146,121,116,116,116,116,116,111,92,66,37,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,20,47,74,98,116,133,142,143,143,139,121,100,74,46,17,0,0,0,0,0,0,0,32,64,96,128,147,120,88,56,24,
+  0,0,0,0,0,0,8,40,72,104,135,143,112,80,58,84,116,145,131,100,68,36,4,0,0,0,11,42,72,103,131,142,
+  114,93,118,142,124,96,67,37,7,0,0,0,0,18,49,81,112,141,130,118,140,126,138,117,136,140,109,78,47,15,0,0,
+  0,0,0,0,28,54,80,109,138,159,137,109,80,53,27,0,0,0,0,0,0,0,0,2,30,58,83,112,140,157,135,107,
+  78,51,26,0,0,0,0,0,0,0,0,16,42,69,95,120,142,131,105,78,53,27,0,0,0,0,0,0,7,30,46,58,
+  84,116,143,124,92,63,56,49,33,11,0,0,0,0,0,31,60,87,104,111,104,87,62,33,3,0,12,44,75,107,137,143,
+  115,96,89,102,129,147,120,88,56,24,0,0,0,20,51,83,114,144,136,107,79,63,70,76,69,52,30,3,0,0,12,44,
+  75,107,137,143,113,91,85,85,87,89,84,70,48,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,3,30,53,73,90,105,112,118,129,144,141,116,87,59,30,0,0,0,0,0,0,0,32,64,96,128,147,120,88,56,24,
+  0,0,0,0,0,0,8,40,72,104,135,143,112,80,58,84,116,145,131,100,68,36,4,0,0,0,2,32,61,90,119,141,
+  121,104,128,142,115,84,54,25,0,0,0,0,0,15,47,79,110,140,144,128,137,119,137,124,143,136,106,75,43,12,0,0,
+  0,0,0,18,44,71,98,122,144,142,144,122,97,70,42,16,0,0,0,0,0,0,0,0,14,41,71,100,129,147,122,94,
+  66,37,8,0,0,0,0,0,0,0,5,32,60,85,112,138,139,113,87,62,34,9,0,0,0,0,0,0,0,4,23,52,
+  84,116,143,124,92,60,31,19,7,0,0,0,0,0,4,36,68,99,128,140,129,102,71,40,8,0,12,44,75,107,137,143,
+  115,97,100,115,140,150,120,88,56,24,0,0,0,15,46,77,108,135,143,120,104,93,99,107,96,74,46,16,0,0,8,38,
+  68,96,123,143,127,108,96,94,104,110,99,77,49,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,22,40,53,66,75,81,88,103,122,145,128,99,68,36,5,0,0,0,0,0,0,32,64,96,128,147,120,88,56,24,
+  0,0,0,0,0,0,8,40,72,104,135,143,112,80,58,84,116,145,129,99,67,36,4,0,0,0,0,20,50,82,113,141,
+  132,113,137,139,109,78,47,16,0,0,0,0,0,12,44,75,106,137,159,150,133,113,136,132,149,130,101,70,38,7,0,0,
+  0,0,7,34,62,88,114,140,138,120,137,138,112,85,60,32,4,0,0,0,0,0,0,0,2,32,64,96,128,147,120,88,
+  56,25,0,0,0,0,0,0,0,0,24,50,76,103,129,142,121,97,71,44,28,19,7,0,0,0,0,0,0,0,20,52,
+  84,116,143,124,92,60,31,18,5,0,0,0,0,0,10,41,72,103,133,153,130,101,70,38,7,0,8,38,68,96,124,144,
+  137,125,127,138,146,149,120,88,56,24,0,0,0,8,38,67,93,117,139,142,131,124,127,134,113,83,51,20,0,0,0,25,
+  53,81,109,133,143,135,126,125,133,136,117,87,55,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,19,45,65,76,80,74,66,69,87,116,144,132,102,71,40,8,0,0,0,0,0,0,32,64,96,128,147,120,88,56,24,
+  0,0,0,0,0,0,8,40,71,103,134,143,114,84,66,88,118,144,126,95,64,32,1,0,0,0,0,13,45,76,106,135,
+  141,121,141,129,101,71,41,10,0,0,0,0,0,8,39,70,101,131,160,151,122,105,130,151,151,123,93,62,31,0,0,0,
+  0,0,26,51,77,105,131,143,120,101,120,142,129,103,75,48,22,0,0,0,0,0,0,0,0,32,64,96,128,147,120,88,
+  56,24,0,0,0,0,0,0,0,11,39,68,94,118,141,131,106,79,61,56,56,49,33,11,0,0,0,0,0,0,20,52,
+  84,116,143,124,92,64,55,48,30,8,0,0,0,0,15,46,78,109,139,146,118,90,62,32,1,0,0,25,54,81,104,125,
+  138,141,138,127,124,137,117,87,55,24,0,0,0,0,23,48,73,98,115,131,140,140,138,130,105,76,46,16,0,0,0,10,
+  38,65,90,109,126,138,140,140,138,128,105,78,49,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  1,32,62,89,106,111,104,94,94,106,125,145,125,96,66,35,4,0,0,0,0,0,0,32,64,96,128,147,120,88,56,24,
+  0,0,0,0,0,0,4,35,66,96,125,144,122,103,93,106,128,144,119,89,58,27,0,0,0,0,0,6,36,66,95,123,
+  144,133,142,118,88,59,30,1,0,0,0,0,0,1,32,63,94,124,153,146,116,95,120,150,148,117,87,55,24,0,0,0,
+  0,14,41,69,95,120,143,131,105,85,107,133,142,117,92,66,38,9,0,0,0,0,0,0,0,32,64,96,128,147,120,88,
+  56,24,0,0,0,0,0,0,0,24,54,82,111,136,142,115,95,88,88,88,87,77,56,32,5,0,0,0,0,0,20,52,
+  84,115,143,129,104,88,87,75,53,29,2,0,0,0,20,51,82,113,142,133,107,78,48,19,0,0,0,10,36,59,81,99,
+  109,112,110,100,99,110,98,75,48,18,0,0,0,0,3,29,53,72,89,104,110,112,110,103,87,62,34,5,0,0,0,0,
+  21,45,65,83,99,108,112,111,108,101,84,61,35,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  4,36,68,99,127,139,133,124,125,133,144,138,113,84,55,26,0,0,0,0,0,0,0,32,64,96,128,147,120,88,56,24,
+  0,0,0,0,0,0,0,26,55,84,113,138,142,129,123,132,144,136,110,80,50,19,0,0,0,0,0,0,24,53,84,114,
+  144,157,141,111,81,50,19,0,0,0,0,0,0,0,25,56,87,118,148,142,112,90,115,145,144,114,83,51,20,0,0,0,
+  0,27,57,85,112,138,140,114,88,70,90,116,142,135,109,80,51,20,0,0,0,0,0,0,0,32,64,96,128,147,120,88,
+  56,24,0,0,0,0,0,0,4,35,65,95,124,151,145,123,120,120,120,120,118,101,76,47,17,0,0,0,0,0,17,48,
+  80,110,138,145,125,120,117,98,73,43,13,0,0,0,23,55,87,116,135,116,90,64,36,7,0,0,0,0,14,36,56,71,
+  78,80,79,71,71,79,71,53,30,5,0,0,0,0,0,8,28,45,62,73,79,80,79,73,62,42,18,0,0,0,0,0,
+  0,21,39,57,70,77,80,80,77,71,59,39,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  1,32,62,89,110,130,138,140,141,139,130,114,95,71,42,13,0,0,0,0,0,0,0,32,63,95,124,138,117,87,55,24,
+  0,0,0,0,0,0,0,13,42,71,95,114,132,139,140,139,130,112,93,67,39,10,0,0,0,0,0,0,16,47,78,109,
+  134,142,130,104,74,43,12,0,0,0,0,0,0,0,20,52,83,114,138,132,106,85,110,136,137,111,79,48,16,0,0,0,
+  0,32,63,95,123,137,123,99,72,52,75,103,127,137,117,87,56,24,0,0,0,0,0,0,0,32,63,95,124,138,117,87,
+  55,24,0,0,0,0,0,0,8,39,71,102,128,142,143,139,139,139,139,139,136,114,83,52,20,0,0,0,0,0,11,41,
+  69,95,117,135,139,139,134,110,79,48,16,0,0,0,18,48,75,98,110,98,73,46,20,0,0,0,0,0,0,12,29,41,
+  47,48,47,41,42,47,42,28,8,0,0,0,0,0,0,0,1,18,33,42,47,48,47,42,33,18,0,0,0,0,0,0,
+  0,0,12,29,40,46,48,48,45,40,30,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,19,45,66,87,102,108,112,112,110,103,87,71,51,27,0,0,0,0,0,0,0,0,26,55,81,101,110,98,75,48,18,
+  0,0,0,0,0,0,0,0,27,51,71,89,104,110,112,109,103,87,69,48,23,0,0,0,0,0,0,0,8,38,67,92,
+  108,111,105,87,62,34,4,0,0,0,0,0,0,0,14,44,73,97,111,107,90,74,95,110,111,95,71,42,12,0,0,0,
+  0,27,57,83,103,110,100,79,55,37,59,84,103,110,99,77,49,19,0,0,0,0,0,0,0,26,55,81,101,110,98,75,
+  48,18,0,0,0,0,0,0,3,33,62,87,104,111,112,112,112,112,112,112,111,98,74,46,16,0,0,0,0,0,0,26,
+  50,73,94,107,111,112,111,95,71,42,12,0,0,0,5,30,53,71,79,71,53,29,2,0,0,0,0,0,0,0,0,10,
+  15,16,15,10,12,16,12,0,0,0,0,0,0,0,0,0,0,0,3,11,16,16,15,11,3,0,0,0,0,0,0,0,
+  0,0,0,0,9,14,16,16,14,9,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,21,42,61,72,77,80,80,79,72,61,44,27,5,0,0,0,0,0,0,0,0,11,36,58,73,79,71,53,30,5,
+  0,0,0,0,0,0,0,0,5,27,45,62,73,79,80,78,72,61,43,24,3,0,0,0,0,0,0,0,0,23,48,67,
+  77,80,75,62,42,18,0,0,0,0,0,0,0,0,2,29,53,71,79,77,65,54,69,79,79,71,51,27,0,0,0,0,
+  0,14,39,59,74,79,72,56,34,19,39,59,74,79,71,55,33,7,0,0,0,0,0,0,0,11,36,58,73,79,71,53,
+  30,5,0,0,0,0,0,0,0,18,42,62,75,80,80,80,80,80,80,80,79,71,53,30,3,0,0,0,0,0,0,5,
+  28,50,67,76,80,80,79,71,51,27,0,0,0,0,0,8,28,42,47,42,28,8,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,17,32,41,46,48,48,47,42,32,17,0,0,0,0,0,0,0,0,0,0,0,13,30,43,48,42,28,8,0,
+  0,0,0,0,0,0,0,0,0,1,19,33,42,47,48,47,41,32,17,0,0,0,0,0,0,0,0,0,0,3,23,38,
+  46,48,44,34,18,0,0,0,0,0,0,0,0,0,0,8,27,42,48,45,37,28,41,47,48,42,27,5,0,0,0,0,
+  0,0,15,32,43,48,42,30,11,0,15,32,43,48,42,29,11,0,0,0,0,0,0,0,0,0,13,30,43,48,42,28,
+  8,0,0,0,0,0,0,0,0,0,18,34,44,48,48,48,48,48,48,48,48,42,28,8,0,0,0,0,0,0,0,0,
+  5,24,38,45,48,48,48,42,27,5,0,0,0,0,0,0,0,12,16,12,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,2,10,14,16,16,15,11,2,0,0,0,0,0,0,0,0,0,0,0,0,0,2,13,16,12,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,3,11,15,16,15,10,2,0,0,0,0,0,0,0,0,0,0,0,0,0,8,
+  15,16,13,4,0,0,0,0,0,0,0,0,0,0,0,0,0,12,16,14,7,0,11,16,16,12,0,0,0,0,0,0,
+  0,0,0,3,13,16,12,2,0,0,0,3,13,16,12,0,0,0,0,0,0,0,0,0,0,0,0,2,13,16,12,0,
+  0,0,0,0,0,0,0,0,0,0,0,4,13,16,16,16,16,16,16,16,16,12,0,0,0,0,0,0,0,0,0,0,
+  0,0,8,14,16,16,16,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,12,16,13,15,16,12,12,16,14,8,0,0,0,0,0,0,0,0,0,12,16,12,11,16,16,13,6,0,
+  0,0,0,0,0,0,0,0,0,0,3,11,16,16,15,10,1,0,0,0,0,0,0,0,0,0,8,12,12,9,12,16,
+  16,14,8,0,0,0,0,0,0,0,0,0,0,2,11,15,16,16,13,7,0,0,0,0,0,0,0,0,0,0,12,16,
+  12,0,0,2,12,16,12,0,0,0,0,0,0,0,0,0,11,16,13,7,0,0,0,8,12,12,8,0,0,0,0,0,
+  0,0,8,12,11,6,0,0,0,0,0,8,12,12,7,0,0,0,0,0,0,0,0,4,13,16,12,0,0,0,12,16,
+  13,2,0,0,0,0,0,0,0,0,0,12,16,16,16,16,16,16,16,12,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,12,16,12,0,0,0,0,0,0,0,0,0,0,0,0,6,13,16,13,3,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,6,8,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,5,27,42,48,44,46,48,42,42,48,46,38,25,5,0,0,0,0,0,8,28,42,47,42,42,47,48,44,35,20,
+  0,0,0,0,0,0,0,0,0,18,33,42,47,48,47,41,30,15,0,0,0,0,0,0,3,23,38,44,44,39,43,48,
+  48,45,38,23,3,0,0,0,0,0,0,0,17,32,42,47,48,48,44,37,23,5,0,0,0,0,0,0,8,28,42,47,
+  42,29,16,30,42,47,42,28,8,0,0,0,0,0,5,26,41,47,44,37,21,7,23,38,44,44,38,23,3,0,0,0,
+  3,23,38,44,43,35,20,0,0,3,23,38,44,43,37,21,0,0,0,0,0,0,18,34,44,48,42,28,15,29,42,48,
+  43,30,13,0,0,0,0,0,0,5,27,42,48,48,48,48,48,48,48,42,28,8,0,0,0,0,0,0,0,0,0,11,
+  29,42,47,42,28,8,0,0,0,0,0,0,0,0,0,20,35,45,48,43,32,15,0,0,0,0,0,0,0,0,0,0,
+  0,0,3,12,25,37,40,36,22,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,27,51,71,79,75,78,79,71,72,79,77,68,50,27,1,0,0,0,5,30,53,71,79,71,72,79,80,75,64,45,
+  24,2,0,0,0,0,0,3,24,43,62,73,79,80,79,71,59,40,20,0,0,0,0,0,23,48,67,75,75,70,74,79,
+  80,76,67,48,23,0,0,0,0,0,0,21,42,61,72,79,80,79,75,66,50,27,0,0,0,0,0,5,30,53,71,79,
+  71,55,39,56,72,79,71,53,30,3,0,0,0,0,26,50,69,79,76,65,45,29,48,67,75,75,67,48,23,0,0,0,
+  23,48,67,75,75,64,45,20,2,23,48,67,75,75,65,45,20,0,0,0,0,17,42,62,75,79,71,53,38,55,71,79,
+  73,58,36,10,0,0,0,0,0,27,51,71,79,80,80,80,80,80,79,71,53,29,2,0,0,0,0,0,0,0,7,33,
+  55,71,79,71,53,29,2,0,0,0,0,0,0,0,20,45,64,76,80,74,59,39,14,0,0,0,0,0,0,0,0,0,
+  8,18,32,43,52,67,72,66,47,23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,12,42,71,95,110,105,109,111,99,101,111,108,95,71,45,20,0,0,0,18,48,75,98,110,100,102,110,111,106,90,68,
+  47,22,0,0,0,0,0,23,48,69,87,104,110,112,110,101,84,65,45,20,0,0,0,8,38,67,92,107,107,97,105,111,
+  111,107,92,67,38,8,0,0,0,0,21,45,66,87,103,110,112,111,106,94,71,43,14,0,0,0,0,18,48,75,98,110,
+  99,77,58,78,100,110,98,74,46,16,0,0,0,11,41,69,95,110,106,90,65,46,69,93,107,107,92,67,38,8,0,8,
+  38,67,92,107,105,89,64,36,19,39,67,92,107,106,90,64,35,4,0,0,0,31,60,87,104,110,98,74,59,79,99,110,
+  101,81,53,23,0,0,0,0,12,42,71,95,111,112,112,112,112,112,111,98,73,44,14,0,0,0,0,0,0,0,19,49,
+  77,99,110,98,73,44,14,0,0,0,0,0,0,4,35,64,89,106,111,103,83,57,27,0,0,0,0,0,0,4,13,27,
+  39,48,61,73,82,95,103,92,67,38,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,16,48,79,111,136,134,137,140,126,128,139,136,114,90,64,35,5,0,0,24,55,87,117,137,125,129,138,141,133,113,92,
+  66,37,7,0,0,0,10,39,67,93,112,131,140,141,139,128,109,89,64,36,7,0,0,12,44,75,107,133,135,119,132,139,
+  140,133,107,75,44,12,0,0,0,7,37,65,90,110,130,139,140,139,135,114,86,57,27,0,0,0,0,24,55,87,117,136,
+  118,87,65,91,120,136,114,83,52,20,0,0,0,16,47,79,109,134,132,107,77,55,80,110,134,132,106,75,44,12,0,12,
+  44,75,107,133,132,105,75,49,48,51,79,109,134,131,103,71,40,8,0,0,4,36,67,99,125,136,118,95,78,100,123,136,
+  120,91,59,28,0,0,0,0,16,47,79,110,134,139,139,139,139,143,138,114,83,51,20,0,0,0,0,0,2,13,26,56,
+  87,118,135,114,83,51,23,12,0,0,0,0,0,8,40,71,103,131,140,124,95,64,32,0,0,0,0,0,18,34,44,54,
+  69,78,88,103,112,122,131,107,75,44,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,16,48,80,112,143,146,129,144,151,140,129,145,133,105,74,43,11,0,0,24,56,88,120,149,146,136,126,132,146,134,108,
+  77,46,15,0,0,0,23,52,81,110,136,145,133,126,135,145,132,107,78,48,17,0,0,12,44,76,108,139,155,140,135,126,
+  127,131,107,75,44,12,0,0,0,14,45,76,106,133,145,132,124,127,134,122,95,63,32,0,0,0,0,24,56,88,120,143,
+  120,88,66,92,124,143,116,84,52,20,0,0,0,12,43,74,104,132,142,114,84,65,89,118,142,125,98,69,39,8,0,11,
+  43,74,105,135,141,111,80,73,79,73,83,114,141,128,99,69,38,6,0,0,0,31,60,87,113,137,137,113,96,117,140,134,
+  109,82,53,23,0,0,0,0,12,42,71,99,118,120,120,120,126,150,141,111,80,49,18,0,0,0,0,8,29,43,48,58,
+  88,120,141,116,84,55,48,42,28,8,0,0,0,8,40,72,104,135,154,127,96,64,32,0,0,0,0,19,42,62,75,83,
+  97,109,117,130,139,140,134,107,75,44,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,16,48,80,112,142,131,109,125,144,122,109,134,139,109,78,47,15,0,0,24,56,88,120,150,139,113,98,109,135,143,114,
+  83,51,19,0,0,4,35,65,94,122,144,127,107,97,110,134,144,117,87,57,27,0,0,12,44,76,108,139,153,129,109,97,
+  98,103,92,67,38,8,0,0,0,16,48,80,111,142,137,110,95,98,104,100,83,57,27,0,0,0,0,24,56,88,120,143,
+  120,88,66,92,124,143,116,84,52,20,0,0,0,3,33,62,90,118,141,124,96,78,103,130,141,114,84,55,27,0,0,5,
+  36,66,95,124,141,114,89,101,111,98,91,119,141,118,88,58,28,0,0,0,0,17,43,69,95,118,140,132,117,136,138,114,
+  90,65,38,11,0,0,0,0,0,29,55,77,87,88,90,104,128,145,124,100,73,43,13,0,0,0,3,30,53,73,80,80,
+  90,120,141,116,88,80,79,71,53,28,0,0,0,7,39,70,101,128,137,121,92,61,30,0,0,0,7,36,63,87,104,113,
+  124,137,140,139,130,117,109,92,67,38,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,16,48,80,112,141,125,99,120,141,116,102,130,142,112,80,48,16,0,0,24,56,88,120,146,127,98,75,95,125,143,116,
+  84,52,20,0,0,10,41,72,103,133,143,115,86,70,91,119,144,126,97,66,34,3,0,12,44,76,108,139,144,115,87,67,
+  68,72,66,47,23,0,0,0,0,16,48,79,111,140,141,117,109,102,91,81,66,44,19,0,0,0,0,24,56,88,120,143,
+  120,88,66,92,124,143,116,84,52,20,0,0,0,0,20,49,80,111,140,137,108,87,111,140,136,107,77,46,15,0,0,0,
+  25,55,86,116,140,120,101,124,138,117,102,128,141,113,82,50,19,0,0,0,0,0,26,51,75,101,125,145,141,142,120,97,
+  71,45,21,0,0,0,0,0,0,11,33,50,59,74,98,121,142,131,106,80,56,30,2,0,0,0,16,46,74,98,111,112,
+  114,127,143,122,113,112,111,97,71,42,12,0,0,1,31,60,86,103,107,99,78,51,22,0,0,0,17,47,78,107,131,142,
+  142,135,120,112,103,88,79,67,48,23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,16,48,80,112,140,124,98,120,141,116,99,128,141,112,80,48,16,0,0,24,56,88,120,144,121,90,67,92,124,143,116,
+  84,52,20,0,0,12,44,76,108,139,143,112,80,58,84,116,145,131,100,68,36,4,0,12,44,76,108,139,141,110,79,48,
+  38,40,36,22,2,0,0,0,0,12,42,71,99,123,140,140,138,131,118,104,84,59,31,2,0,0,0,24,56,88,120,143,
+  120,88,66,92,124,143,116,84,52,20,0,0,0,0,11,42,72,102,130,142,115,95,119,142,123,95,67,37,7,0,0,0,
+  18,49,81,112,141,130,112,136,149,129,112,137,139,109,78,46,15,0,0,0,0,0,7,32,57,82,110,140,159,134,106,78,
+  54,28,2,0,0,0,0,0,0,0,21,45,69,93,117,139,135,111,87,62,36,11,0,0,0,0,20,51,83,113,135,137,
+  139,147,156,143,138,137,134,110,79,48,16,0,0,0,21,47,68,80,84,78,61,39,12,0,0,0,20,52,83,115,142,151,
+  128,117,105,92,83,72,59,48,31,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,16,48,80,112,140,124,98,120,141,116,99,128,141,112,80,48,16,0,0,24,56,88,120,143,120,88,66,92,124,143,116,
+  84,52,20,0,0,12,44,76,108,139,143,112,80,58,84,116,145,131,100,68,36,4,0,12,44,76,108,139,139,108,76,44,
+  15,8,5,0,0,0,0,0,0,0,29,55,79,100,114,122,133,141,143,128,102,72,42,12,0,0,0,24,56,88,119,143,
+  120,88,67,92,124,143,116,84,52,20,0,0,0,0,2,32,60,88,117,141,125,108,131,141,113,83,53,25,0,0,0,0,
+  14,45,76,107,137,138,118,138,131,136,118,140,131,102,72,41,10,0,0,0,0,0,14,39,65,90,115,142,151,139,112,87,
+  61,35,9,0,0,0,0,0,0,13,38,64,89,113,136,138,115,93,68,43,20,0,0,0,0,0,16,46,75,101,115,116,
+  118,131,147,126,118,116,114,98,73,43,13,0,0,1,31,60,86,103,107,99,78,51,22,0,0,0,17,47,76,103,124,138,
+  140,138,128,116,108,96,83,71,51,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,16,48,80,112,140,124,98,120,141,116,99,128,141,112,80,48,16,0,0,24,56,88,120,143,120,88,66,92,124,143,116,
+  84,52,20,0,0,10,41,72,103,133,143,115,86,70,91,119,144,126,97,66,34,3,0,12,44,76,108,139,139,108,76,44,
+  12,0,0,0,0,0,0,0,0,0,27,51,72,84,87,93,104,116,141,141,111,79,48,16,0,0,0,22,53,84,116,142,
+  123,94,76,101,129,144,116,84,52,20,0,0,0,0,0,18,48,79,110,139,138,118,140,134,106,76,45,14,0,0,0,0,
+  7,38,69,99,128,143,125,135,120,137,125,141,120,91,62,32,2,0,0,0,0,6,32,58,83,109,134,142,128,142,130,105,
+  79,54,29,3,0,0,0,0,4,31,58,82,107,132,140,119,97,73,59,49,33,11,0,0,0,0,4,31,56,76,84,84,
+  93,121,142,116,90,84,83,74,53,29,2,0,0,7,39,70,101,128,137,121,92,61,30,0,0,0,5,33,58,80,98,109,
+  117,130,140,140,137,124,112,95,71,42,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,16,48,80,112,140,124,98,120,141,116,99,128,141,112,80,48,16,0,0,24,56,88,120,143,120,88,66,92,124,143,116,
+  84,52,20,0,0,4,35,65,94,122,144,127,107,97,110,134,144,117,87,57,27,0,0,12,44,76,108,139,139,108,76,44,
+  12,0,0,0,0,0,0,0,0,12,42,71,95,110,105,95,96,112,138,142,111,80,48,16,0,0,0,20,52,83,115,143,
+  133,108,99,114,140,147,116,84,52,20,0,0,0,0,0,10,41,71,100,128,145,130,142,121,93,64,35,6,0,0,0,0,
+  0,28,58,88,118,146,144,130,112,136,145,143,114,83,52,21,0,0,0,0,0,27,51,76,103,127,142,122,108,127,142,122,
+  98,73,48,23,0,0,0,0,15,45,74,102,126,144,126,103,90,88,87,77,56,30,2,0,0,0,0,11,32,47,52,59,
+  88,120,141,116,84,57,52,46,30,8,0,0,0,8,40,72,104,135,154,127,96,64,32,0,0,0,0,14,35,54,69,79,
+  88,103,113,123,137,140,135,110,79,48,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,16,48,80,112,140,124,98,120,141,116,99,128,141,112,80,48,16,0,0,24,56,88,120,143,120,88,66,92,124,143,116,
+  84,52,20,0,0,0,23,52,81,110,136,145,133,125,135,145,132,107,78,48,17,0,0,12,44,76,108,139,139,108,76,44,
+  12,0,0,0,0,0,0,0,0,16,48,79,111,135,134,125,125,135,144,131,104,75,44,13,0,0,0,16,47,78,109,136,
+  146,133,128,137,148,147,116,84,52,20,0,0,0,0,0,0,29,57,86,116,145,154,142,112,82,51,22,0,0,0,0,0,
+  0,20,51,82,113,144,148,118,101,125,152,141,110,79,48,16,0,0,0,0,12,42,71,96,119,141,131,106,88,111,136,140,
+  117,93,67,38,8,0,0,0,20,51,83,114,143,151,126,120,120,120,118,100,73,43,13,0,0,0,0,0,5,17,27,56,
+  87,118,135,114,83,51,25,16,3,0,0,0,0,8,40,71,103,131,140,124,95,64,32,0,0,0,0,0,10,27,40,48,
+  61,74,83,96,108,116,124,103,74,43,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,16,48,79,111,135,120,97,117,135,114,98,124,135,111,79,48,16,0,0,24,55,87,117,136,118,87,65,91,120,136,114,
+  83,52,20,0,0,0,10,39,67,93,112,131,140,141,139,128,109,89,64,36,7,0,0,12,44,75,107,133,133,107,75,44,
+  12,0,0,0,0,0,0,0,0,13,44,75,103,127,138,140,140,137,125,107,87,62,34,4,0,0,0,8,38,67,93,115,
+  134,141,138,127,125,136,114,83,52,20,0,0,0,0,0,0,16,47,78,109,134,142,130,104,75,44,13,0,0,0,0,0,
+  0,15,46,77,108,134,137,112,91,115,138,130,104,73,42,11,0,0,0,0,16,47,79,109,132,134,112,87,72,93,116,136,
+  130,106,75,44,12,0,0,0,20,52,83,114,139,143,139,139,139,139,135,111,79,48,16,0,0,0,0,0,0,0,19,49,
+  77,99,110,98,73,44,14,0,0,0,0,0,0,4,35,64,89,106,111,103,83,57,27,0,0,0,0,0,0,0,9,18,
+  32,43,53,68,78,87,95,84,60,32,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,12,42,71,95,110,100,83,98,110,98,86,102,110,95,71,42,12,0,0,18,48,75,98,110,99,77,58,78,100,110,98,
+  74,46,16,0,0,0,0,23,48,69,87,104,110,112,110,101,84,65,45,20,0,0,0,8,38,67,92,107,107,92,67,38,
+  8,0,0,0,0,0,0,0,0,4,32,60,84,101,108,112,112,108,99,82,63,42,18,0,0,0,0,0,23,48,70,92,
+  106,111,110,100,100,110,98,74,46,16,0,0,0,0,0,0,8,38,67,92,108,111,104,87,62,34,4,0,0,0,0,0,
+  0,8,38,67,92,108,111,95,79,98,111,105,87,62,33,3,0,0,0,0,11,41,69,95,107,107,93,69,52,72,96,111,
+  107,92,67,38,8,0,0,0,16,46,74,98,111,112,112,112,112,112,111,98,73,43,13,0,0,0,0,0,0,0,7,33,
+  55,71,79,71,53,29,2,0,0,0,0,0,0,0,20,45,64,76,80,74,59,39,14,0,0,0,0,0,0,0,0,0,
+  3,13,25,38,47,58,63,57,39,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,27,51,71,79,73,60,71,79,71,61,72,79,71,51,27,0,0,0,5,30,53,71,79,71,55,39,56,72,79,71,
+  53,30,3,0,0,0,0,3,24,43,62,73,79,80,79,71,59,40,20,0,0,0,0,0,23,48,67,75,75,67,48,23,
+  0,0,0,0,0,0,0,0,0,0,16,39,59,71,77,80,80,77,70,56,37,19,0,0,0,0,0,0,3,25,48,66,
+  76,80,79,71,72,79,71,53,30,3,0,0,0,0,0,0,0,23,48,67,77,80,75,62,42,18,0,0,0,0,0,0,
+  0,0,23,48,67,77,79,71,57,71,79,75,62,42,18,0,0,0,0,0,0,26,50,69,76,75,67,48,32,51,71,79,
+  76,67,48,23,0,0,0,0,3,30,53,71,79,80,80,80,80,80,79,71,53,29,2,0,0,0,0,0,0,0,0,11,
+  29,42,47,42,28,8,0,0,0,0,0,0,0,0,0,20,35,45,48,43,32,15,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,8,17,28,32,27,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,5,27,42,48,43,33,42,47,42,33,42,47,42,27,5,0,0,0,0,8,28,42,47,42,29,16,30,42,47,42,
+  28,8,0,0,0,0,0,0,0,18,33,42,47,48,47,41,30,15,0,0,0,0,0,0,3,23,38,44,44,38,23,3,
+  0,0,0,0,0,0,0,0,0,0,0,15,30,41,46,48,48,46,40,28,12,0,0,0,0,0,0,0,0,3,22,37,
+  44,48,47,41,42,47,42,28,8,0,0,0,0,0,0,0,0,3,23,38,46,48,44,34,18,0,0,0,0,0,0,0,
+  0,0,3,23,38,46,48,42,32,42,48,44,34,18,0,0,0,0,0,0,0,5,26,40,44,44,38,23,10,27,42,48,
+  45,38,23,3,0,0,0,0,0,8,28,42,48,48,48,48,48,48,48,42,28,8,0,0,0,0,0,0,0,0,0,0,
+  0,12,16,12,0,0,0,0,0,0,0,0,0,0,0,0,6,13,16,13,3,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,12,16,13,5,12,16,12,4,12,16,12,0,0,0,0,0,0,0,0,12,16,12,0,0,2,12,16,12,
+  0,0,0,0,0,0,0,0,0,0,3,11,16,16,15,10,1,0,0,0,0,0,0,0,0,0,8,12,12,8,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,1,10,14,16,16,14,9,0,0,0,0,0,0,0,0,0,0,0,0,7,
+  13,16,16,11,12,16,12,0,0,0,0,0,0,0,0,0,0,0,0,8,15,16,13,4,0,0,0,0,0,0,0,0,
+  0,0,0,0,8,14,16,12,4,12,16,13,4,0,0,0,0,0,0,0,0,0,0,9,12,12,8,0,0,0,12,16,
+  14,8,0,0,0,0,0,0,0,0,0,12,16,16,16,16,16,16,16,12,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,4,8,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,12,9,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,16,
+  13,6,11,12,8,0,0,0,0,0,0,0,0,12,16,12,0,0,0,0,0,0,0,0,0,3,13,16,13,4,0,0,
+  0,0,0,0,0,0,0,0,0,7,14,16,13,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,2,10,12,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,2,21,35,40,35,21,11,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,26,40,44,40,26,5,
+  0,0,0,0,0,0,0,0,0,2,13,16,16,16,16,16,16,16,16,16,12,0,0,0,0,0,0,0,5,27,42,48,
+  43,36,43,44,38,23,3,0,0,0,0,11,29,42,47,42,28,8,0,0,0,0,0,0,18,33,43,48,44,34,18,0,
+  0,0,0,0,0,0,0,0,21,37,45,48,44,34,18,0,0,0,0,0,0,0,0,0,0,10,23,28,23,12,0,0,
+  0,0,0,0,0,0,0,0,3,12,16,16,16,12,3,0,5,8,5,0,0,0,0,0,0,0,0,11,16,16,16,16,
+  15,7,0,0,0,0,0,0,17,32,41,44,40,28,11,0,0,0,0,0,0,12,16,16,16,16,16,16,16,16,16,16,
+  16,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,23,47,64,71,64,50,41,30,16,7,0,0,0,0,0,0,0,0,0,0,0,0,12,27,50,69,76,69,50,26,
+  12,0,0,0,0,0,0,0,8,29,43,48,48,48,48,48,48,48,48,48,42,28,8,0,0,0,0,0,27,51,71,79,
+  73,65,74,75,67,48,23,0,0,0,7,33,55,71,79,71,53,30,3,0,0,0,0,17,42,62,74,79,75,62,42,18,
+  0,0,0,0,0,0,0,21,45,65,76,80,75,62,42,18,0,0,0,0,0,0,0,0,12,36,53,59,53,42,27,5,
+  0,0,0,0,0,0,0,17,32,43,48,48,48,43,33,25,36,40,36,22,2,0,0,0,0,5,26,41,47,48,48,48,
+  46,37,21,0,0,0,0,17,42,61,72,76,70,55,33,8,0,0,0,5,27,42,48,48,48,48,48,48,48,48,48,48,
+  47,41,24,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,8,38,67,91,102,92,80,71,58,46,37,23,12,2,0,0,0,0,0,0,0,8,28,42,50,71,95,107,95,69,49,
+  42,27,5,0,0,0,0,3,30,53,73,80,80,80,80,80,80,80,80,79,71,53,28,0,0,0,0,12,42,71,95,110,
+  101,92,105,107,92,67,38,8,0,0,19,49,77,99,110,98,74,46,16,0,0,0,0,31,60,87,104,111,104,87,62,33,
+  3,0,0,0,0,0,16,40,66,90,106,111,104,87,62,36,11,0,0,0,0,0,0,0,29,57,80,91,83,71,50,26,
+  0,0,0,0,0,0,18,42,61,73,79,80,79,74,63,54,66,72,66,47,23,0,0,0,0,26,50,69,79,80,80,80,
+  77,65,45,20,0,0,1,31,60,86,103,107,99,78,51,22,0,0,0,27,51,71,79,80,80,80,80,80,80,80,80,80,
+  79,69,48,23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,15,47,78,109,129,120,111,101,86,77,66,52,42,32,16,0,0,0,0,0,2,29,53,71,79,83,111,132,110,83,79,
+  71,50,26,0,0,0,0,16,46,74,98,111,112,112,112,112,112,112,112,111,97,71,42,12,0,0,0,16,48,79,111,135,
+  124,107,130,133,107,75,44,12,0,0,24,56,87,118,136,114,83,52,20,0,0,0,4,36,68,99,128,140,129,102,71,40,
+  8,0,0,0,0,11,35,61,85,110,133,141,130,106,80,56,32,8,0,0,0,0,0,7,38,69,99,120,112,95,69,43,
+  18,0,0,0,0,3,33,62,87,103,111,112,111,104,91,84,94,103,92,67,38,8,0,0,9,40,69,95,110,112,112,112,
+  107,90,64,35,4,0,7,39,70,101,128,137,121,92,61,30,0,0,12,42,71,95,111,112,112,112,112,112,112,112,112,112,
+  110,93,67,38,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,16,48,79,111,136,140,139,128,115,107,94,81,73,60,39,16,0,0,0,0,13,43,73,98,110,104,112,135,112,106,111,
+  95,69,40,9,0,0,0,20,51,83,113,135,137,137,137,137,137,137,137,134,110,79,48,16,0,0,0,16,48,80,112,141,
+  128,108,135,139,108,76,44,12,0,0,24,56,88,120,141,116,84,52,20,0,0,0,10,41,72,103,133,153,130,101,70,38,
+  7,0,0,0,6,31,56,80,105,129,144,140,144,124,101,76,53,27,3,0,0,0,0,8,40,71,103,131,136,112,87,62,
+  34,6,0,0,0,13,43,74,104,129,138,139,139,132,120,116,120,130,107,75,44,12,0,0,12,44,76,107,132,137,137,137,
+  128,102,71,40,8,0,8,40,72,104,135,154,127,96,64,32,0,0,16,47,79,110,133,137,137,137,137,137,137,137,137,137,
+  132,107,75,44,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,12,42,71,95,111,119,133,140,140,135,121,112,102,84,60,32,4,0,0,0,16,48,79,110,131,128,120,137,120,129,130,
+  107,75,44,12,0,0,0,16,46,75,101,115,116,116,116,116,116,116,116,114,98,73,43,13,0,0,0,16,48,80,112,141,
+  128,108,135,139,108,76,44,12,0,0,24,56,88,120,141,116,84,52,20,0,0,0,15,46,78,109,139,146,118,90,62,32,
+  1,0,0,0,27,51,75,100,124,141,127,114,132,140,119,97,72,48,23,0,0,0,0,4,35,64,90,114,136,131,105,77,
+  47,17,0,0,0,16,48,79,110,132,123,120,126,137,139,139,138,131,104,73,42,11,0,0,9,40,69,95,114,116,116,116,
+  110,91,64,35,4,0,8,40,71,103,131,140,124,95,64,32,0,0,12,42,71,98,114,116,116,116,116,116,116,116,116,116,
+  114,95,69,40,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,27,50,69,80,91,105,113,123,137,143,141,128,103,75,44,13,0,0,0,12,42,71,95,110,125,144,154,141,119,108,
+  92,67,38,8,0,0,0,7,35,60,81,90,90,90,90,90,90,90,90,89,80,59,33,5,0,0,0,16,48,80,112,141,
+  128,108,135,139,108,76,44,12,0,0,24,56,88,120,141,116,84,52,20,0,0,0,21,52,83,114,142,133,107,78,48,19,
+  0,0,0,12,42,71,96,118,139,129,106,91,110,133,137,115,93,67,38,8,0,0,0,0,20,45,70,95,117,133,114,83,
+  52,20,0,0,0,12,42,71,94,106,96,88,98,109,114,116,114,106,89,64,35,4,0,0,0,26,50,72,83,84,84,84,
+  80,67,47,21,0,0,4,35,64,89,106,111,103,83,57,27,0,0,0,28,53,74,83,84,84,84,84,84,84,84,84,84,
+  83,72,50,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,13,34,50,61,75,85,93,107,118,133,154,140,111,80,48,16,0,0,0,12,42,71,95,109,125,144,154,141,119,107,
+  92,67,38,8,0,0,0,16,46,74,98,111,112,112,112,112,112,112,112,111,97,71,42,12,0,0,0,16,48,79,111,135,
+  124,107,130,133,107,75,44,12,0,0,24,56,87,118,136,114,83,52,20,0,0,0,24,56,87,117,135,116,90,64,36,7,
+  0,0,0,16,47,79,109,132,130,108,84,70,90,112,133,130,106,75,44,12,0,0,0,0,0,26,50,73,96,110,98,74,
+  46,16,0,0,0,0,27,50,67,75,68,58,69,78,83,84,83,76,64,45,20,0,0,0,0,5,27,44,51,52,52,52,
+  49,39,23,2,0,0,0,20,45,64,76,80,74,59,39,14,0,0,0,8,30,46,52,52,52,52,52,52,52,52,52,52,
+  51,44,27,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,3,30,53,73,85,99,110,117,130,139,140,136,121,100,73,43,13,0,0,0,16,48,79,110,131,128,120,137,120,129,130,
+  107,75,44,12,0,0,0,20,51,83,113,135,137,137,137,137,137,137,137,134,110,79,48,16,0,0,0,12,42,71,95,110,
+  101,92,105,107,92,67,38,8,0,0,19,49,77,99,110,98,74,46,16,0,0,0,19,49,77,99,110,98,73,46,20,0,
+  0,0,0,11,41,69,95,107,104,87,63,48,68,92,107,107,92,67,38,8,0,0,0,0,0,5,28,51,71,79,71,53,
+  30,3,0,0,0,0,5,24,38,44,38,30,40,46,51,52,51,45,35,20,0,0,0,0,0,0,1,14,20,20,20,20,
+  18,10,0,0,0,0,0,0,20,35,45,48,43,32,15,0,0,0,0,0,3,16,20,20,20,20,20,20,20,20,20,20,
+  20,14,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,16,46,74,98,114,127,138,139,139,128,115,108,95,78,56,30,2,0,0,0,13,43,73,98,110,104,112,135,112,106,111,
+  95,69,40,9,0,0,0,16,46,75,101,115,116,116,116,116,116,116,116,114,98,73,43,13,0,0,0,0,27,51,71,79,
+  73,65,74,75,67,48,23,0,0,0,7,33,55,71,79,71,53,30,3,0,0,0,7,33,55,71,79,71,53,29,2,0,
+  0,0,0,0,26,50,69,76,73,62,42,28,48,67,75,75,67,48,23,0,0,0,0,0,0,0,5,27,42,47,42,28,
+  8,0,0,0,0,0,0,0,8,12,8,1,9,15,20,20,19,14,6,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,6,13,16,13,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,20,52,83,114,137,140,135,120,111,102,86,77,67,51,33,11,0,0,0,0,2,29,53,71,79,83,111,132,110,83,79,
+  71,50,26,0,0,0,0,4,31,56,76,84,84,84,84,84,84,84,84,83,74,53,29,2,0,0,0,0,5,27,42,48,
+  43,36,43,44,38,23,3,0,0,0,0,11,29,42,47,42,28,8,0,0,0,0,0,11,29,42,47,42,28,8,0,0,
+  0,0,0,0,5,26,40,44,42,33,18,6,23,38,44,44,38,23,3,0,0,0,0,0,0,0,0,0,12,16,12,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,17,47,77,104,121,115,106,93,81,72,59,46,37,25,7,0,0,0,0,0,0,8,28,42,50,71,95,107,95,69,49,
+  42,27,5,0,0,0,0,0,11,32,47,52,52,52,52,52,52,52,52,52,46,30,8,0,0,0,0,0,0,0,12,16,
+  13,6,11,12,8,0,0,0,0,0,0,0,0,12,16,12,0,0,0,0,0,0,0,0,0,12,16,12,0,0,0,0,
+  0,0,0,0,0,0,9,12,11,3,0,0,0,8,12,12,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,6,33,60,83,91,85,76,66,51,42,31,17,7,0,0,0,0,0,0,0,0,0,0,12,27,50,69,76,69,50,26,
+  12,0,0,0,0,0,0,0,0,5,17,20,20,20,20,20,20,20,20,20,16,3,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,16,38,55,60,55,46,36,23,11,2,0,0,0,0,0,0,0,0,0,0,0,0,0,5,26,40,44,40,26,5,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,12,24,28,24,15,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,12,9,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+ 18.000000f, 20.950001f, -0.009998f, 16.709999f, -4.250000f, 96,
+ {
+  {4294967295, 0, 0, 0, 0, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 0, {{0, 0.0f}} },
+  {32, 9, 9, -4, 4, 10.843750f, 0.000000f, 0.773438f, 0.865385f, 0.808594f, 0.923077f, 0, {{0, 0.0f}} },
+  {33, 12, 22, 0, 17, 10.843750f, 0.000000f, 0.640625f, 0.173077f, 0.687500f, 0.314103f, 0, {{0, 0.0f}} },
+  {34, 15, 14, -2, 17, 10.843750f, 0.000000f, 0.226562f, 0.865385f, 0.285156f, 0.955128f, 0, {{0, 0.0f}} },
+  {35, 20, 22, -4, 17, 10.843750f, 0.000000f, 0.687500f, 0.173077f, 0.765625f, 0.314103f, 0, {{0, 0.0f}} },
+  {36, 18, 25, -3, 18, 10.843750f, 0.000000f, 0.417969f, 0.000000f, 0.488281f, 0.160256f, 0, {{0, 0.0f}} },
+  {37, 20, 22, -4, 17, 10.843750f, 0.000000f, 0.765625f, 0.173077f, 0.843750f, 0.314103f, 0, {{0, 0.0f}} },
+  {38, 20, 22, -4, 17, 10.843750f, 0.000000f, 0.843750f, 0.173077f, 0.921875f, 0.314103f, 0, {{0, 0.0f}} },
+  {39, 12, 14, 0, 17, 10.843750f, 0.000000f, 0.285156f, 0.865385f, 0.332031f, 0.955128f, 0, {{0, 0.0f}} },
+  {40, 14, 25, -1, 18, 10.843750f, 0.000000f, 0.488281f, 0.000000f, 0.542969f, 0.160256f, 0, {{0, 0.0f}} },
+  {41, 14, 25, -1, 18, 10.843750f, 0.000000f, 0.542969f, 0.000000f, 0.597656f, 0.160256f, 0, {{0, 0.0f}} },
+  {42, 18, 17, -3, 17, 10.843750f, 0.000000f, 0.078125f, 0.865385f, 0.148438f, 0.974359f, 0, {{0, 0.0f}} },
+  {43, 20, 18, -4, 14, 10.843750f, 0.000000f, 0.722656f, 0.743590f, 0.800781f, 0.858974f, 0, {{0, 0.0f}} },
+  {44, 13, 14, -1, 7, 10.843750f, 0.000000f, 0.332031f, 0.865385f, 0.382812f, 0.955128f, 0, {{0, 0.0f}} },
+  {45, 14, 12, -1, 10, 10.843750f, 0.000000f, 0.593750f, 0.865385f, 0.648438f, 0.942308f, 0, {{0, 0.0f}} },
+  {46, 12, 12, 0, 7, 10.843750f, 0.000000f, 0.648438f, 0.865385f, 0.695312f, 0.942308f, 0, {{0, 0.0f}} },
+  {47, 19, 24, -4, 17, 10.843750f, 0.000000f, 0.667969f, 0.000000f, 0.742188f, 0.153846f, 0, {{0, 0.0f}} },
+  {48, 18, 22, -3, 17, 10.843750f, 0.000000f, 0.921875f, 0.173077f, 0.992188f, 0.314103f, 0, {{0, 0.0f}} },
+  {49, 17, 22, -2, 17, 10.843750f, 0.000000f, 0.000000f, 0.320513f, 0.066406f, 0.461538f, 0, {{0, 0.0f}} },
+  {50, 18, 22, -3, 17, 10.843750f, 0.000000f, 0.066406f, 0.320513f, 0.136719f, 0.461538f, 0, {{0, 0.0f}} },
+  {51, 18, 22, -3, 17, 10.843750f, 0.000000f, 0.136719f, 0.320513f, 0.207031f, 0.461538f, 0, {{0, 0.0f}} },
+  {52, 19, 22, -4, 17, 10.843750f, 0.000000f, 0.207031f, 0.320513f, 0.281250f, 0.461538f, 0, {{0, 0.0f}} },
+  {53, 18, 22, -3, 17, 10.843750f, 0.000000f, 0.281250f, 0.320513f, 0.351562f, 0.461538f, 0, {{0, 0.0f}} },
+  {54, 18, 22, -3, 17, 10.843750f, 0.000000f, 0.351562f, 0.320513f, 0.421875f, 0.461538f, 0, {{0, 0.0f}} },
+  {55, 18, 22, -3, 17, 10.843750f, 0.000000f, 0.421875f, 0.320513f, 0.492188f, 0.461538f, 0, {{0, 0.0f}} },
+  {56, 18, 22, -3, 17, 10.843750f, 0.000000f, 0.492188f, 0.320513f, 0.562500f, 0.461538f, 0, {{0, 0.0f}} },
+  {57, 18, 22, -3, 17, 10.843750f, 0.000000f, 0.562500f, 0.320513f, 0.632812f, 0.461538f, 0, {{0, 0.0f}} },
+  {58, 12, 18, 0, 13, 10.843750f, 0.000000f, 0.800781f, 0.743590f, 0.847656f, 0.858974f, 0, {{0, 0.0f}} },
+  {59, 13, 21, -1, 14, 10.843750f, 0.000000f, 0.675781f, 0.602564f, 0.726562f, 0.737179f, 0, {{0, 0.0f}} },
+  {60, 20, 18, -4, 14, 10.843750f, 0.000000f, 0.847656f, 0.743590f, 0.925781f, 0.858974f, 0, {{0, 0.0f}} },
+  {61, 20, 16, -4, 13, 10.843750f, 0.000000f, 0.148438f, 0.865385f, 0.226562f, 0.967949f, 0, {{0, 0.0f}} },
+  {62, 20, 18, -4, 14, 10.843750f, 0.000000f, 0.000000f, 0.865385f, 0.078125f, 0.980769f, 0, {{0, 0.0f}} },
+  {63, 17, 22, -2, 17, 10.843750f, 0.000000f, 0.632812f, 0.320513f, 0.699219f, 0.461538f, 0, {{0, 0.0f}} },
+  {64, 20, 26, -4, 17, 10.843750f, 0.000000f, 0.105469f, 0.000000f, 0.183594f, 0.166667f, 0, {{0, 0.0f}} },
+  {65, 20, 22, -4, 17, 10.843750f, 0.000000f, 0.699219f, 0.320513f, 0.777344f, 0.461538f, 0, {{0, 0.0f}} },
+  {66, 18, 22, -3, 17, 10.843750f, 0.000000f, 0.777344f, 0.320513f, 0.847656f, 0.461538f, 0, {{0, 0.0f}} },
+  {67, 18, 22, -3, 17, 10.843750f, 0.000000f, 0.847656f, 0.320513f, 0.917969f, 0.461538f, 0, {{0, 0.0f}} },
+  {68, 18, 22, -3, 17, 10.843750f, 0.000000f, 0.917969f, 0.320513f, 0.988281f, 0.461538f, 0, {{0, 0.0f}} },
+  {69, 18, 22, -3, 17, 10.843750f, 0.000000f, 0.000000f, 0.461538f, 0.070312f, 0.602564f, 0, {{0, 0.0f}} },
+  {70, 17, 22, -2, 17, 10.843750f, 0.000000f, 0.070312f, 0.461538f, 0.136719f, 0.602564f, 0, {{0, 0.0f}} },
+  {71, 19, 22, -4, 17, 10.843750f, 0.000000f, 0.136719f, 0.461538f, 0.210938f, 0.602564f, 0, {{0, 0.0f}} },
+  {72, 18, 22, -3, 17, 10.843750f, 0.000000f, 0.210938f, 0.461538f, 0.281250f, 0.602564f, 0, {{0, 0.0f}} },
+  {73, 18, 22, -3, 17, 10.843750f, 0.000000f, 0.281250f, 0.461538f, 0.351562f, 0.602564f, 0, {{0, 0.0f}} },
+  {74, 18, 22, -4, 17, 10.843750f, 0.000000f, 0.351562f, 0.461538f, 0.421875f, 0.602564f, 0, {{0, 0.0f}} },
+  {75, 19, 22, -3, 17, 10.843750f, 0.000000f, 0.421875f, 0.461538f, 0.496094f, 0.602564f, 0, {{0, 0.0f}} },
+  {76, 19, 22, -3, 17, 10.843750f, 0.000000f, 0.496094f, 0.461538f, 0.570312f, 0.602564f, 0, {{0, 0.0f}} },
+  {77, 20, 22, -4, 17, 10.843750f, 0.000000f, 0.570312f, 0.461538f, 0.648438f, 0.602564f, 0, {{0, 0.0f}} },
+  {78, 18, 22, -3, 17, 10.843750f, 0.000000f, 0.648438f, 0.461538f, 0.718750f, 0.602564f, 0, {{0, 0.0f}} },
+  {79, 18, 22, -3, 17, 10.843750f, 0.000000f, 0.718750f, 0.461538f, 0.789062f, 0.602564f, 0, {{0, 0.0f}} },
+  {80, 19, 22, -3, 17, 10.843750f, 0.000000f, 0.789062f, 0.461538f, 0.863281f, 0.602564f, 0, {{0, 0.0f}} },
+  {81, 18, 25, -3, 17, 10.843750f, 0.000000f, 0.597656f, 0.000000f, 0.667969f, 0.160256f, 0, {{0, 0.0f}} },
+  {82, 19, 22, -3, 17, 10.843750f, 0.000000f, 0.863281f, 0.461538f, 0.937500f, 0.602564f, 0, {{0, 0.0f}} },
+  {83, 18, 22, -3, 17, 10.843750f, 0.000000f, 0.000000f, 0.602564f, 0.070312f, 0.743590f, 0, {{0, 0.0f}} },
+  {84, 20, 22, -4, 17, 10.843750f, 0.000000f, 0.070312f, 0.602564f, 0.148438f, 0.743590f, 0, {{0, 0.0f}} },
+  {85, 18, 22, -3, 17, 10.843750f, 0.000000f, 0.148438f, 0.602564f, 0.218750f, 0.743590f, 0, {{0, 0.0f}} },
+  {86, 20, 22, -4, 17, 10.843750f, 0.000000f, 0.218750f, 0.602564f, 0.296875f, 0.743590f, 0, {{0, 0.0f}} },
+  {87, 20, 22, -4, 17, 10.843750f, 0.000000f, 0.296875f, 0.602564f, 0.375000f, 0.743590f, 0, {{0, 0.0f}} },
+  {88, 20, 22, -4, 17, 10.843750f, 0.000000f, 0.375000f, 0.602564f, 0.453125f, 0.743590f, 0, {{0, 0.0f}} },
+  {89, 20, 22, -4, 17, 10.843750f, 0.000000f, 0.453125f, 0.602564f, 0.531250f, 0.743590f, 0, {{0, 0.0f}} },
+  {90, 19, 22, -3, 17, 10.843750f, 0.000000f, 0.531250f, 0.602564f, 0.605469f, 0.743590f, 0, {{0, 0.0f}} },
+  {91, 13, 26, 0, 18, 10.843750f, 0.000000f, 0.183594f, 0.000000f, 0.234375f, 0.166667f, 0, {{0, 0.0f}} },
+  {92, 19, 24, -4, 17, 10.843750f, 0.000000f, 0.742188f, 0.000000f, 0.816406f, 0.153846f, 0, {{0, 0.0f}} },
+  {93, 13, 26, -1, 18, 10.843750f, 0.000000f, 0.234375f, 0.000000f, 0.285156f, 0.166667f, 0, {{0, 0.0f}} },
+  {94, 20, 14, -4, 17, 10.843750f, 0.000000f, 0.382812f, 0.865385f, 0.460938f, 0.955128f, 0, {{0, 0.0f}} },
+  {95, 20, 12, -4, 2, 10.843750f, 0.000000f, 0.695312f, 0.865385f, 0.773438f, 0.942308f, 0, {{0, 0.0f}} },
+  {96, 14, 13, -2, 19, 10.843750f, 0.000000f, 0.460938f, 0.865385f, 0.515625f, 0.948718f, 0, {{0, 0.0f}} },
+  {97, 18, 19, -3, 14, 10.843750f, 0.000000f, 0.726562f, 0.602564f, 0.796875f, 0.724359f, 0, {{0, 0.0f}} },
+  {98, 18, 23, -3, 18, 10.843750f, 0.000000f, 0.816406f, 0.000000f, 0.886719f, 0.147436f, 0, {{0, 0.0f}} },
+  {99, 18, 19, -3, 14, 10.843750f, 0.000000f, 0.796875f, 0.602564f, 0.867188f, 0.724359f, 0, {{0, 0.0f}} },
+  {100, 18, 23, -3, 18, 10.843750f, 0.000000f, 0.886719f, 0.000000f, 0.957031f, 0.147436f, 0, {{0, 0.0f}} },
+  {101, 18, 19, -3, 14, 10.843750f, 0.000000f, 0.867188f, 0.602564f, 0.937500f, 0.724359f, 0, {{0, 0.0f}} },
+  {102, 18, 23, -3, 18, 10.843750f, 0.000000f, 0.000000f, 0.173077f, 0.070312f, 0.320513f, 0, {{0, 0.0f}} },
+  {103, 18, 23, -3, 14, 10.843750f, 0.000000f, 0.070312f, 0.173077f, 0.140625f, 0.320513f, 0, {{0, 0.0f}} },
+  {104, 18, 23, -3, 18, 10.843750f, 0.000000f, 0.140625f, 0.173077f, 0.210938f, 0.320513f, 0, {{0, 0.0f}} },
+  {105, 18, 23, -3, 18, 10.843750f, 0.000000f, 0.210938f, 0.173077f, 0.281250f, 0.320513f, 0, {{0, 0.0f}} },
+  {106, 15, 27, -3, 18, 10.843750f, 0.000000f, 0.000000f, 0.000000f, 0.058594f, 0.173077f, 0, {{0, 0.0f}} },
+  {107, 18, 23, -2, 18, 10.843750f, 0.000000f, 0.281250f, 0.173077f, 0.351562f, 0.320513f, 0, {{0, 0.0f}} },
+  {108, 18, 23, -3, 18, 10.843750f, 0.000000f, 0.351562f, 0.173077f, 0.421875f, 0.320513f, 0, {{0, 0.0f}} },
+  {109, 19, 19, -4, 14, 10.843750f, 0.000000f, 0.000000f, 0.743590f, 0.074219f, 0.865385f, 0, {{0, 0.0f}} },
+  {110, 18, 19, -3, 14, 10.843750f, 0.000000f, 0.074219f, 0.743590f, 0.144531f, 0.865385f, 0, {{0, 0.0f}} },
+  {111, 18, 19, -3, 14, 10.843750f, 0.000000f, 0.144531f, 0.743590f, 0.214844f, 0.865385f, 0, {{0, 0.0f}} },
+  {112, 18, 23, -3, 14, 10.843750f, 0.000000f, 0.421875f, 0.173077f, 0.492188f, 0.320513f, 0, {{0, 0.0f}} },
+  {113, 18, 23, -3, 14, 10.843750f, 0.000000f, 0.492188f, 0.173077f, 0.562500f, 0.320513f, 0, {{0, 0.0f}} },
+  {114, 17, 19, -1, 14, 10.843750f, 0.000000f, 0.214844f, 0.743590f, 0.281250f, 0.865385f, 0, {{0, 0.0f}} },
+  {115, 18, 19, -3, 14, 10.843750f, 0.000000f, 0.281250f, 0.743590f, 0.351562f, 0.865385f, 0, {{0, 0.0f}} },
+  {116, 18, 22, -3, 17, 10.843750f, 0.000000f, 0.605469f, 0.602564f, 0.675781f, 0.743590f, 0, {{0, 0.0f}} },
+  {117, 18, 19, -3, 14, 10.843750f, 0.000000f, 0.351562f, 0.743590f, 0.421875f, 0.865385f, 0, {{0, 0.0f}} },
+  {118, 19, 19, -4, 14, 10.843750f, 0.000000f, 0.421875f, 0.743590f, 0.496094f, 0.865385f, 0, {{0, 0.0f}} },
+  {119, 20, 19, -4, 14, 10.843750f, 0.000000f, 0.496094f, 0.743590f, 0.574219f, 0.865385f, 0, {{0, 0.0f}} },
+  {120, 20, 19, -4, 14, 10.843750f, 0.000000f, 0.574219f, 0.743590f, 0.652344f, 0.865385f, 0, {{0, 0.0f}} },
+  {121, 20, 23, -4, 14, 10.843750f, 0.000000f, 0.562500f, 0.173077f, 0.640625f, 0.320513f, 0, {{0, 0.0f}} },
+  {122, 18, 19, -3, 14, 10.843750f, 0.000000f, 0.652344f, 0.743590f, 0.722656f, 0.865385f, 0, {{0, 0.0f}} },
+  {123, 17, 26, -3, 18, 10.843750f, 0.000000f, 0.285156f, 0.000000f, 0.351562f, 0.166667f, 0, {{0, 0.0f}} },
+  {124, 12, 27, 0, 18, 10.843750f, 0.000000f, 0.058594f, 0.000000f, 0.105469f, 0.173077f, 0, {{0, 0.0f}} },
+  {125, 17, 26, -3, 18, 10.843750f, 0.000000f, 0.351562f, 0.000000f, 0.417969f, 0.166667f, 0, {{0, 0.0f}} },
+  {126, 20, 13, -4, 12, 10.843750f, 0.000000f, 0.515625f, 0.865385f, 0.593750f, 0.948718f, 0, {{0, 0.0f}} },
+ }
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _DEJAVUFONT_SDF_H
@@ -0,0 +1,52 @@
+#ifndef _GPUPICK_H
+#define _GPUPICK_H
+
+// Selecao de objetos na GPU (ID buffer). Alternativa ao picking por raio de
+// "picking.h": os objetos registrados sao desenhados em um framebuffer com um
+// anexo de cor inteiro (GL_R32UI), onde cada fragmento guarda o identificador
+// da instancia, e um anexo GL_R32F com a distancia ate a camera. Em vez da
+// tela inteira, desenhamos somente o pixel sob a mira (centro da tela),
+// usando uma matriz de "pick" que amplia esse pixel para todo o viewport.
+//
+// O pixel e copiado para um pixel buffer object (PBO) e protegido por uma
+// fence; o resultado so e lido um ou dois quadros depois, quando a fence ja
+// foi sinalizada, de forma que a CPU nunca espera pela GPU. Veja
+// "gpupick.cpp".
+
+#include <glad/glad.h>
+
+#include <glm/mat4x4.hpp>
+#include <glm/vec4.hpp>
+
+// Resultado de uma consulta, entregue por GpuPick_Poll()
+struct GpuPickResult
+{
+    const char* name;      // Objeto sob a mira, ou NULL se nenhum
+    float       distance;  // Distancia da camera ate o pixel atingido
+    int         latency;   // Quadros entre o pedido e a leitura do resultado
+    glm::vec4   origin;    // Posicao da camera no quadro do pedido
+    glm::vec4   direction; // Direcao da mira (unitaria) no quadro do pedido
+};
+
+void GpuPick_Init(); // Cria framebuffer, PBOs e shaders (requer contexto OpenGL)
+
+// Instancias desenhadas no ID buffer. Os parametros sao os mesmos usados por
+// DrawVirtualObject(). Limpar as instancias descarta consultas pendentes.
+void GpuPick_ClearInstances();
+void GpuPick_AddInstance(GLuint vertex_array_object_id, GLenum rendering_mode, void* first_index, int num_indices,
+                         const glm::mat4& model, const char* name);
+
+// Desenha as instancias no pixel central de uma tela de "width" x "height"
+// pixels e inicia a copia assincrona do resultado. Restaura o framebuffer,
+// o viewport e o programa de GPU em uso. Retorna false se todas as consultas
+// ja estiverem pendentes.
+bool GpuPick_Request(const glm::mat4& view, const glm::mat4& projection, int width, int height);
+
+// Chamada uma vez por quadro. Retorna true, preenchendo "result", quando o
+// resultado da consulta mais antiga ja estiver disponivel.
+bool GpuPick_Poll(GpuPickResult* result);
+
+// Latencia, em quadros, da ultima consulta lida (-1 se nenhuma)
+int GpuPick_LastLatency();
+
+#endif // _GPUPICK_H
@@ -0,0 +1,49 @@
+#ifndef _HUD_H
+#define _HUD_H
+
+// Camada do HUD: o texto de todos os elementos (estatisticas de desempenho,
+// mensagens do overlay etc.) e desenhado em uma textura fora da tela somente
+// quando o conteudo de algum elemento ou o tamanho do framebuffer muda. Nos
+// demais quadros a textura e composta sobre a cena com um unico
+// quadrilatero, qualquer que seja a quantidade de texto.
+//
+// Cada elemento guarda seu texto e posicao; Hud_SetText() so marca o HUD
+// para ser redesenhado se algo mudou, de forma que pode ser chamada a cada
+// quadro. Veja "hud.cpp".
+
+#include <string>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+enum HudElement
+{
+    HUD_PROFILER,       // Percentis e zonas do profiler (veja "profiler.h")
+    HUD_GPU_PICK,       // Latencia do picking na GPU
+    HUD_OVERLAY,        // Mensagens temporizadas (veja "overlay.h")
+    HUD_NUM_ELEMENTS
+};
+
+// Cria o framebuffer e o programa de composicao. Requer TextRendering_Init().
+void Hud_Init();
+
+// Tamanho do framebuffer em pixels, chamada por FramebufferSizeCallback().
+// A textura e realocada no proximo Hud_Draw().
+void Hud_SetSize(int width, int height);
+
+// Bytes da textura com o tamanho atual do framebuffer, mesmo antes de ela
+// ser alocada (veja "--texture-memory" em "main.cpp")
+size_t Hud_TextureBytes();
+
+// Define o texto de um elemento. Linhas separadas por '\n' sao desenhadas
+// uma abaixo da outra, a partir da linha de base (x, y), em NDC.
+void Hud_SetText(HudElement element, const std::string& text, float x, float y);
+
+// Esconde um elemento (equivale a um texto vazio)
+void Hud_Hide(HudElement element);
+
+// Redesenha a textura, se algum elemento mudou, e a compoe sobre o
+// framebuffer atual. Retorna true se a textura foi redesenhada.
+bool Hud_Draw(GLFWwindow* window);
+
+#endif // _HUD_H
@@ -0,0 +1,46 @@
+#ifndef _INPUTRECORD_H
+#define _INPUTRECORD_H
+
+// Gravacao e reproducao deterministica da entrada do usuario. Com
+// "--record <arquivo>", o tempo de inicio de cada quadro e todos os eventos
+// de teclado e cursor entregues pela GLFW, cada um com o seu instante, sao
+// gravados em um log binario compacto. Com "--replay <arquivo>", o log
+// substitui a entrada real: cada quadro usa o tempo gravado e os eventos sao
+// entregues aos mesmos callbacks (KeyCallback, CursorPosCallback) no mesmo
+// ponto do quadro, reproduzindo
+// exatamente a trajetoria da camera e as trocas de sala. A reproducao e
+// indexada por quadro: o instante de cada evento e gravado para a analise
+// das sessoes, mas nao muda o ponto em que ele e entregue. Veja
+// "inputrecord.cpp".
+
+#include <GLFW/glfw3.h>
+
+bool Input_StartRecording(const char* filename);
+bool Input_StartReplay(const char* filename);
+bool Input_IsRecording();
+bool Input_IsReplaying();
+
+// Chamada no inicio de cada quadro com o tempo real (glfwGetTime()). Retorna
+// o tempo que deve ser usado pelo quadro: o proprio tempo real (gravando-o,
+// se for o caso) ou o tempo gravado no log durante a reproducao.
+double Input_BeginFrame(double live_time);
+
+// Indica que o log em reproducao chegou ao fim
+bool Input_ReplayFinished();
+
+// Entrega aos callbacks os eventos gravados para o quadro atual. Deve ser
+// chamada no mesmo ponto do quadro em que glfwPollEvents() e chamada.
+void Input_DispatchReplayEvents(GLFWwindow* window);
+
+// Indica se um evento vindo da GLFW deve ser processado. Durante a
+// reproducao somente os eventos do log sao aceitos.
+bool Input_AcceptEvent();
+
+// Gravacao dos eventos recebidos pelos callbacks
+void Input_RecordKey(int key, int scancode, int action, int mods);
+void Input_RecordCursorPos(double xpos, double ypos);
+
+// Fecha o arquivo de gravacao
+void Input_Finish();
+
+#endif // _INPUTRECORD_H
@@ -0,0 +1,90 @@
+#ifndef _MATERIALS_H
+#define _MATERIALS_H
+
+// Texturas dos materiais das paredes e do chao. Cada imagem e
+// redimensionada para MATERIAL_TEXTURE_WIDTH x MATERIAL_TEXTURE_HEIGHT, ou
+// para o maior nivel de mipmap desse tamanho que ainda cabe dentro dela
+// (nunca ampliamos uma imagem), ao gerar o cache de texturas (filtro de
+// Lanczos em espaco linear, veja "texturecache.h") e enviada como camada
+// de um GL_TEXTURE_2D_ARRAY. O fragment shader escolhe a camada pelo
+// uniform "material_layer", de forma que qualquer numero de materiais e
+// desenhado sem trocar de textura.
+//
+// Com um orcamento de memoria de texturas, cada material pode ignorar ate
+// MATERIAL_RESOLUTION_TIERS - 1 niveis de mipmap (os mais finos), dos
+// materiais de menor prioridade para os de maior, ate o total caber. Como
+// as camadas de um array tem o mesmo tamanho, os materiais que ignoram o
+// mesmo numero de niveis formam um array proprio ("nivel de resolucao"),
+// escolhido no shader pelo uniform "material_tier". Os niveis ignorados
+// nunca sao lidos do cache nem enviados. Uma imagem menor que a camada
+// maior comeca no nivel de resolucao do seu tamanho.
+//
+// A leitura das imagens (cache de texturas, ou decodificacao,
+// redimensionamento e compressao) e feita por threads de trabalho enquanto
+// a thread do OpenGL carrega os modelos e desenha os primeiros quadros. A
+// cada quadro, as imagens prontas sao entregues ao envio em partes de
+// "textureupload.h", que as copia para o array dentro do orcamento de bytes
+// do quadro, dos niveis menores para os maiores. Veja "materials.cpp".
+
+#include <string>
+#include <vector>
+
+#include <glad/glad.h>
+
+#include "texturecache.h"
+
+// Tamanho das camadas do array 0 (cada array seguinte tem metade)
+#define MATERIAL_TEXTURE_WIDTH  2048
+#define MATERIAL_TEXTURE_HEIGHT 1024
+
+// Maximo de threads de leitura das imagens
+#define MATERIAL_LOAD_THREADS 4
+
+// Arrays de materiais: o array i ignora os i primeiros niveis de mipmap e
+// fica na unidade de textura first_texture_unit + i. Deve ser igual ao
+// tamanho de "MaterialTextures" em "shader_fragment.glsl".
+#define MATERIAL_RESOLUTION_TIERS 4
+
+// Testa se a GPU aceita texturas no formato dado (requer contexto OpenGL)
+bool Materials_IsFormatSupported(TextureCacheFormat format);
+
+// Inicia a leitura das imagens "filenames" (o material i e a imagem i) do
+// cache de texturas no formato dado, em ate MATERIAL_LOAD_THREADS threads
+// de trabalho. Antes, escolhe o nivel de resolucao de cada material para
+// que o total caiba em "memory_budget" bytes (zero para sem limite), de
+// acordo com "priorities". Nao usa o OpenGL.
+void Materials_BeginLoad(const std::vector<std::string>& filenames, const std::vector<int>& priorities,
+                         TextureCacheFormat format, BcQuality quality, size_t memory_budget);
+
+// Cria e aloca os arrays usados a partir da unidade de textura
+// "first_texture_unit", sem esperar pelas imagens, registra-os em
+// TextureUpload_RegisterArray() e contabiliza cada material em
+// "texturememory.h". Se o driver recusar o formato comprimido, as imagens
+// sao lidas de novo em RGBA8. Retorna false se os arrays nao puderem ser
+// criados. Deve ser chamada na thread do OpenGL, depois de
+// Materials_BeginLoad() e de TextureUpload_Init().
+bool Materials_CreateTexture(GLuint first_texture_unit);
+
+// Entrega ao envio em partes as imagens cuja leitura terminou, sem esperar
+// pelas outras, imprimindo o tempo de leitura de cada uma. Uma imagem que
+// nao pode ser lida deixa sua camada sem textura. Chamada uma vez por
+// quadro, antes de TextureUpload_Update().
+void Materials_Update();
+
+// Testa se ainda ha imagens a entregar ao envio (leituras em andamento ou
+// prontas mas ainda nao entregues por Materials_Update())
+bool Materials_IsLoading();
+
+// Espera as leituras que ainda nao terminaram (ex.: janela fechada durante
+// a geracao do cache de texturas). Chamada ao sair.
+void Materials_Shutdown();
+
+// Numero de materiais
+int Materials_Count();
+
+// Nivel de resolucao (array) e camada do material "material", para os
+// uniforms "material_tier" e "material_layer"
+int Materials_Tier(int material);
+int Materials_Layer(int material);
+
+#endif // _MATERIALS_H
@@ -0,0 +1,28 @@
+#ifndef _OVERLAY_H
+#define _OVERLAY_H
+
+// Mensagens temporizadas (vitoria, derrota, avisos) desenhadas sobre a cena
+// como parte do quadro normal. Overlay_Post() somente enfileira a mensagem;
+// Overlay_Update(), chamada uma vez por quadro antes de Hud_Draw(), passa as
+// mensagens ativas para o elemento HUD_OVERLAY do HUD (veja "hud.h") e
+// descarta as expiradas. O laco do jogo nunca espera por uma mensagem. Veja
+// "overlay.cpp".
+
+#include <GLFW/glfw3.h>
+
+#define OVERLAY_CAPACITY 8
+#define OVERLAY_MESSAGE_LENGTH 128
+
+// Duracao de uma mensagem que nunca expira (fica na tela ate o fim do jogo)
+#define OVERLAY_PERSISTENT -1.0
+
+// Enfileira uma mensagem, exibida por "duration" segundos a partir do
+// primeiro quadro em que aparece. Se a fila estiver cheia, a mensagem mais
+// antiga e descartada.
+void Overlay_Post(const char* message, double duration);
+
+// Remove as mensagens que expiraram antes de "now" (tempo do quadro, em
+// segundos) e passa as demais, uma por linha, para o HUD
+void Overlay_Update(GLFWwindow* window, double now);
+
+#endif // _OVERLAY_H
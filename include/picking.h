@@ -0,0 +1,47 @@
+#ifndef _PICKING_H
+#define _PICKING_H
+
+// Selecao de objetos por raio (picking) na CPU. Cada malha carregada recebe,
+// na inicializacao, uma BVH de triangulos construida com a heuristica de
+// area de superficie (SAH) em "bins". Os objetos da sala atual sao
+// registrados como instancias (malha + matriz de modelagem); um raio e
+// testado primeiro contra a AABB de cada instancia e, se a atingir, contra a
+// BVH da malha no sistema de coordenadas do modelo. O resultado e o objeto
+// mais proximo atingido e o ponto exato de intersecao. Veja "picking.cpp".
+
+#include <glm/mat4x4.hpp>
+#include <glm/vec4.hpp>
+#include <tiny_obj_loader.h>
+
+// Resultado de Pick_CastRay()
+struct PickHit
+{
+    int         instance;  // Indice da instancia atingida
+    const char* name;      // Nome do objeto (o mesmo de g_VirtualScene)
+    float       distance;  // Distancia da origem do raio ate o ponto atingido
+    glm::vec4   point;     // Ponto atingido, em coordenadas globais
+    int         triangle;  // Triangulo atingido, na ordem da BVH
+};
+
+// Constroi a BVH de uma "shape" de um arquivo ".obj" (com faces ja
+// trianguladas). Retorna o identificador da malha.
+int Pick_AddShape(const tinyobj::attrib_t& attrib, const tinyobj::shape_t& shape);
+
+// Informacoes de uma malha, para relatorios
+int Pick_MeshTriangles(int mesh);
+int Pick_MeshNodes(int mesh);
+
+// Instancias que podem ser atingidas pelos raios
+void Pick_ClearInstances();
+void Pick_AddInstance(int mesh, const glm::mat4& model, const char* name);
+
+// Lanca um raio a partir de "origin" (ponto) na direcao "direction" (vetor,
+// nao precisa ser unitario), ate a distancia "max_distance". Retorna true se
+// algum objeto foi atingido, preenchendo "hit".
+bool Pick_CastRay(glm::vec4 origin, glm::vec4 direction, float max_distance, PickHit* hit);
+
+// Lanca um raio diretamente contra uma malha, em coordenadas do modelo.
+// Retorna a distancia parametrica do ponto atingido ou -1.
+float Pick_RayMesh(int mesh, const float origin[3], const float direction[3], float max_t);
+
+#endif // _PICKING_H
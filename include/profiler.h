@@ -0,0 +1,75 @@
+#ifndef _PROFILER_H
+#define _PROFILER_H
+
+// Instrumentacao de desempenho por quadro: temporizadores de CPU por fase,
+// consultas GL_TIME_ELAPSED na GPU (lidas de forma nao-bloqueante alguns
+// quadros depois), contadores de desenhos/triangulos e um HUD com os
+// percentis p50/p95/p99 do tempo de quadro. Veja "profiler.cpp".
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+// Fases do quadro medidas separadamente. As fases nao podem ser aninhadas,
+// pois a GPU so permite uma consulta GL_TIME_ELAPSED ativa por vez.
+enum ProfilerZone
+{
+    PROFILER_INPUT_CAMERA = 0, // Entrada do usuario e atualizacao da camera
+    PROFILER_ROOM_DRAW,        // Submissao dos desenhos da sala atual
+    PROFILER_PICK,             // Atualizacao/colisao dos objetos de captura
+    PROFILER_PROJECTILE_DRAW,  // Desenho dos cubos lancados
+    PROFILER_TEXT,             // Renderizacao de texto (HUD e mensagens)
+    PROFILER_TEXTURE_UPLOAD,   // Envio de texturas em partes (veja "textureupload.h")
+    PROFILER_NUM_ZONES
+};
+
+void Profiler_Init();       // Cria as consultas de GPU (requer contexto OpenGL)
+void Profiler_BeginFrame(); // Chamada no inicio de cada quadro
+void Profiler_EndFrame();   // Chamada logo antes de glfwSwapBuffers()
+void Profiler_BeginZone(ProfilerZone zone);
+void Profiler_EndZone(ProfilerZone zone);
+
+// Contabiliza uma chamada de desenho com o numero de triangulos informado
+void Profiler_CountDraw(int num_triangles);
+
+// Atualiza o elemento HUD_PROFILER do HUD (veja "hud.h") com os percentis
+// do tempo de quadro
+void Profiler_UpdateHud(GLFWwindow* window);
+
+// Escreve o historico de quadros em um arquivo CSV. Retorna false em caso de erro.
+bool Profiler_DumpCsv(const char* filename);
+
+// Estatisticas de um quadro. Tempos de GPU negativos indicam que o
+// resultado ainda nao foi lido.
+struct ProfilerFrameStats
+{
+    double frame_ms;
+    double cpu_ms;
+    double gpu_ms;
+    int    draws;
+    long   triangles;
+};
+
+// Le, sem bloquear, os resultados de GPU que ja estiverem disponiveis.
+// Chamada automaticamente por Profiler_BeginFrame().
+void Profiler_ResolveGpuQueries();
+
+// Estatisticas do quadro mais recente encerrado por Profiler_EndFrame().
+bool Profiler_GetLastFrame(ProfilerFrameStats* stats);
+
+// Percentil (0-100) do intervalo entre quadros, em milissegundos, sobre o
+// historico recente.
+double Profiler_FrameTimePercentile(double percentile);
+
+// Temporizador com escopo: mede a fase desde a construcao ate o fim do bloco.
+struct ProfilerScope
+{
+    ProfilerZone zone;
+    ProfilerScope(ProfilerZone z) : zone(z) { Profiler_BeginZone(zone); }
+    ~ProfilerScope() { Profiler_EndZone(zone); }
+};
+
+#define PROFILER_CONCAT_(a, b) a##b
+#define PROFILER_CONCAT(a, b) PROFILER_CONCAT_(a, b)
+#define PROFILE_ZONE(zone) ProfilerScope PROFILER_CONCAT(profiler_scope_, __LINE__)(zone)
+
+#endif // _PROFILER_H
@@ -0,0 +1,38 @@
+#ifndef _PROJECTILES_H
+#define _PROJECTILES_H
+
+// Conjunto de projeteis (os cubos lancados com a tecla espaco para pegar os
+// objetos) em estrutura de arrays (SoA), com capacidade fixa. Cada atributo
+// fica em um vetor proprio, de forma que a integracao e a remocao sao lacos
+// simples sobre floats contiguos, que o compilador vetoriza. Projeteis removidos sao substituidos pelo ultimo do vetor (swap
+// remove), sem realocacao nem deslocamento de memoria. Veja
+// "projectiles.cpp".
+
+#include <glm/vec4.hpp>
+
+#define PROJECTILE_CAPACITY 8192
+
+struct ProjectilePool
+{
+    int   count;
+    float position_x[PROJECTILE_CAPACITY];
+    float position_y[PROJECTILE_CAPACITY];
+    float position_z[PROJECTILE_CAPACITY];
+    float velocity_x[PROJECTILE_CAPACITY];
+    float velocity_y[PROJECTILE_CAPACITY];
+    float velocity_z[PROJECTILE_CAPACITY];
+    float lifetime[PROJECTILE_CAPACITY];   // Tempo restante, em segundos
+};
+
+void Projectiles_Clear(ProjectilePool* pool);
+
+// Adiciona um projetil. Retorna false se o conjunto estiver cheio.
+bool Projectiles_Spawn(ProjectilePool* pool, glm::vec4 position, glm::vec4 velocity, float lifetime);
+
+// Avanca posicoes e tempos de vida em "dt" segundos
+void Projectiles_Integrate(ProjectilePool* pool, float dt);
+
+// Remove os projeteis cujo tempo de vida acabou
+void Projectiles_RemoveExpired(ProjectilePool* pool);
+
+#endif // _PROJECTILES_H
@@ -0,0 +1,110 @@
+#ifndef _SCENE_H
+#define _SCENE_H
+
+// Representacao da cena como entidades e componentes (ECS). Uma entidade e
+// somente um indice; seus dados ficam em vetores contiguos, um por
+// componente (transformacao, sala, desenho, colisao e picking), e uma
+// mascara indica quais componentes cada entidade possui. Os sistemas de
+// desenho, colisao e picking percorrem esses vetores linearmente, filtrando
+// as entidades pela sala: uma sala e uma consulta sobre os dados, e nao um
+// bloco de codigo.
+//
+// As transformacoes formam uma hierarquia: cada entidade pode ter um pai, e
+// sua matriz local e relativa a ele (um objeto sobre uma mesa acompanha a
+// mesa). O pai sempre e criado antes dos filhos, de forma que o vetor ja
+// esta em ordem de percurso: Scene_UpdateTransforms() recalcula, em uma
+// unica passada linear, somente as matrizes globais das entidades alteradas
+// e de seus descendentes. Veja "scene.cpp".
+
+#include <glad/glad.h>
+
+#include <glm/mat4x4.hpp>
+#include <glm/vec3.hpp>
+
+// Componentes de uma entidade (mascara de bits)
+#define SCENE_RENDERABLE 1
+#define SCENE_COLLIDER   2
+#define SCENE_PICKABLE   4
+
+// Componente de desenho: os mesmos parametros usados por DrawVirtualObject()
+// em main.cpp, mais os valores dos uniforms "object_id", "material_tier" e
+// "material_layer"
+struct SceneRenderable
+{
+    GLuint    vertex_array_object_id;
+    GLenum    rendering_mode;
+    void*     first_index;
+    int       num_indices;
+    glm::vec3 bbox_min;
+    glm::vec3 bbox_max;
+    int       object_id;
+    int       material_tier;   // Array de materiais (veja "materials.h")
+    int       material_layer;  // Camada do array de materiais
+};
+
+// Componente de colisao: caixa no sistema de coordenadas do modelo
+struct SceneCollider
+{
+    glm::vec3 box_min;
+    glm::vec3 box_max;
+};
+
+// Componente de picking: malha com BVH (veja "picking.h") e nome do objeto
+struct ScenePickable
+{
+    int         pick_mesh;
+    const char* name;
+};
+
+// Localizacao dos uniforms usados pelo sistema de desenho
+struct SceneUniforms
+{
+    GLint model;
+    GLint normal_matrix;
+    GLint object_id;
+    GLint material_layer;
+    GLint material_tier;
+    GLint bbox_min;
+    GLint bbox_max;
+};
+
+void Scene_Clear();
+
+// Cria uma entidade na sala "room" com a matriz de modelagem "transform",
+// relativa a entidade "parent" (ou global, se parent < 0). O pai precisa ja
+// existir. Retorna o indice da entidade.
+int Scene_CreateEntity(int room, const glm::mat4& transform, int parent = -1);
+
+void Scene_AddRenderable(int entity, const SceneRenderable& renderable);
+void Scene_AddCollider(int entity, glm::vec3 box_min, glm::vec3 box_max);
+void Scene_AddPickable(int entity, int pick_mesh, const char* name);
+
+int Scene_NumEntities();
+
+// Transformacoes. Alterar a matriz local marca a entidade como "suja"; a
+// matriz global, e a matriz das normais correspondente, so sao atualizadas
+// em Scene_UpdateTransforms().
+void             Scene_SetLocalTransform(int entity, const glm::mat4& transform);
+const glm::mat4& Scene_LocalTransform(int entity);
+int              Scene_Parent(int entity);
+
+// Recalcula as matrizes globais das entidades sujas e de seus descendentes.
+// Retorna o numero de matrizes recalculadas (zero se nada mudou, sem
+// percorrer as entidades).
+int Scene_UpdateTransforms();
+
+// Sistemas. Todos consideram somente as entidades da sala "room".
+
+// Desenha as entidades com componente de desenho. O programa de GPU e as
+// matrizes "view" e "projection" ja devem estar definidos.
+void Scene_DrawRoom(int room, const SceneUniforms& uniforms);
+
+// Reconstroi o mundo de colisao (veja "collisions.h") com as caixas das
+// entidades com componente de colisao.
+void Scene_BuildRoomColliders(int room);
+
+// Registra as entidades com componente de picking como instancias do
+// picking na CPU (veja "picking.h") e na GPU (veja "gpupick.h").
+void Scene_RegisterRoomPickables(int room);
+
+#endif // _SCENE_H
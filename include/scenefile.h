@@ -0,0 +1,88 @@
+#ifndef _SCENEFILE_H
+#define _SCENEFILE_H
+
+// Descricao da cena em arquivo: modelos e materiais a carregar, objetos de cada sala
+// (com a matriz de modelagem ja calculada) e o objeto procurado em cada
+// sala. Ha dois formatos:
+//
+//   - texto ("data/scene.txt"), editado a mao. Cada objeto e descrito por
+//     uma sequencia de transformacoes, compostas uma unica vez na leitura;
+//   - binario ("data/scene.bin"), gerado a partir do texto com
+//     "--compile-scene", que guarda as matrizes prontas e e lido sem nenhum
+//     processamento.
+//
+// O formato de texto esta documentado no inicio de "data/scene.txt". Veja
+// "scenefile.cpp".
+
+#include <string>
+#include <vector>
+
+#include <glm/mat4x4.hpp>
+
+// Valores de "object_id" (veja "shader_fragment.glsl")
+#define ROOM1    1
+#define PLANE    2
+#define ROOM2    3
+#define ROOM3    4
+#define LONDON   1
+#define KNIFE    3
+#define BROOM    4
+#define GET_OBJ  4
+
+// Caixa de colisao de um objeto
+enum SceneFileCollider
+{
+    SCENE_FILE_NO_COLLIDER = 0,
+    SCENE_FILE_BBOX_COLLIDER,  // Bounding box do modelo
+    SCENE_FILE_WALL_COLLIDER   // Plano com espessura WALL_HALF_THICKNESS
+};
+
+struct SceneFileModel
+{
+    std::string filename;
+    std::string basepath;  // Vazio se o ".obj" nao tiver materiais
+};
+
+// Material das paredes e do chao: imagem de uma camada de um array de
+// texturas (veja "materials.h"). Com um orcamento de memoria de texturas,
+// os materiais de menor prioridade perdem resolucao primeiro.
+struct SceneFileMaterial
+{
+    std::string name;
+    std::string filename;
+    int         priority;
+};
+
+struct SceneFileObject
+{
+    int         room;
+    std::string name;        // Nome do objeto em g_VirtualScene
+    glm::mat4   model;       // Matriz de modelagem, relativa ao pai
+    int         parent;      // Indice do pai em "objects" (sempre menor), ou -1
+    int         object_id;
+    int         material;    // Indice em "materials" (paredes e chao), ou 0
+    int         collider;    // SceneFileCollider
+    bool        pickable;
+};
+
+struct SceneDescription
+{
+    std::vector<SceneFileModel>  models;
+    std::vector<SceneFileMaterial> materials;
+    std::vector<std::string>     targets;  // Objeto procurado na sala i+1
+    std::vector<SceneFileObject> objects;
+};
+
+// Le um arquivo de cena em qualquer um dos formatos (o binario e
+// reconhecido pelo cabecalho). Retorna false em caso de erro.
+bool SceneFile_Load(const char* filename, SceneDescription* scene);
+
+// Le o arquivo binario se ele existir e nao for mais antigo que o texto;
+// caso contrario, le o texto. Se o binario for de outra versao ou invalido,
+// o texto tambem e lido (com um aviso).
+bool SceneFile_LoadNewest(const char* text_filename, const char* binary_filename, SceneDescription* scene);
+
+// Grava a cena no formato binario. Retorna false em caso de erro.
+bool SceneFile_SaveBinary(const char* filename, const SceneDescription& scene);
+
+#endif // _SCENEFILE_H
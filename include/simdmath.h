@@ -0,0 +1,67 @@
+#ifndef _SIMDMATH_H
+#define _SIMDMATH_H
+
+// Versoes SIMD das operacoes de "matrices.h" e operacoes em lote usadas pelos
+// sistemas de cena, colisao e culling. Ha tres implementacoes, escolhidas na
+// compilacao: SSE2 (x86-64), NEON (ARM) e escalar, para as demais
+// arquiteturas. Os resultados sao iguais aos das funcoes de "matrices.h" a
+// menos de arredondamento (as somas sao feitas em outra ordem). Veja
+// "simdmath.cpp" e "--bench-matrices".
+
+#include <glm/mat4x4.hpp>
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+
+// Nome da implementacao compilada ("SSE2", "NEON" ou "escalar")
+const char* Simd_Name();
+
+// Produtos: a * b e m * v
+glm::mat4 Simd_Multiply(const glm::mat4& a, const glm::mat4& b);
+glm::vec4 Simd_Transform(const glm::mat4& m, const glm::vec4& v);
+
+// Compoem uma transformacao a direita de "m", como em
+// "m * Matrix_Translate(tx, ty, tz)". Como so algumas colunas mudam, custam
+// bem menos que um produto de matrizes completo:
+//
+//   Matrix_Translate(t) * Matrix_Rotate_Y(a) * Matrix_Scale(s)
+//     == Simd_Scale(Simd_Rotate_Y(Simd_Translate(I, t), a), s)
+//
+glm::mat4 Simd_Translate(const glm::mat4& m, float tx, float ty, float tz);
+glm::mat4 Simd_Scale(const glm::mat4& m, float sx, float sy, float sz);
+glm::mat4 Simd_Rotate_X(const glm::mat4& m, float angle);
+glm::mat4 Simd_Rotate_Y(const glm::mat4& m, float angle);
+glm::mat4 Simd_Rotate_Z(const glm::mat4& m, float angle);
+glm::mat4 Simd_Rotate(const glm::mat4& m, float angle, const glm::vec4& axis);
+
+// Produto vetorial, produto escalar e norma, considerando somente as
+// coordenadas x, y e z (a coordenada w e ignorada)
+glm::vec4 Simd_Cross(const glm::vec4& u, const glm::vec4& v);
+float     Simd_Dot(const glm::vec4& u, const glm::vec4& v);
+float     Simd_Norm(const glm::vec4& v);
+
+// Operacoes em lote
+
+// out[i] = m * points[i], para i em [0, count). "out" pode ser "points".
+void Simd_TransformPoints(const glm::mat4& m, const glm::vec4* points, glm::vec4* out, int count);
+
+// Translacao, rotacao (angulos em radianos em torno de X, Y e Z) e escala
+struct SimdTRS
+{
+    glm::vec3 translation;
+    glm::vec3 rotation;
+    glm::vec3 scale;
+};
+
+// out[i] = T * Rz * Ry * Rx * S, a cadeia usada pelos objetos da cena,
+// calculada diretamente a partir dos senos e cossenos, sem produtos.
+void Simd_ComposeTRS(const SimdTRS* trs, glm::mat4* out, int count);
+
+// Testa caixas alinhadas aos eixos contra planos (n.x, n.y, n.z, d), cujo
+// lado de dentro e dot(n, p) + d >= 0, como os planos de um frustum.
+// visible[i] e 1 se a caixa i nao esta inteiramente fora de nenhum plano.
+// Retorna o numero de caixas visiveis.
+int Simd_CullBoxes(const glm::vec4* planes, int num_planes,
+                   const glm::vec3* box_min, const glm::vec3* box_max, int count,
+                   unsigned char* visible);
+
+#endif // _SIMDMATH_H
@@ -0,0 +1,118 @@
+#ifndef _SIMDVEC_H
+#define _SIMDVEC_H
+
+// Operacoes com 4 floats (SimdVec) implementadas para SSE2 (x86-64), NEON
+// (ARM) e de forma escalar, escolhidas na compilacao. Usadas pelas operacoes
+// de matrizes de "simdmath.cpp" e pelo compressor de texturas de
+// "bcencode.cpp". Todas as funcoes sao "static inline", com o prefixo Simd_;
+// inclua este arquivo somente em arquivos .cpp. SIMD_BACKEND_NAME e o nome
+// da implementacao.
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SIMD_SSE2
+#define SIMD_BACKEND_NAME "SSE2"
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define SIMD_NEON
+#define SIMD_BACKEND_NAME "NEON"
+#include <arm_neon.h>
+#endif
+
+#if defined(SIMD_SSE2)
+
+typedef __m128 SimdVec;
+typedef __m128 SimdMask;
+
+static inline SimdVec Simd_Load(const float* p)          { return _mm_loadu_ps(p); }
+static inline void    Simd_Store(float* p, SimdVec v)    { _mm_storeu_ps(p, v); }
+static inline SimdVec Simd_Splat(float s)                { return _mm_set1_ps(s); }
+static inline SimdVec Simd_Set(float x, float y, float z, float w) { return _mm_setr_ps(x, y, z, w); }
+static inline SimdVec Simd_Add(SimdVec a, SimdVec b)     { return _mm_add_ps(a, b); }
+static inline SimdVec Simd_Sub(SimdVec a, SimdVec b)     { return _mm_sub_ps(a, b); }
+static inline SimdVec Simd_Mul(SimdVec a, SimdVec b)     { return _mm_mul_ps(a, b); }
+static inline SimdVec Simd_Min(SimdVec a, SimdVec b)     { return _mm_min_ps(a, b); }
+static inline SimdMask Simd_NonNegative(SimdVec a)       { return _mm_cmpge_ps(a, _mm_setzero_ps()); }
+static inline SimdMask Simd_Less(SimdVec a, SimdVec b)   { return _mm_cmplt_ps(a, b); }
+static inline SimdVec Simd_Select(SimdMask m, SimdVec a, SimdVec b) { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+static inline bool    Simd_AnyNegative(SimdVec a)        { return _mm_movemask_ps(_mm_cmplt_ps(a, _mm_setzero_ps())) != 0; }
+
+// (y, z, x, w) e (z, x, y, w), usados no produto vetorial
+static inline SimdVec Simd_SwizzleYZX(SimdVec a)         { return _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1)); }
+static inline SimdVec Simd_SwizzleZXY(SimdVec a)         { return _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 1, 0, 2)); }
+
+// Soma das coordenadas x, y e z
+static inline float Simd_SumXYZ(SimdVec a)
+{
+    SimdVec y = _mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 1, 1, 1));
+    SimdVec z = _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 2, 2));
+    return _mm_cvtss_f32(_mm_add_ss(_mm_add_ss(a, y), z));
+}
+
+
+#elif defined(SIMD_NEON)
+
+typedef float32x4_t SimdVec;
+typedef uint32x4_t  SimdMask;
+
+static inline SimdVec Simd_Load(const float* p)          { return vld1q_f32(p); }
+static inline void    Simd_Store(float* p, SimdVec v)    { vst1q_f32(p, v); }
+static inline SimdVec Simd_Splat(float s)                { return vdupq_n_f32(s); }
+static inline SimdVec Simd_Set(float x, float y, float z, float w) { float v[4] = { x, y, z, w }; return vld1q_f32(v); }
+static inline SimdVec Simd_Add(SimdVec a, SimdVec b)     { return vaddq_f32(a, b); }
+static inline SimdVec Simd_Sub(SimdVec a, SimdVec b)     { return vsubq_f32(a, b); }
+static inline SimdVec Simd_Mul(SimdVec a, SimdVec b)     { return vmulq_f32(a, b); }
+static inline SimdVec Simd_Min(SimdVec a, SimdVec b)     { return vminq_f32(a, b); }
+static inline SimdMask Simd_NonNegative(SimdVec a)       { return vcgeq_f32(a, vdupq_n_f32(0.0f)); }
+static inline SimdMask Simd_Less(SimdVec a, SimdVec b)   { return vcltq_f32(a, b); }
+static inline SimdVec Simd_Select(SimdMask m, SimdVec a, SimdVec b) { return vbslq_f32(m, a, b); }
+
+static inline bool Simd_AnyNegative(SimdVec a)
+{
+    uint32x4_t m = vcltq_f32(a, vdupq_n_f32(0.0f));
+    uint32x2_t r = vorr_u32(vget_low_u32(m), vget_high_u32(m));
+    return (vget_lane_u32(r, 0) | vget_lane_u32(r, 1)) != 0;
+}
+
+static inline SimdVec Simd_SwizzleYZX(SimdVec a)
+{
+    return Simd_Set(vgetq_lane_f32(a, 1), vgetq_lane_f32(a, 2), vgetq_lane_f32(a, 0), vgetq_lane_f32(a, 3));
+}
+
+static inline SimdVec Simd_SwizzleZXY(SimdVec a)
+{
+    return Simd_Set(vgetq_lane_f32(a, 2), vgetq_lane_f32(a, 0), vgetq_lane_f32(a, 1), vgetq_lane_f32(a, 3));
+}
+
+static inline float Simd_SumXYZ(SimdVec a)
+{
+    return vgetq_lane_f32(a, 0) + vgetq_lane_f32(a, 1) + vgetq_lane_f32(a, 2);
+}
+
+
+#else
+
+#define SIMD_BACKEND_NAME "escalar"
+
+struct SimdVec  { float v[4]; };
+struct SimdMask { bool m[4]; };
+
+static inline SimdVec Simd_Load(const float* p)          { SimdVec r; for (int i = 0; i < 4; ++i) r.v[i] = p[i]; return r; }
+static inline void    Simd_Store(float* p, SimdVec a)    { for (int i = 0; i < 4; ++i) p[i] = a.v[i]; }
+static inline SimdVec Simd_Splat(float s)                { SimdVec r; for (int i = 0; i < 4; ++i) r.v[i] = s; return r; }
+static inline SimdVec Simd_Set(float x, float y, float z, float w) { SimdVec r = { { x, y, z, w } }; return r; }
+static inline SimdVec Simd_Add(SimdVec a, SimdVec b)     { for (int i = 0; i < 4; ++i) a.v[i] += b.v[i]; return a; }
+static inline SimdVec Simd_Sub(SimdVec a, SimdVec b)     { for (int i = 0; i < 4; ++i) a.v[i] -= b.v[i]; return a; }
+static inline SimdVec Simd_Mul(SimdVec a, SimdVec b)     { for (int i = 0; i < 4; ++i) a.v[i] *= b.v[i]; return a; }
+static inline SimdVec Simd_Min(SimdVec a, SimdVec b)     { for (int i = 0; i < 4; ++i) a.v[i] = b.v[i] < a.v[i] ? b.v[i] : a.v[i]; return a; }
+static inline SimdMask Simd_NonNegative(SimdVec a)       { SimdMask r; for (int i = 0; i < 4; ++i) r.m[i] = a.v[i] >= 0.0f; return r; }
+static inline SimdMask Simd_Less(SimdVec a, SimdVec b)   { SimdMask r; for (int i = 0; i < 4; ++i) r.m[i] = a.v[i] < b.v[i]; return r; }
+static inline SimdVec Simd_Select(SimdMask m, SimdVec a, SimdVec b) { for (int i = 0; i < 4; ++i) if (!m.m[i]) a.v[i] = b.v[i]; return a; }
+static inline bool    Simd_AnyNegative(SimdVec a)        { return a.v[0] < 0.0f || a.v[1] < 0.0f || a.v[2] < 0.0f || a.v[3] < 0.0f; }
+static inline SimdVec Simd_SwizzleYZX(SimdVec a)         { return Simd_Set(a.v[1], a.v[2], a.v[0], a.v[3]); }
+static inline SimdVec Simd_SwizzleZXY(SimdVec a)         { return Simd_Set(a.v[2], a.v[0], a.v[1], a.v[3]); }
+static inline float   Simd_SumXYZ(SimdVec a)             { return a.v[0] + a.v[1] + a.v[2]; }
+
+
+#endif
+
+#endif // _SIMDVEC_H
@@ -0,0 +1,93 @@
+#ifndef _TEXTURECACHE_H
+#define _TEXTURECACHE_H
+
+// Cache de texturas pre-processadas. Na primeira carga de uma imagem (JPEG,
+// PNG etc.), ela e decodificada pela stb_image, opcionalmente
+// redimensionada (filtro de Lanczos em espaco linear) e a cadeia completa
+// de mipmaps e gerada na CPU (filtro de caixa 2x2 em espaco linear, ja que as
+// texturas sao sRGB). Nos formatos comprimidos, cada nivel e entao
+// comprimido em blocos (veja "bcencode.h"). O resultado e gravado ao lado
+// da imagem, em "<imagem>.texcache" (RGB8) ou "<imagem>.<formato>.texcache"
+// (ex.: "floor.jpg.bc1.texcache"):
+//
+//   "FCGT", versao, hash e tamanho da imagem de origem, largura, altura,
+//   formato, qualidade da compressao, numero de niveis, e para cada nivel
+//   largura, altura, posicao e tamanho dos dados; seguidos dos dados de
+//   todos os niveis, no formato enviado a glTexImage2D() ou
+//   glCompressedTexImage2D().
+//
+// Nas cargas seguintes, o arquivo e mapeado na memoria (mmap) e, se o hash
+// do conteudo da imagem for o mesmo, os niveis sao enviados diretamente,
+// sem decodificar JPEG, gerar mipmaps nem comprimir. Se a imagem ou a
+// qualidade ou o tamanho pedidos mudarem, o cache e refeito. Veja "texturecache.cpp".
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "bcencode.h"
+
+#define TEXTURE_CACHE_VERSION 2
+#define TEXTURE_CACHE_MAX_LEVELS 16
+
+// Formato dos texels de todos os niveis
+enum TextureCacheFormat
+{
+    TEXTURE_CACHE_RGB8 = 1,     // 3 bytes por texel, sRGB, linhas sem alinhamento
+    TEXTURE_CACHE_BC1  = 2,     // Blocos BC1 (8 bytes por 4x4 texels), sRGB
+    TEXTURE_CACHE_BC3  = 3,     // Blocos BC3 (16 bytes por 4x4 texels), sRGB
+    TEXTURE_CACHE_BC7  = 4,     // Blocos BC7 (16 bytes por 4x4 texels), sRGB
+    TEXTURE_CACHE_RGBA8 = 5     // 4 bytes por texel (alpha 255), sRGB: linhas
+                                // alinhadas a 4 bytes, enviadas sem conversao
+};
+
+struct TextureCacheLevel
+{
+    int width, height;
+    const unsigned char* data;
+    size_t size;                // Em bytes
+};
+
+struct CookedTexture
+{
+    int width, height;
+    int format;                 // TextureCacheFormat
+    int num_levels;
+    TextureCacheLevel levels[TEXTURE_CACHE_MAX_LEVELS];
+    bool from_cache;            // Lida do cache (true) ou decodificada (false)
+
+    // Memoria dos niveis: mapeamento do arquivo ou buffer alocado
+    void*  storage;
+    size_t storage_size;
+    bool   mapped;
+};
+
+// Carrega a imagem "filename" com todos os niveis de mipmap, a partir do
+// cache se ele existir e corresponder ao conteudo da imagem; caso contrario
+// decodifica a imagem e grava um cache novo. Pode ser chamada de varias
+// threads ao mesmo tempo, para imagens diferentes. Com width e height maiores que
+// zero, o nivel 0 e a imagem redimensionada para width x height; com zero,
+// a imagem mantem o tamanho original. Nos formatos comprimidos, "quality" e
+// o preset usado ao gerar o cache (ignorado no RGB8) e "num_threads" e o
+// numero de threads da compressao de cada nivel (veja Bc_EncodeImage());
+// quem ja chama de varias threads deve dividir os nucleos entre elas.
+// Retorna false se a imagem nao puder ser lida. Os niveis ficam validos ate
+// TextureCache_Release().
+bool TextureCache_Load(const char* filename, int width, int height, TextureCacheFormat format, BcQuality quality,
+                       int num_threads, CookedTexture* texture);
+
+// Le apenas o cabecalho da imagem "filename" e devolve o seu tamanho.
+// Retorna false se a imagem nao puder ser lida.
+bool TextureCache_ImageSize(const char* filename, int* width, int* height);
+
+// Nome do formato ("rgb8", "rgba8", "bc1", "bc3" ou "bc7")
+const char* TextureCache_FormatName(TextureCacheFormat format);
+
+// Tamanho em bytes de um nivel width x height no formato dado
+size_t TextureCache_LevelSize(TextureCacheFormat format, int width, int height);
+
+void TextureCache_Release(CookedTexture* texture);
+
+// Hash de 64 bits (FNV-1a) usado como chave do conteudo da imagem
+uint64_t TextureCache_Hash(const void* data, size_t size);
+
+#endif // _TEXTURECACHE_H
@@ -0,0 +1,22 @@
+#ifndef _TEXTUREMEMORY_H
+#define _TEXTUREMEMORY_H
+
+// Contabilidade da memoria de texturas na GPU. Cada modulo que aloca uma
+// textura informa seu tamanho (todos os niveis de mipmap, sem o
+// alinhamento interno do driver); o total aparece no HUD de desempenho e o
+// relatorio por textura e impresso com a tecla F4. Veja "texturememory.cpp".
+
+#include <stddef.h>
+
+// Registra ou atualiza a textura "name" com "bytes" bytes; "description"
+// resume o tamanho e o formato (ex.: "1024x512, 11 niveis, bc1"). Com zero
+// bytes, a textura e removida.
+void TextureMemory_Set(const char* name, const char* description, size_t bytes);
+
+// Soma de todas as texturas registradas, em bytes
+size_t TextureMemory_Total();
+
+// Imprime no terminal cada textura, da maior para a menor, e o total
+void TextureMemory_PrintReport();
+
+#endif // _TEXTUREMEMORY_H
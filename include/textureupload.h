@@ -0,0 +1,73 @@
+#ifndef _TEXTUREUPLOAD_H
+#define _TEXTUREUPLOAD_H
+
+// Envio de texturas em partes, com um limite de bytes por quadro. Em vez de
+// enviar todos os niveis de uma imagem de uma vez (o que trava a thread do
+// OpenGL no carregamento), os niveis ficam em uma fila ordenada do menor
+// para o maior e, a cada quadro, TextureUpload_Update() copia ate
+// "budget_bytes" bytes para um anel de pixel buffer objects (PBO) e emite
+// glTexSubImage3D()/glCompressedTexSubImage3D() a partir dele. Niveis
+// maiores que o orcamento sao divididos em faixas de linhas (de blocos, nos
+// formatos comprimidos).
+//
+// O anel tem TEXTURE_UPLOAD_RING_FRAMES segmentos de "budget_bytes"; cada
+// segmento e protegido por uma fence e so e reescrito quando a GPU terminou
+// de ler dele. Se a fence ainda nao foi sinalizada, o quadro nao envia nada
+// (a CPU nunca espera pela GPU). Com GL_ARB_buffer_storage (ou OpenGL 4.4),
+// o buffer e mapeado uma unica vez (persistente e coerente); sem ela, cada
+// segmento e mapeado com glMapBufferRange() sem sincronizacao, ja garantida
+// pelas fences.
+//
+// Como os niveis menores chegam primeiro, os objetos aparecem logo em baixa
+// resolucao e ficam mais nitidos nos quadros seguintes: o GL_TEXTURE_BASE_LEVEL
+// de cada array registrado e o nivel mais fino ja enviado para todas as
+// camadas. Veja "textureupload.cpp".
+
+#include <stddef.h>
+
+#include <glad/glad.h>
+
+#include "texturecache.h"
+
+// Bytes enviados por quadro, se "--texture-upload-budget" nao for usado, e
+// o minimo aceito
+#define TEXTURE_UPLOAD_DEFAULT_BUDGET (2 * 1024 * 1024)
+#define TEXTURE_UPLOAD_MIN_BUDGET     (64 * 1024)
+
+// Segmentos do anel de PBOs (quadros em voo)
+#define TEXTURE_UPLOAD_RING_FRAMES 3
+
+// Unidade de textura usada para ligar as texturas durante o envio
+#define TEXTURE_UPLOAD_TEXTURE_UNIT 29
+
+// Testa se o contexto OpenGL lista a extensao "name"
+bool TextureUpload_HasGLExtension(const char* name);
+
+// Cria o anel de PBOs (requer contexto OpenGL)
+void TextureUpload_Init(size_t budget_bytes);
+
+// Registra um GL_TEXTURE_2D_ARRAY, com todos os niveis ja alocados no
+// formato "internal_format", que passa a receber niveis por
+// TextureUpload_Add(). Ate o primeiro nivel de todas as camadas chegar, o
+// GL_TEXTURE_BASE_LEVEL fica no ultimo nivel.
+void TextureUpload_RegisterArray(GLuint texture, GLenum internal_format, int num_layers, int num_levels);
+
+// Enfileira os niveis de "image" a partir de "first_level" para a camada
+// "layer" do array "texture": o nivel first_level + i da imagem vai para o
+// nivel i do array, e os niveis anteriores nunca sao lidos. A imagem passa
+// a pertencer a este modulo (e liberada quando o ultimo nivel for enviado)
+// e "*image" e zerada.
+void TextureUpload_Add(GLuint texture, int layer, CookedTexture* image, int first_level, const char* name);
+
+// Marca uma camada que nunca recebera niveis (ex.: imagem que nao pode ser
+// lida), para que ela nao impeca as outras de ficarem nitidas
+void TextureUpload_SkipLayer(GLuint texture, int layer);
+
+// Envia ate o orcamento de bytes da fila. Chamada uma vez por quadro, na
+// thread do OpenGL.
+void TextureUpload_Update();
+
+// Bytes ainda na fila
+size_t TextureUpload_PendingBytes();
+
+#endif // _TEXTUREUPLOAD_H
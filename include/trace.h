@@ -0,0 +1,57 @@
+#ifndef _TRACE_H
+#define _TRACE_H
+
+// Rastreamento de zonas (inicio/fim) exportado no formato JSON de "trace
+// events" do Chrome/Perfetto (abra em chrome://tracing ou ui.perfetto.dev).
+//
+// Cada thread grava seus eventos em um buffer proprio (thread-local), sem
+// travas; o mutex global so e usado quando uma thread grava seu primeiro
+// evento. Com o rastreamento desligado em tempo de execucao, cada zona custa
+// apenas uma leitura atomica; compilando com -DTRACE_DISABLED as macros somem
+// por completo. Veja "trace.cpp".
+
+#include <atomic>
+
+extern std::atomic<bool> g_TraceEnabled;
+
+void Trace_SetEnabled(bool enabled);
+void Trace_SetThreadName(const char* name); // Nome exibido para a thread atual
+
+// Zona explicita: Trace_Begin() e Trace_End() devem ser pareados na mesma
+// thread. "name" deve apontar para uma string que viva ate o fim do
+// programa (normalmente um literal); "detail" e copiado.
+void Trace_Begin(const char* name, const char* detail = 0);
+void Trace_End();
+
+// Escreve todos os eventos gravados ate agora. Retorna false em caso de erro.
+bool Trace_WriteJson(const char* filename);
+
+// Zona com escopo: dura da construcao ate o fim do bloco.
+struct TraceScope
+{
+    bool active;
+    TraceScope(const char* name, const char* detail = 0)
+        : active(g_TraceEnabled.load(std::memory_order_relaxed))
+    {
+        if (active)
+            Trace_Begin(name, detail);
+    }
+    ~TraceScope()
+    {
+        if (active)
+            Trace_End();
+    }
+};
+
+#define TRACE_CONCAT_(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_(a, b)
+
+#ifndef TRACE_DISABLED
+#define TRACE_ZONE(name) TraceScope TRACE_CONCAT(trace_scope_, __LINE__)(name)
+#define TRACE_ZONE_DETAIL(name, detail) TraceScope TRACE_CONCAT(trace_scope_, __LINE__)(name, detail)
+#else
+#define TRACE_ZONE(name)
+#define TRACE_ZONE_DETAIL(name, detail)
+#endif
+
+#endif // _TRACE_H
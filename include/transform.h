@@ -0,0 +1,64 @@
+#ifndef _TRANSFORM_H
+#define _TRANSFORM_H
+
+// Transformacao compacta: translacao, rotacao (quaternion unitario) e escala,
+// em 40 bytes, no lugar dos 64 bytes de uma matriz 4x4. A matriz de
+// modelagem T * R * S e montada diretamente a partir do quaternion, sem os
+// produtos de Matrix_Translate() * Matrix_Rotate_*() * Matrix_Scale(), e a
+// inversa e a matriz das normais saem da decomposicao, sem inverter uma
+// matriz 4x4. Ha tambem versoes para matrizes afins quaisquer, usadas pelas
+// entidades da cena (veja "scene.h"). Veja "transform.cpp".
+
+#include <glm/mat4x4.hpp>
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+
+struct Transform
+{
+    glm::vec3 translation;
+    glm::vec4 rotation;     // Quaternion unitario (x, y, z, w)
+    glm::vec3 scale;
+};
+
+// Quaternions, guardados como (x, y, z, w)
+glm::vec4 Quaternion_Identity();
+glm::vec4 Quaternion_AxisAngle(glm::vec3 axis, float angle);
+
+// Rotacao equivalente a Matrix_Rotate_Z(z) * Matrix_Rotate_Y(y) * Matrix_Rotate_X(x)
+glm::vec4 Quaternion_Euler(float x, float y, float z);
+
+// Rotacao "b" seguida da rotacao "a"
+glm::vec4 Quaternion_Multiply(const glm::vec4& a, const glm::vec4& b);
+
+glm::vec3 Quaternion_Rotate(const glm::vec4& q, glm::vec3 v);
+
+Transform Transform_Identity();
+Transform Transform_Make(glm::vec3 translation, const glm::vec4& rotation, glm::vec3 scale);
+
+// Transformacao equivalente a parent * child, calculada sem matrizes. E
+// exata quando a escala do pai e uniforme (uma escala nao uniforme seguida
+// de rotacao nao pode ser representada por translacao, rotacao e escala).
+Transform Transform_Compose(const Transform& parent, const Transform& child);
+
+glm::vec3 Transform_Point(const Transform& t, glm::vec3 p);
+
+// Matriz de modelagem T * R * S
+glm::mat4 Transform_ToMatrix(const Transform& t);
+
+// Inversa de Transform_ToMatrix(t): S^-1 * R^T * T^-1, exata mesmo com
+// escala nao uniforme
+glm::mat4 Transform_InverseMatrix(const Transform& t);
+
+// Matriz das normais, inversa transposta da parte linear de
+// Transform_ToMatrix(t): R * S^-1
+glm::mat4 Transform_NormalMatrix(const Transform& t);
+
+// Inversa de uma matriz afim qualquer (a ultima linha e 0 0 0 1), calculada
+// pelos produtos vetoriais das colunas da parte linear
+glm::mat4 Matrix_AffineInverse(const glm::mat4& m);
+
+// Matriz das normais de uma matriz afim qualquer: inversa transposta da
+// parte linear, sem translacao
+glm::mat4 Matrix_Normal(const glm::mat4& m);
+
+#endif // _TRANSFORM_H
@@ -0,0 +1,649 @@
+// Compressao de texturas em blocos (BC1, BC3 e BC7 modo 6). Veja
+// "bcencode.h".
+//
+// Os 16 texels de um bloco sao guardados por canal (float[4][16]), de forma
+// que a busca do indice mais proximo de cada texel compara 4 texels por vez
+// com cada cor da paleta do bloco, usando as operacoes de "simdvec.h".
+#include <cmath>
+#include <cstring>
+#include <stdint.h>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "bcencode.h"
+#include "simdvec.h"
+
+// Texels de um bloco por canal (R, G, B, A), de 0 a 255
+struct BlockTexels
+{
+    float c[4][16];
+};
+
+static void LoadBlock(const unsigned char* rgba, BlockTexels* t)
+{
+    for (int i = 0; i < 16; ++i)
+        for (int k = 0; k < 4; ++k)
+            t->c[k][i] = rgba[i*4 + k];
+}
+
+static inline float Clamp255(float v)
+{
+    return v < 0.0f ? 0.0f : (v > 255.0f ? 255.0f : v);
+}
+
+// Escolhe, para cada texel, a cor mais proxima da paleta, considerando os
+// canais [first, first + num_channels). Retorna a soma dos erros quadraticos.
+static float FindIndices(const BlockTexels& t, int first, int num_channels,
+                         const float (*palette)[4], int palette_size, int* indices)
+{
+    float total = 0.0f;
+    for (int g = 0; g < 16; g += 4)
+    {
+        SimdVec texels[4];
+        for (int k = 0; k < num_channels; ++k)
+            texels[k] = Simd_Load(&t.c[first + k][g]);
+
+        SimdVec best_error = Simd_Splat(3.0e38f);
+        SimdVec best_index = Simd_Splat(0.0f);
+        for (int e = 0; e < palette_size; ++e)
+        {
+            SimdVec d = Simd_Sub(texels[0], Simd_Splat(palette[e][first]));
+            SimdVec error = Simd_Mul(d, d);
+            for (int k = 1; k < num_channels; ++k)
+            {
+                d = Simd_Sub(texels[k], Simd_Splat(palette[e][first + k]));
+                error = Simd_Add(error, Simd_Mul(d, d));
+            }
+            SimdMask better = Simd_Less(error, best_error);
+            best_error = Simd_Select(better, error, best_error);
+            best_index = Simd_Select(better, Simd_Splat((float)e), best_index);
+        }
+
+        float errors[4], index[4];
+        Simd_Store(errors, best_error);
+        Simd_Store(index, best_index);
+        for (int i = 0; i < 4; ++i)
+        {
+            indices[g + i] = (int)index[i];
+            total += errors[i];
+        }
+    }
+    return total;
+}
+
+// Extremos iniciais: projecoes extremas dos texels no eixo principal
+// (autovetor dominante da covariancia, por iteracao de potencia)
+static void PrincipalEndpoints(const BlockTexels& t, int num_channels, int iterations, float* e0, float* e1)
+{
+    float mean[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    for (int k = 0; k < num_channels; ++k)
+    {
+        for (int i = 0; i < 16; ++i)
+            mean[k] += t.c[k][i];
+        mean[k] /= 16.0f;
+    }
+
+    float cov[4][4] = {};
+    for (int i = 0; i < 16; ++i)
+        for (int a = 0; a < num_channels; ++a)
+            for (int b = a; b < num_channels; ++b)
+                cov[a][b] += (t.c[a][i] - mean[a]) * (t.c[b][i] - mean[b]);
+    for (int a = 0; a < num_channels; ++a)
+        for (int b = 0; b < a; ++b)
+            cov[a][b] = cov[b][a];
+
+    // Comecamos pela diagonal da caixa envolvente, que raramente e
+    // ortogonal ao eixo principal
+    float axis[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    for (int k = 0; k < num_channels; ++k)
+    {
+        float lo = t.c[k][0], hi = t.c[k][0];
+        for (int i = 1; i < 16; ++i)
+        {
+            lo = std::min(lo, t.c[k][i]);
+            hi = std::max(hi, t.c[k][i]);
+        }
+        axis[k] = hi - lo;
+    }
+    for (int it = 0; it < iterations; ++it)
+    {
+        float next[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        float norm = 0.0f;
+        for (int a = 0; a < num_channels; ++a)
+        {
+            for (int b = 0; b < num_channels; ++b)
+                next[a] += cov[a][b] * axis[b];
+            norm = std::max(norm, std::fabs(next[a]));
+        }
+        if (norm < 1e-6f)
+            break;
+        for (int a = 0; a < num_channels; ++a)
+            axis[a] = next[a] / norm;
+    }
+
+    float length2 = 0.0f;
+    for (int k = 0; k < num_channels; ++k)
+        length2 += axis[k] * axis[k];
+
+    float tmin = 0.0f, tmax = 0.0f;
+    if (length2 > 1e-12f)
+    {
+        tmin = 3.0e38f;
+        tmax = -3.0e38f;
+        for (int i = 0; i < 16; ++i)
+        {
+            float p = 0.0f;
+            for (int k = 0; k < num_channels; ++k)
+                p += (t.c[k][i] - mean[k]) * axis[k];
+            tmin = std::min(tmin, p);
+            tmax = std::max(tmax, p);
+        }
+        tmin /= length2;
+        tmax /= length2;
+    }
+    for (int k = 0; k < num_channels; ++k)
+    {
+        e0[k] = Clamp255(mean[k] + axis[k] * tmin);
+        e1[k] = Clamp255(mean[k] + axis[k] * tmax);
+    }
+}
+
+// Extremos que minimizam o erro quadratico para os pesos (posicao na
+// paleta, de 0 a 1) escolhidos para cada texel. Retorna false se o sistema
+// for degenerado (todos os texels com o mesmo peso).
+static bool RefineEndpoints(const BlockTexels& t, int num_channels, const float* weights, float* e0, float* e1)
+{
+    float a = 0.0f, b = 0.0f, c = 0.0f;
+    float x0[4] = { 0.0f, 0.0f, 0.0f, 0.0f }, x1[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    for (int i = 0; i < 16; ++i)
+    {
+        float w = weights[i];
+        a += (1.0f - w) * (1.0f - w);
+        b += (1.0f - w) * w;
+        c += w * w;
+        for (int k = 0; k < num_channels; ++k)
+        {
+            x0[k] += (1.0f - w) * t.c[k][i];
+            x1[k] += w * t.c[k][i];
+        }
+    }
+
+    float det = a * c - b * b;
+    if (std::fabs(det) < 1e-6f)
+        return false;
+    for (int k = 0; k < num_channels; ++k)
+    {
+        e0[k] = Clamp255((c * x0[k] - b * x1[k]) / det);
+        e1[k] = Clamp255((a * x1[k] - b * x0[k]) / det);
+    }
+    return true;
+}
+
+// Iteracoes de potencia (eixo principal) e de refinamento por preset
+static const int g_PcaIterations[3]    = { 2, 6, 8 };
+static const int g_RefineIterations[3] = { 0, 2, 6 };
+
+// ----------------------------------------------------------------------------
+// BC1
+
+static uint16_t To565(const float* c)
+{
+    int r = (int)(c[0] * 31.0f / 255.0f + 0.5f);
+    int g = (int)(c[1] * 63.0f / 255.0f + 0.5f);
+    int b = (int)(c[2] * 31.0f / 255.0f + 0.5f);
+    return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+static void From565(uint16_t v, int* rgb)
+{
+    int r = (v >> 11) & 31, g = (v >> 5) & 63, b = v & 31;
+    rgb[0] = (r << 3) | (r >> 2);
+    rgb[1] = (g << 2) | (g >> 4);
+    rgb[2] = (b << 3) | (b >> 2);
+}
+
+// Paleta do modo de 4 cores: c0, c1, (2*c0 + c1)/3 e (c0 + 2*c1)/3
+static void Bc1Palette(uint16_t c0, uint16_t c1, int palette[4][4])
+{
+    From565(c0, palette[0]);
+    From565(c1, palette[1]);
+    for (int k = 0; k < 3; ++k)
+    {
+        palette[2][k] = (2*palette[0][k] + palette[1][k]) / 3;
+        palette[3][k] = (palette[0][k] + 2*palette[1][k]) / 3;
+    }
+    for (int e = 0; e < 4; ++e)
+        palette[e][3] = 255;
+}
+
+// Posicao de cada indice do BC1 entre c0 (0) e c1 (1)
+static const float g_Bc1Weights[4] = { 0.0f, 1.0f, 1.0f/3.0f, 2.0f/3.0f };
+
+static void EncodeBc1Color(const BlockTexels& t, BcQuality quality, unsigned char* block)
+{
+    float e0[4], e1[4];
+    PrincipalEndpoints(t, 3, g_PcaIterations[quality], e0, e1);
+
+    uint16_t best_c0 = 0, best_c1 = 0;
+    int best_indices[16] = {};
+    float best_error = 3.0e38f;
+    for (int it = 0; ; ++it)
+    {
+        uint16_t c0 = To565(e0), c1 = To565(e1);
+        int ipalette[4][4];
+        Bc1Palette(c0, c1, ipalette);
+        float palette[4][4];
+        for (int e = 0; e < 4; ++e)
+            for (int k = 0; k < 4; ++k)
+                palette[e][k] = (float)ipalette[e][k];
+
+        int indices[16];
+        float error = FindIndices(t, 0, 3, palette, 4, indices);
+        if (error < best_error)
+        {
+            best_error = error;
+            best_c0 = c0;
+            best_c1 = c1;
+            memcpy(best_indices, indices, sizeof(indices));
+        }
+
+        if (it == g_RefineIterations[quality] || error == 0.0f)
+            break;
+        float weights[16];
+        for (int i = 0; i < 16; ++i)
+            weights[i] = g_Bc1Weights[indices[i]];
+        if (!RefineEndpoints(t, 3, weights, e0, e1))
+            break;
+    }
+
+    // O modo de 4 cores exige c0 > c1; trocar os extremos troca os indices
+    // 0 <-> 1 e 2 <-> 3
+    if (best_c0 == best_c1)
+    {
+        for (int i = 0; i < 16; ++i)
+            best_indices[i] = 0;
+    }
+    else if (best_c0 < best_c1)
+    {
+        std::swap(best_c0, best_c1);
+        for (int i = 0; i < 16; ++i)
+            best_indices[i] ^= 1;
+    }
+
+    uint32_t bits = 0;
+    for (int i = 0; i < 16; ++i)
+        bits |= (uint32_t)best_indices[i] << (2*i);
+    block[0] = best_c0 & 0xFF;
+    block[1] = best_c0 >> 8;
+    block[2] = best_c1 & 0xFF;
+    block[3] = best_c1 >> 8;
+    for (int i = 0; i < 4; ++i)
+        block[4 + i] = (bits >> (8*i)) & 0xFF;
+}
+
+static void DecodeBc1Color(const unsigned char* block, bool always_four_colors, unsigned char* rgba)
+{
+    uint16_t c0 = block[0] | (block[1] << 8);
+    uint16_t c1 = block[2] | (block[3] << 8);
+    int palette[4][4];
+    Bc1Palette(c0, c1, palette);
+
+    // Modo de 3 cores (somente BC1): media e preto transparente
+    if (!always_four_colors && c0 <= c1)
+    {
+        for (int k = 0; k < 3; ++k)
+        {
+            palette[2][k] = (palette[0][k] + palette[1][k]) / 2;
+            palette[3][k] = 0;
+        }
+        palette[3][3] = 0;
+    }
+
+    uint32_t bits = block[4] | (block[5] << 8) | (block[6] << 16) | ((uint32_t)block[7] << 24);
+    for (int i = 0; i < 16; ++i)
+    {
+        int index = (bits >> (2*i)) & 3;
+        for (int k = 0; k < 4; ++k)
+            rgba[i*4 + k] = (unsigned char)palette[index][k];
+    }
+}
+
+// ----------------------------------------------------------------------------
+// BC3: bloco de alpha (8 bytes) seguido de um bloco de cor do BC1
+
+static void Bc3AlphaPalette(int a0, int a1, int* palette)
+{
+    palette[0] = a0;
+    palette[1] = a1;
+    if (a0 > a1)
+    {
+        for (int k = 1; k <= 6; ++k)
+            palette[1 + k] = ((7 - k) * a0 + k * a1) / 7;
+    }
+    else
+    {
+        for (int k = 1; k <= 4; ++k)
+            palette[1 + k] = ((5 - k) * a0 + k * a1) / 5;
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+}
+
+static void EncodeBc3Alpha(const BlockTexels& t, unsigned char* block)
+{
+    int lo = 255, hi = 0;
+    for (int i = 0; i < 16; ++i)
+    {
+        lo = std::min(lo, (int)t.c[3][i]);
+        hi = std::max(hi, (int)t.c[3][i]);
+    }
+
+    // a0 > a1: modo de 8 valores interpolados entre o maior e o menor alpha
+    int indices[16] = {};
+    if (hi != lo)
+    {
+        int ipalette[8];
+        Bc3AlphaPalette(hi, lo, ipalette);
+        float palette[8][4];
+        for (int e = 0; e < 8; ++e)
+            palette[e][3] = (float)ipalette[e];
+        FindIndices(t, 3, 1, palette, 8, indices);
+    }
+
+    block[0] = (unsigned char)hi;
+    block[1] = (unsigned char)lo;
+    uint64_t bits = 0;
+    for (int i = 0; i < 16; ++i)
+        bits |= (uint64_t)indices[i] << (3*i);
+    for (int i = 0; i < 6; ++i)
+        block[2 + i] = (bits >> (8*i)) & 0xFF;
+}
+
+static void DecodeBc3Alpha(const unsigned char* block, unsigned char* rgba)
+{
+    int palette[8];
+    Bc3AlphaPalette(block[0], block[1], palette);
+    uint64_t bits = 0;
+    for (int i = 0; i < 6; ++i)
+        bits |= (uint64_t)block[2 + i] << (8*i);
+    for (int i = 0; i < 16; ++i)
+        rgba[i*4 + 3] = (unsigned char)palette[(bits >> (3*i)) & 7];
+}
+
+// ----------------------------------------------------------------------------
+// BC7, modo 6: extremos RGBA de 7 bits com um bit p cada (8 bits efetivos),
+// 16 indices de 4 bits
+
+static const int g_Bc7Weights4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+// Bits de um bloco de 128 bits, do menos para o mais significativo
+struct BitWriter
+{
+    unsigned char* data;
+    int position;
+
+    void Write(uint32_t value, int bits)
+    {
+        for (int i = 0; i < bits; ++i, ++position)
+            if (value & (1u << i))
+                data[position >> 3] |= (unsigned char)(1u << (position & 7));
+    }
+};
+
+struct BitReader
+{
+    const unsigned char* data;
+    int position;
+
+    uint32_t Read(int bits)
+    {
+        uint32_t value = 0;
+        for (int i = 0; i < bits; ++i, ++position)
+            value |= (uint32_t)((data[position >> 3] >> (position & 7)) & 1) << i;
+        return value;
+    }
+};
+
+// Quantiza um extremo para 7 bits com o bit p dado. Retorna o erro
+// quadratico da quantizacao.
+static float QuantizeBc7(const float* e, int p, int* q)
+{
+    float error = 0.0f;
+    for (int k = 0; k < 4; ++k)
+    {
+        int v = (int)std::floor((e[k] - p) / 2.0f + 0.5f);
+        q[k] = std::max(0, std::min(127, v));
+        float d = (float)(q[k]*2 + p) - e[k];
+        error += d * d;
+    }
+    return error;
+}
+
+static void Bc7Palette(const int* q0, int p0, const int* q1, int p1, float palette[16][4])
+{
+    for (int e = 0; e < 16; ++e)
+        for (int k = 0; k < 4; ++k)
+        {
+            int a = q0[k]*2 + p0, b = q1[k]*2 + p1;
+            palette[e][k] = (float)(((64 - g_Bc7Weights4[e]) * a + g_Bc7Weights4[e] * b + 32) >> 6);
+        }
+}
+
+static void EncodeBc7(const BlockTexels& t, BcQuality quality, unsigned char* block)
+{
+    float e0[4], e1[4];
+    PrincipalEndpoints(t, 4, g_PcaIterations[quality], e0, e1);
+
+    int best_q0[4] = {}, best_q1[4] = {}, best_p0 = 0, best_p1 = 0;
+    int best_indices[16] = {};
+    float best_error = 3.0e38f;
+    for (int it = 0; ; ++it)
+    {
+        // No preset de maior qualidade todas as combinacoes de bits p sao
+        // avaliadas; nos demais, cada extremo usa o bit p que o quantiza melhor
+        int first_combination = 0, last_combination = 3;
+        if (quality != BC_QUALITY_HIGH)
+        {
+            int q[4];
+            int p0 = QuantizeBc7(e0, 1, q) < QuantizeBc7(e0, 0, q) ? 1 : 0;
+            int p1 = QuantizeBc7(e1, 1, q) < QuantizeBc7(e1, 0, q) ? 1 : 0;
+            first_combination = last_combination = p0 | (p1 << 1);
+        }
+
+        int indices[16];
+        float error = 3.0e38f;
+        for (int combination = first_combination; combination <= last_combination; ++combination)
+        {
+            int p0 = combination & 1, p1 = combination >> 1;
+            int q0[4], q1[4];
+            QuantizeBc7(e0, p0, q0);
+            QuantizeBc7(e1, p1, q1);
+            float palette[16][4];
+            Bc7Palette(q0, p0, q1, p1, palette);
+
+            int candidate[16];
+            float candidate_error = FindIndices(t, 0, 4, palette, 16, candidate);
+            if (candidate_error < error)
+            {
+                error = candidate_error;
+                memcpy(indices, candidate, sizeof(indices));
+            }
+            if (candidate_error < best_error)
+            {
+                best_error = candidate_error;
+                memcpy(best_q0, q0, sizeof(q0));
+                memcpy(best_q1, q1, sizeof(q1));
+                best_p0 = p0;
+                best_p1 = p1;
+                memcpy(best_indices, candidate, sizeof(candidate));
+            }
+        }
+
+        if (it == g_RefineIterations[quality] || error == 0.0f)
+            break;
+        float weights[16];
+        for (int i = 0; i < 16; ++i)
+            weights[i] = g_Bc7Weights4[indices[i]] / 64.0f;
+        if (!RefineEndpoints(t, 4, weights, e0, e1))
+            break;
+    }
+
+    // O bit mais significativo do indice do texel 0 (ancora) e implicito e
+    // deve ser zero: se nao for, trocamos os extremos e invertemos os indices
+    if (best_indices[0] >= 8)
+    {
+        for (int k = 0; k < 4; ++k)
+            std::swap(best_q0[k], best_q1[k]);
+        std::swap(best_p0, best_p1);
+        for (int i = 0; i < 16; ++i)
+            best_indices[i] = 15 - best_indices[i];
+    }
+
+    memset(block, 0, 16);
+    BitWriter writer = { block, 0 };
+    writer.Write(1 << 6, 7);
+    for (int k = 0; k < 4; ++k)
+    {
+        writer.Write(best_q0[k], 7);
+        writer.Write(best_q1[k], 7);
+    }
+    writer.Write(best_p0, 1);
+    writer.Write(best_p1, 1);
+    writer.Write(best_indices[0], 3);
+    for (int i = 1; i < 16; ++i)
+        writer.Write(best_indices[i], 4);
+}
+
+static void DecodeBc7(const unsigned char* block, unsigned char* rgba)
+{
+    BitReader reader = { block, 0 };
+    if (reader.Read(7) != (1u << 6))
+    {
+        memset(rgba, 0, 64);
+        return;
+    }
+
+    int q0[4], q1[4];
+    for (int k = 0; k < 4; ++k)
+    {
+        q0[k] = reader.Read(7);
+        q1[k] = reader.Read(7);
+    }
+    int p0 = reader.Read(1), p1 = reader.Read(1);
+    float palette[16][4];
+    Bc7Palette(q0, p0, q1, p1, palette);
+
+    for (int i = 0; i < 16; ++i)
+    {
+        int index = reader.Read(i == 0 ? 3 : 4);
+        for (int k = 0; k < 4; ++k)
+            rgba[i*4 + k] = (unsigned char)palette[index][k];
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+int Bc_BlockSize(BcFormat format)
+{
+    return format == BC_FORMAT_BC1 ? 8 : 16;
+}
+
+size_t Bc_CompressedSize(BcFormat format, int width, int height)
+{
+    return (size_t)((width + 3) / 4) * ((height + 3) / 4) * Bc_BlockSize(format);
+}
+
+const char* Bc_FormatName(BcFormat format)
+{
+    static const char* const names[] = { "BC1", "BC3", "BC7" };
+    return names[format];
+}
+
+const char* Bc_QualityName(BcQuality quality)
+{
+    static const char* const names[] = { "fast", "normal", "high" };
+    return names[quality];
+}
+
+void Bc_EncodeBlock(BcFormat format, BcQuality quality, const unsigned char* rgba, unsigned char* block)
+{
+    BlockTexels t;
+    LoadBlock(rgba, &t);
+    switch (format)
+    {
+    case BC_FORMAT_BC1:
+        EncodeBc1Color(t, quality, block);
+        break;
+    case BC_FORMAT_BC3:
+        EncodeBc3Alpha(t, block);
+        EncodeBc1Color(t, quality, block + 8);
+        break;
+    case BC_FORMAT_BC7:
+        EncodeBc7(t, quality, block);
+        break;
+    }
+}
+
+void Bc_DecodeBlock(BcFormat format, const unsigned char* block, unsigned char* rgba)
+{
+    switch (format)
+    {
+    case BC_FORMAT_BC1:
+        DecodeBc1Color(block, false, rgba);
+        break;
+    case BC_FORMAT_BC3:
+        DecodeBc1Color(block + 8, true, rgba);
+        DecodeBc3Alpha(block, rgba);
+        break;
+    case BC_FORMAT_BC7:
+        DecodeBc7(block, rgba);
+        break;
+    }
+}
+
+// Comprime as linhas de blocos obtidas de "next_row" ate acabarem
+static void EncodeRows(BcFormat format, BcQuality quality, const unsigned char* pixels, int width, int height,
+                       int channels, unsigned char* out, std::atomic<int>* next_row)
+{
+    int blocks_x = (width + 3) / 4;
+    int blocks_y = (height + 3) / 4;
+    int block_size = Bc_BlockSize(format);
+    unsigned char rgba[64];
+    for (int by = next_row->fetch_add(1); by < blocks_y; by = next_row->fetch_add(1))
+    {
+        for (int bx = 0; bx < blocks_x; ++bx)
+        {
+            for (int i = 0; i < 16; ++i)
+            {
+                int x = std::min(bx*4 + (i & 3), width - 1);
+                int y = std::min(by*4 + (i >> 2), height - 1);
+                const unsigned char* p = &pixels[((size_t)y * width + x) * channels];
+                rgba[i*4 + 0] = p[0];
+                rgba[i*4 + 1] = p[1];
+                rgba[i*4 + 2] = p[2];
+                rgba[i*4 + 3] = channels == 4 ? p[3] : 255;
+            }
+            Bc_EncodeBlock(format, quality, rgba, &out[((size_t)by * blocks_x + bx) * block_size]);
+        }
+    }
+}
+
+void Bc_EncodeImage(BcFormat format, BcQuality quality, const unsigned char* pixels, int width, int height,
+                    int channels, unsigned char* out, int num_threads)
+{
+    int blocks_y = (height + 3) / 4;
+    if (num_threads <= 0)
+        num_threads = std::max(1, (int)std::thread::hardware_concurrency());
+    num_threads = std::min(num_threads, blocks_y);
+
+    // As linhas de blocos sao distribuidas dinamicamente, uma por vez
+    std::atomic<int> next_row(0);
+    std::vector<std::thread> threads;
+    for (int i = 1; i < num_threads; ++i)
+        threads.push_back(std::thread(EncodeRows, format, quality, pixels, width, height, channels, out, &next_row));
+    EncodeRows(format, quality, pixels, width, height, channels, out, &next_row);
+    for (size_t i = 0; i < threads.size(); ++i)
+        threads[i].join();
+}
@@ -0,0 +1,950 @@
+// Modo de benchmark sem interacao. Veja "benchmark.h".
+#include <cmath>
+#include <chrono>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+#include <glm/vec4.hpp>
+#include <glm/mat4x4.hpp>
+#include <glm/matrix.hpp>
+
+#include <stb_image.h>
+
+#include "benchmark.h"
+#include "bcencode.h"
+#include "collisions.h"
+#include "matrices.h"
+#include "picking.h"
+#include "profiler.h"
+#include "projectiles.h"
+#include "scene.h"
+#include "simdmath.h"
+#include "transform.h"
+
+// Numero de quadros gastos para percorrer cada trecho do caminho
+#define BENCHMARK_FRAMES_PER_SEGMENT 90
+
+// Pontos do caminho (no plano XZ) percorrido pela camera em cada sala. Os
+// limites das salas sao as paredes (wall_x, wall_y) de data/scene.txt: a
+// sala 1 vai de x=-12 a x=12 e de z=-16 a z=4, a sala 2 de x=-16 a x=16 e
+// de z=-28 a z=4, e a sala 3 de x=-8 a x=8 e de z=-12 a z=4.
+struct BenchmarkWaypoint
+{
+    int   room;
+    float x, z;
+};
+
+static const BenchmarkWaypoint g_BenchmarkPath[] = {
+    { 1,   0.0f,   2.0f }, { 1,  -6.0f,  -4.0f }, { 1,  -6.0f, -12.0f },
+    { 1,   6.0f, -12.0f }, { 1,   6.0f,  -4.0f }, { 1,   0.0f,   2.0f },
+    { 2,   0.0f,   2.0f }, { 2, -10.0f,  -6.0f }, { 2, -10.0f, -22.0f },
+    { 2,  10.0f, -22.0f }, { 2,  10.0f,  -6.0f }, { 2,   0.0f,   2.0f },
+    { 3,   0.0f,   2.0f }, { 3,  -4.0f,  -4.0f }, { 3,  -4.0f,  -9.0f },
+    { 3,   4.0f,  -9.0f }, { 3,   4.0f,  -4.0f }, { 3,   0.0f,   2.0f },
+};
+
+static const int g_BenchmarkPathLength = sizeof(g_BenchmarkPath) / sizeof(g_BenchmarkPath[0]);
+
+// Amostras gravadas a cada quadro
+struct BenchmarkSample
+{
+    int                room;
+    ProfilerFrameStats stats;
+};
+
+static std::vector<BenchmarkSample> g_BenchmarkSamples;
+static double g_BenchmarkLoadTime = 0.0;
+static GLuint g_BenchmarkFramebuffer = 0;
+
+void Benchmark_Init(double load_time_seconds)
+{
+    g_BenchmarkLoadTime = load_time_seconds;
+
+    GLuint color_renderbuffer, depth_renderbuffer;
+    glGenRenderbuffers(1, &color_renderbuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, color_renderbuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, BENCHMARK_WIDTH, BENCHMARK_HEIGHT);
+
+    glGenRenderbuffers(1, &depth_renderbuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, depth_renderbuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, BENCHMARK_WIDTH, BENCHMARK_HEIGHT);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+    glGenFramebuffers(1, &g_BenchmarkFramebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, g_BenchmarkFramebuffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, color_renderbuffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depth_renderbuffer);
+
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+        fprintf(stderr, "ERROR: Benchmark framebuffer is incomplete.\n");
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    int num_frames = (g_BenchmarkPathLength - 1) * BENCHMARK_FRAMES_PER_SEGMENT;
+    g_BenchmarkSamples.reserve(num_frames);
+
+    printf("Benchmark: %d quadros em %dx%d.\n", num_frames, BENCHMARK_WIDTH, BENCHMARK_HEIGHT);
+}
+
+void Benchmark_BindFramebuffer()
+{
+    glBindFramebuffer(GL_FRAMEBUFFER, g_BenchmarkFramebuffer);
+    glViewport(0, 0, BENCHMARK_WIDTH, BENCHMARK_HEIGHT);
+}
+
+bool Benchmark_CameraAtFrame(int frame, BenchmarkCamera* camera)
+{
+    int segment = frame / BENCHMARK_FRAMES_PER_SEGMENT;
+    if (segment >= g_BenchmarkPathLength - 1)
+        return false;
+
+    const BenchmarkWaypoint& a = g_BenchmarkPath[segment];
+    const BenchmarkWaypoint& b = g_BenchmarkPath[segment + 1];
+
+    // Trechos entre salas diferentes sao "teletransportes": ficamos parados
+    // no primeiro ponto da proxima sala.
+    if (a.room != b.room)
+    {
+        camera->room  = b.room;
+        camera->x     = b.x;
+        camera->z     = b.z;
+        camera->theta = 3.141592f;
+        camera->phi   = -0.15f;
+        return true;
+    }
+
+    float t = (float)(frame % BENCHMARK_FRAMES_PER_SEGMENT) / BENCHMARK_FRAMES_PER_SEGMENT;
+    float dx = b.x - a.x;
+    float dz = b.z - a.z;
+
+    camera->room  = a.room;
+    camera->x     = a.x + t*dx;
+    camera->z     = a.z + t*dz;
+    camera->theta = atan2f(dx, dz); // Olhamos na direcao do movimento
+    camera->phi   = -0.15f;
+    return true;
+}
+
+void Benchmark_RecordFrame(int room)
+{
+    BenchmarkSample sample;
+    sample.room = room;
+    if (Profiler_GetLastFrame(&sample.stats))
+        g_BenchmarkSamples.push_back(sample);
+}
+
+// Resumo estatistico de uma lista de valores (a lista e reordenada)
+struct BenchmarkSummary
+{
+    double mean, p50, p95, p99, max;
+};
+
+static BenchmarkSummary Summarize(std::vector<double>& values)
+{
+    BenchmarkSummary s = { 0.0, 0.0, 0.0, 0.0, 0.0 };
+    if (values.empty())
+        return s;
+
+    std::sort(values.begin(), values.end());
+    double sum = 0.0;
+    for (size_t i = 0; i < values.size(); ++i)
+        sum += values[i];
+
+    size_t last = values.size() - 1;
+    s.mean = sum / values.size();
+    s.p50  = values[(size_t)(0.50 * last + 0.5)];
+    s.p95  = values[(size_t)(0.95 * last + 0.5)];
+    s.p99  = values[(size_t)(0.99 * last + 0.5)];
+    s.max  = values[last];
+    return s;
+}
+
+// Coleta um campo das amostras de uma sala (room = 0 para todas), ignorando
+// valores negativos (tempos de GPU que nao ficaram prontos) e o primeiro
+// quadro, que nao possui intervalo.
+static std::vector<double> Collect(int room, double ProfilerFrameStats::*field)
+{
+    std::vector<double> values;
+    for (size_t i = 0; i < g_BenchmarkSamples.size(); ++i)
+    {
+        const BenchmarkSample& s = g_BenchmarkSamples[i];
+        if ((room == 0 || s.room == room) && s.stats.*field > 0.0)
+            values.push_back(s.stats.*field);
+    }
+    return values;
+}
+
+static void WriteSummary(FILE* file, const char* name, std::vector<double> values, bool last)
+{
+    BenchmarkSummary s = Summarize(values);
+    fprintf(file, "    \"%s\": { \"mean\": %.4f, \"p50\": %.4f, \"p95\": %.4f, \"p99\": %.4f, \"max\": %.4f }%s\n",
+            name, s.mean, s.p50, s.p95, s.p99, s.max, last ? "" : ",");
+}
+
+bool Benchmark_WriteReport(const char* filename)
+{
+    FILE* file = fopen(filename, "w");
+    if (file == NULL)
+    {
+        fprintf(stderr, "ERROR: Cannot open file \"%s\".\n", filename);
+        return false;
+    }
+
+    double draws_sum = 0.0, triangles_sum = 0.0;
+    int draws_max = 0;
+    long triangles_max = 0;
+    for (size_t i = 0; i < g_BenchmarkSamples.size(); ++i)
+    {
+        const ProfilerFrameStats& s = g_BenchmarkSamples[i].stats;
+        draws_sum += s.draws;
+        triangles_sum += s.triangles;
+        draws_max = std::max(draws_max, s.draws);
+        triangles_max = std::max(triangles_max, s.triangles);
+    }
+    double n = g_BenchmarkSamples.empty() ? 1.0 : (double)g_BenchmarkSamples.size();
+
+    fprintf(file, "{\n");
+    fprintf(file, "  \"resolution\": [%d, %d],\n", BENCHMARK_WIDTH, BENCHMARK_HEIGHT);
+    fprintf(file, "  \"frames\": %lu,\n", (unsigned long)g_BenchmarkSamples.size());
+    fprintf(file, "  \"load_time_s\": %.4f,\n", g_BenchmarkLoadTime);
+    fprintf(file, "  \"draws\": { \"mean\": %.2f, \"max\": %d },\n", draws_sum / n, draws_max);
+    fprintf(file, "  \"triangles\": { \"mean\": %.1f, \"max\": %ld },\n", triangles_sum / n, triangles_max);
+    fprintf(file, "  \"total\": {\n");
+    WriteSummary(file, "frame_ms", Collect(0, &ProfilerFrameStats::frame_ms), false);
+    WriteSummary(file, "cpu_ms", Collect(0, &ProfilerFrameStats::cpu_ms), false);
+    WriteSummary(file, "gpu_ms", Collect(0, &ProfilerFrameStats::gpu_ms), true);
+    fprintf(file, "  },\n");
+    fprintf(file, "  \"rooms\": [\n");
+    for (int room = 1; room <= 3; ++room)
+    {
+        fprintf(file, "   {\n    \"room\": %d,\n", room);
+        WriteSummary(file, "frame_ms", Collect(room, &ProfilerFrameStats::frame_ms), false);
+        WriteSummary(file, "gpu_ms", Collect(room, &ProfilerFrameStats::gpu_ms), true);
+        fprintf(file, "   }%s\n", room < 3 ? "," : "");
+    }
+    fprintf(file, "  ]\n}\n");
+    fclose(file);
+
+    std::vector<double> frame_ms = Collect(0, &ProfilerFrameStats::frame_ms);
+    BenchmarkSummary total = Summarize(frame_ms);
+    printf("Benchmark: carregamento %.2f s, quadro p50 %.2f p95 %.2f p99 %.2f ms, %.0f tris/quadro. Relatorio em \"%s\".\n",
+           g_BenchmarkLoadTime, total.p50, total.p95, total.p99, triangles_sum / n, filename);
+    return true;
+}
+
+// Gerador pseudo-aleatorio simples (LCG), para que os microbenchmarks usem
+// sempre os mesmos dados
+static unsigned int g_BenchmarkRandomState = 1;
+
+static float BenchmarkRandom(float min_value, float max_value)
+{
+    g_BenchmarkRandomState = g_BenchmarkRandomState * 1664525u + 1013904223u;
+    float u = (g_BenchmarkRandomState >> 8) / 16777216.0f;
+    return min_value + u * (max_value - min_value);
+}
+
+// Executa as consultas de colisao e retorna o tempo medio por consulta em ns
+static double RunCollisionQueries(const std::vector<glm::vec4>& starts, const std::vector<glm::vec4>& moves, float* checksum)
+{
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < starts.size(); ++i)
+    {
+        glm::vec4 p = CollisionWorld_MoveCapsule(starts[i], moves[i], 0.5f, -7.0f, 0.3f);
+        *checksum += p.x + p.z;
+    }
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - begin).count() / starts.size();
+}
+
+void Benchmark_Collision()
+{
+    const int num_queries = 200000;
+    const int sizes[] = { 16, 64, 256, 1024, 4096 };
+
+    printf("Colisao: %d consultas de capsula varrida por mundo.\n", num_queries);
+    printf("%8s %14s %14s %10s\n", "caixas", "grade (ns)", "exaustiva (ns)", "speedup");
+
+    float checksum = 0.0f;
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s)
+    {
+        // Mundo com densidade constante (como salas sendo adicionadas): as
+        // caixas ocupam uma area proporcional ao seu numero
+        g_BenchmarkRandomState = 1;
+        int num_boxes = sizes[s];
+        float half_side = 2.0f * std::sqrt((float)num_boxes);
+
+        CollisionWorld_Clear();
+        for (int i = 0; i < num_boxes; ++i)
+        {
+            float angle = BenchmarkRandom(0.0f, 3.141592f);
+            CollisionWorld_AddBox(glm::vec4(BenchmarkRandom(-half_side, half_side), -4.0f, BenchmarkRandom(-half_side, half_side), 1.0f),
+                                  glm::vec4(BenchmarkRandom(0.1f, 1.5f), 4.0f, BenchmarkRandom(0.1f, 1.5f), 0.0f),
+                                  glm::vec4(std::cos(angle), 0.0f, std::sin(angle), 0.0f));
+        }
+
+        // Deslocamentos de um passo de simulacao, com alguns quadros longos
+        std::vector<glm::vec4> starts(num_queries), moves(num_queries);
+        for (int i = 0; i < num_queries; ++i)
+        {
+            float length = (i % 16 == 0) ? 1.25f : 0.05f;
+            float angle = BenchmarkRandom(0.0f, 2.0f * 3.141592f);
+            starts[i] = glm::vec4(BenchmarkRandom(-half_side, half_side), 0.0f, BenchmarkRandom(-half_side, half_side), 0.0f);
+            moves[i] = glm::vec4(length * std::cos(angle), 0.0f, length * std::sin(angle), 0.0f);
+        }
+
+        CollisionWorld_Build(4.0f);
+        double grid_ns = RunCollisionQueries(starts, moves, &checksum);
+
+        // Uma unica celula cobrindo todo o mundo equivale a testar todas as caixas
+        CollisionWorld_Build(1e9f);
+        double brute_ns = RunCollisionQueries(starts, moves, &checksum);
+
+        printf("%8d %14.1f %14.1f %9.1fx\n", num_boxes, grid_ns, brute_ns, brute_ns / grid_ns);
+    }
+
+    // Deslizamento rente a uma parede em angulos rasos: a capsula nunca pode
+    // terminar dentro da parede, mesmo com o erro acumulado dos passos
+    const int num_slide_steps = 10000; // Por angulo da parede e do movimento
+    const float radius = 0.5f, half_thickness = 0.05f;
+    const float wall_angles[] = { 0.0f, 0.3f, 1.1f };
+    const float move_angles[] = { 0.001f, 0.01f, 0.1f };
+    float max_penetration = 0.0f;
+    for (size_t w = 0; w < sizeof(wall_angles) / sizeof(wall_angles[0]); ++w)
+    {
+        float ax = std::cos(wall_angles[w]), az = std::sin(wall_angles[w]);
+        CollisionWorld_Clear();
+        CollisionWorld_AddBox(glm::vec4(0.0f, -4.0f, 0.0f, 1.0f), glm::vec4(1000.0f, 4.0f, half_thickness, 0.0f),
+                              glm::vec4(ax, 0.0f, az, 0.0f));
+        CollisionWorld_Build(4.0f);
+
+        for (size_t m = 0; m < sizeof(move_angles) / sizeof(move_angles[0]); ++m)
+        {
+            // Posicao e deslocamento no sistema da parede: ao longo de X,
+            // entrando um pouco na parede (-Z)
+            float u = -500.0f, v = half_thickness + radius + 0.01f;
+            glm::vec4 position(u*ax - v*az, 0.0f, u*az + v*ax, 0.0f);
+            float du = 0.05f * std::cos(move_angles[m]), dv = -0.05f * std::sin(move_angles[m]);
+            glm::vec4 move(du*ax - dv*az, 0.0f, du*az + dv*ax, 0.0f);
+            for (int i = 0; i < num_slide_steps; ++i)
+            {
+                position = CollisionWorld_MoveCapsule(position, move, radius, -7.0f, 0.3f);
+                float distance = -position.x*az + position.z*ax;
+                max_penetration = std::max(max_penetration, half_thickness + radius - distance);
+            }
+        }
+    }
+    CollisionWorld_Clear();
+    printf("Deslizamento rente a parede: %d passos, penetracao maxima %.6f (%s)\n",
+           num_slide_steps * 9, max_penetration, max_penetration < 1e-3f ? "ok" : "FALHA");
+
+    printf("(checksum %.3f)\n", checksum);
+}
+
+// Conjunto usado no benchmark (grande demais para a pilha)
+static ProjectilePool g_BenchmarkProjectiles;
+
+void Benchmark_Projectiles()
+{
+    const int num_steps = 2000;
+    const float dt = 1.0f / 120.0f;
+    const int sizes[] = { 100, 1000, 4000, PROJECTILE_CAPACITY };
+
+    printf("Projeteis: %d passos de simulacao (integracao e remocao).\n", num_steps);
+    printf("%8s %16s %16s %10s\n", "projeteis", "SoA (ns/proj)", "vector (ns/proj)", "speedup");
+
+    float checksum = 0.0f;
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s)
+    {
+        int num_projectiles = sizes[s];
+
+        // Conjunto SoA: os projeteis que expiram sao relancados a cada passo,
+        // mantendo o conjunto cheio
+        g_BenchmarkRandomState = 1;
+        Projectiles_Clear(&g_BenchmarkProjectiles);
+        std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+        for (int step = 0; step < num_steps; ++step)
+        {
+            while (g_BenchmarkProjectiles.count < num_projectiles)
+                Projectiles_Spawn(&g_BenchmarkProjectiles,
+                                  glm::vec4(BenchmarkRandom(-10.0f, 10.0f), -3.8f, 2.0f, 1.0f),
+                                  glm::vec4(0.0f, 0.0f, -20.0f, 0.0f),
+                                  BenchmarkRandom(0.1f, 0.7f));
+            Projectiles_Integrate(&g_BenchmarkProjectiles, dt);
+            Projectiles_RemoveExpired(&g_BenchmarkProjectiles);
+            checksum += g_BenchmarkProjectiles.count;
+        }
+        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        double soa_ns = std::chrono::duration<double, std::nano>(end - begin).count() / ((double)num_steps * num_projectiles);
+
+        // Implementacao anterior: vetor de RoomWallModel, com remocao no
+        // meio do vetor durante a iteracao
+        g_BenchmarkRandomState = 1;
+        std::vector<RoomWallModel> shots;
+        std::vector<float> lifetimes;
+        begin = std::chrono::steady_clock::now();
+        for (int step = 0; step < num_steps; ++step)
+        {
+            while ((int)shots.size() < num_projectiles)
+            {
+                RoomWallModel shot = { BenchmarkRandom(-10.0f, 10.0f), -3.8f, 2.0f, 0.2f, 0.2f, 0.2f };
+                shots.push_back(shot);
+                lifetimes.push_back(BenchmarkRandom(0.1f, 0.7f));
+            }
+            for (size_t i = 0; i < shots.size(); ++i)
+            {
+                shots[i].positionZ -= 20.0f * dt;
+                lifetimes[i] -= dt;
+            }
+            for (size_t i = 0; i < shots.size(); )
+            {
+                if (lifetimes[i] <= 0.0f)
+                {
+                    shots.erase(shots.begin() + i);
+                    lifetimes.erase(lifetimes.begin() + i);
+                }
+                else
+                    ++i;
+            }
+            checksum += shots.size();
+        }
+        end = std::chrono::steady_clock::now();
+        double vector_ns = std::chrono::duration<double, std::nano>(end - begin).count() / ((double)num_steps * num_projectiles);
+
+        printf("%8d %16.2f %16.2f %9.1fx\n", num_projectiles, soa_ns, vector_ns, vector_ns / soa_ns);
+    }
+
+    printf("(checksum %.1f)\n", checksum);
+}
+
+void Benchmark_Picking(const char* const* filenames, int num_files)
+{
+    const int num_rays = 100000;
+
+    printf("Picking: %d raios por malha, de pontos ao redor da malha para pontos dentro da sua AABB.\n", num_rays);
+    printf("%-32s %9s %8s %10s %12s %10s %7s\n", "malha", "tris", "nos", "BVH (ms)", "Mraios/s", "us/raio", "acertos");
+
+    for (int f = 0; f < num_files; ++f)
+    {
+        tinyobj::attrib_t attrib;
+        std::vector<tinyobj::shape_t> shapes;
+        std::vector<tinyobj::material_t> materials;
+        std::string err;
+        if (!tinyobj::LoadObj(&attrib, &shapes, &materials, &err, filenames[f], NULL, true))
+        {
+            fprintf(stderr, "ERROR: Cannot load \"%s\".\n", filenames[f]);
+            continue;
+        }
+
+        for (size_t s = 0; s < shapes.size(); ++s)
+        {
+            std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+            int mesh = Pick_AddShape(attrib, shapes[s]);
+            std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+            double build_ms = std::chrono::duration<double, std::milli>(end - begin).count();
+
+            if (Pick_MeshTriangles(mesh) == 0)
+                continue;
+
+            // Limites da malha, a partir dos vertices usados pela shape
+            float bmin[3] = { std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max() };
+            float bmax[3] = { std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest() };
+            for (size_t i = 0; i < shapes[s].mesh.indices.size(); ++i)
+            {
+                int index = shapes[s].mesh.indices[i].vertex_index;
+                for (int k = 0; k < 3; ++k)
+                {
+                    bmin[k] = std::min(bmin[k], attrib.vertices[3*index + k]);
+                    bmax[k] = std::max(bmax[k], attrib.vertices[3*index + k]);
+                }
+            }
+            float center[3], radius = 0.0f;
+            for (int k = 0; k < 3; ++k)
+            {
+                center[k] = (bmin[k] + bmax[k]) / 2.0f;
+                radius += (bmax[k] - bmin[k]) * (bmax[k] - bmin[k]);
+            }
+            radius = std::sqrt(radius);
+
+            // Raios gerados antes da medicao
+            g_BenchmarkRandomState = 1;
+            std::vector<float> rays(6 * num_rays);
+            for (int r = 0; r < num_rays; ++r)
+            {
+                float theta = BenchmarkRandom(0.0f, 2.0f * 3.141592f);
+                float z = BenchmarkRandom(-1.0f, 1.0f);
+                float xy = std::sqrt(1.0f - z*z);
+                float* o = &rays[6*r];
+                float* d = &rays[6*r + 3];
+                o[0] = center[0] + radius * xy * std::cos(theta);
+                o[1] = center[1] + radius * xy * std::sin(theta);
+                o[2] = center[2] + radius * z;
+                for (int k = 0; k < 3; ++k)
+                    d[k] = BenchmarkRandom(bmin[k], bmax[k]) - o[k];
+            }
+
+            int hits = 0;
+            begin = std::chrono::steady_clock::now();
+            for (int r = 0; r < num_rays; ++r)
+                if (Pick_RayMesh(mesh, &rays[6*r], &rays[6*r + 3], std::numeric_limits<float>::max()) >= 0.0f)
+                    hits += 1;
+            end = std::chrono::steady_clock::now();
+            double seconds = std::chrono::duration<double>(end - begin).count();
+
+            std::string name = shapes[s].name.empty() ? filenames[f] : shapes[s].name;
+            if (name.size() > 32)
+                name = "..." + name.substr(name.size() - 29);
+            printf("%-32s %9d %8d %10.2f %12.2f %10.3f %6.1f%%\n", name.c_str(), Pick_MeshTriangles(mesh), Pick_MeshNodes(mesh),
+                   build_ms, num_rays / seconds / 1e6, seconds / num_rays * 1e6, 100.0 * hits / num_rays);
+        }
+    }
+}
+
+void Benchmark_Transforms()
+{
+    const int num_frames = 2000;
+    const int num_roots = 64;
+    const int sizes[] = { 256, 1024, 4096, 16384 };
+
+    printf("Transformacoes: %d quadros, %d raizes por hierarquia.\n", num_frames, num_roots);
+    printf("%9s %14s %14s %14s %14s\n", "entidades", "parada (ns)", "subarvore (ns)", "todas (ns)", "recompor (ns)");
+
+    float checksum = 0.0f;
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s)
+    {
+        // Hierarquia aleatoria: cada entidade abaixo das raizes e filha de
+        // alguma entidade anterior, como objetos sobre moveis
+        g_BenchmarkRandomState = 1;
+        int num_entities = sizes[s];
+        Scene_Clear();
+        for (int i = 0; i < num_entities; ++i)
+        {
+            int parent = (i < num_roots) ? -1 : (int)BenchmarkRandom(0.0f, (float)i);
+            float angle = BenchmarkRandom(0.0f, 3.141592f);
+            glm::mat4 local(1.0f);  // Rotacao em torno de Y seguida de translacao
+            local[0] = glm::vec4(std::cos(angle), 0.0f, -std::sin(angle), 0.0f);
+            local[2] = glm::vec4(std::sin(angle), 0.0f,  std::cos(angle), 0.0f);
+            local[3] = glm::vec4(BenchmarkRandom(-1.0f, 1.0f), 0.1f, BenchmarkRandom(-1.0f, 1.0f), 1.0f);
+            Scene_CreateEntity(1, local, parent);
+        }
+
+        // Mede um quadro: "moved" raizes sao alteradas antes da atualizacao
+        double ns[3];
+        const int moved[3] = { 0, 1, num_roots };
+        for (int m = 0; m < 3; ++m)
+        {
+            std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+            for (int frame = 0; frame < num_frames; ++frame)
+            {
+                for (int r = 0; r < moved[m]; ++r)
+                {
+                    int root = (frame + r) % num_roots;
+                    glm::mat4 local = Scene_LocalTransform(root);
+                    local[3].z += 1e-4f;
+                    Scene_SetLocalTransform(root, local);
+                }
+                checksum += (float)Scene_UpdateTransforms();
+            }
+            std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+            ns[m] = std::chrono::duration<double, std::nano>(end - begin).count() / num_frames;
+        }
+
+        // Sem cache: todas as matrizes globais sao recompostas a cada quadro,
+        // como fazia a pilha de matrizes
+        std::vector<glm::mat4> world(num_entities);
+        std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+        for (int frame = 0; frame < num_frames; ++frame)
+        {
+            for (int i = 0; i < num_entities; ++i)
+            {
+                int parent = Scene_Parent(i);
+                world[i] = (parent >= 0) ? world[parent] * Scene_LocalTransform(i) : Scene_LocalTransform(i);
+            }
+            checksum += world[frame % num_entities][3][0];
+        }
+        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        double recompose_ns = std::chrono::duration<double, std::nano>(end - begin).count() / num_frames;
+
+        printf("%9d %14.0f %14.0f %14.0f %14.0f\n", num_entities, ns[0], ns[1], ns[2], recompose_ns);
+    }
+
+    Scene_Clear();
+    printf("(checksum %.1f)\n", checksum);
+}
+
+// Maior diferenca entre as coordenadas de duas matrizes ou vetores
+static float MaxDifference(const glm::mat4& a, const glm::mat4& b)
+{
+    float d = 0.0f;
+    for (int c = 0; c < 4; ++c)
+        for (int r = 0; r < 4; ++r)
+            d = std::max(d, std::abs(a[c][r] - b[c][r]));
+    return d;
+}
+
+static float MaxDifference(const glm::vec4& a, const glm::vec4& b)
+{
+    return std::max(std::max(std::abs(a.x - b.x), std::abs(a.y - b.y)), std::max(std::abs(a.z - b.z), std::abs(a.w - b.w)));
+}
+
+static double ElapsedNs(std::chrono::steady_clock::time_point begin, int count)
+{
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - begin).count() / count;
+}
+
+static void PrintMatricesRow(const char* name, double scalar_ns, double simd_ns, float error)
+{
+    printf("%-24s %12.2f %12.2f %9.1fx %12.3g\n", name, scalar_ns, simd_ns, scalar_ns / simd_ns, error);
+}
+
+void Benchmark_Matrices()
+{
+    const int count = 100000;
+    const int repeats = 20;
+
+    printf("Matrizes: %d operacoes, %d repeticoes, implementacao %s.\n", count, repeats, Simd_Name());
+    printf("%-24s %12s %12s %10s %12s\n", "operacao", "escalar (ns)", "SIMD (ns)", "speedup", "erro max");
+
+    // Dados de entrada: transformacoes como as dos objetos da cena, pontos
+    // e caixas espalhados por algumas salas
+    g_BenchmarkRandomState = 1;
+    std::vector<SimdTRS> trs(count);
+    std::vector<glm::mat4> matrices(count);
+    std::vector<glm::vec4> points(count), vectors(count);
+    std::vector<glm::vec3> box_min(count), box_max(count);
+    for (int i = 0; i < count; ++i)
+    {
+        trs[i].translation = glm::vec3(BenchmarkRandom(-20.0f, 20.0f), BenchmarkRandom(-8.0f, 0.0f), BenchmarkRandom(-20.0f, 20.0f));
+        trs[i].rotation = glm::vec3(BenchmarkRandom(-3.14f, 3.14f), BenchmarkRandom(-3.14f, 3.14f), BenchmarkRandom(-3.14f, 3.14f));
+        trs[i].scale = glm::vec3(BenchmarkRandom(0.5f, 5.0f), BenchmarkRandom(0.5f, 5.0f), BenchmarkRandom(0.5f, 5.0f));
+        points[i] = glm::vec4(BenchmarkRandom(-1.0f, 1.0f), BenchmarkRandom(-1.0f, 1.0f), BenchmarkRandom(-1.0f, 1.0f), 1.0f);
+        vectors[i] = glm::vec4(BenchmarkRandom(-1.0f, 1.0f), BenchmarkRandom(-1.0f, 1.0f), BenchmarkRandom(-1.0f, 1.0f), 0.0f);
+        glm::vec3 center(BenchmarkRandom(-30.0f, 30.0f), BenchmarkRandom(-8.0f, 4.0f), BenchmarkRandom(-30.0f, 30.0f));
+        glm::vec3 half(BenchmarkRandom(0.1f, 2.0f), BenchmarkRandom(0.1f, 2.0f), BenchmarkRandom(0.1f, 2.0f));
+        box_min[i] = center - half;
+        box_max[i] = center + half;
+    }
+
+    // Composicao T * Rz * Ry * Rx * S: produtos de matrizes de "matrices.h",
+    // composicao a direita e composicao direta em lote
+    std::vector<glm::mat4> reference(count), result(count);
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; ++r)
+        for (int i = 0; i < count; ++i)
+        {
+            const SimdTRS& t = trs[i];
+            reference[i] = Matrix_Translate(t.translation.x, t.translation.y, t.translation.z)
+                         * Matrix_Rotate_Z(t.rotation.z) * Matrix_Rotate_Y(t.rotation.y) * Matrix_Rotate_X(t.rotation.x)
+                         * Matrix_Scale(t.scale.x, t.scale.y, t.scale.z);
+        }
+    double chain_ns = ElapsedNs(begin, repeats * count);
+
+    begin = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; ++r)
+        for (int i = 0; i < count; ++i)
+        {
+            const SimdTRS& t = trs[i];
+            glm::mat4 m = Simd_Translate(glm::mat4(1.0f), t.translation.x, t.translation.y, t.translation.z);
+            m = Simd_Rotate_X(Simd_Rotate_Y(Simd_Rotate_Z(m, t.rotation.z), t.rotation.y), t.rotation.x);
+            result[i] = Simd_Scale(m, t.scale.x, t.scale.y, t.scale.z);
+        }
+    double post_ns = ElapsedNs(begin, repeats * count);
+    float error = 0.0f;
+    for (int i = 0; i < count; ++i)
+        error = std::max(error, MaxDifference(reference[i], result[i]));
+    PrintMatricesRow("T*Rz*Ry*Rx*S (cadeia)", chain_ns, post_ns, error);
+
+    begin = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; ++r)
+        Simd_ComposeTRS(&trs[0], &result[0], count);
+    double compose_ns = ElapsedNs(begin, repeats * count);
+    error = 0.0f;
+    for (int i = 0; i < count; ++i)
+        error = std::max(error, MaxDifference(reference[i], result[i]));
+    PrintMatricesRow("T*Rz*Ry*Rx*S (lote)", chain_ns, compose_ns, error);
+    matrices = reference;
+
+    // Produto de matrizes (como na hierarquia da cena)
+    begin = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; ++r)
+        for (int i = 1; i < count; ++i)
+            reference[i] = matrices[i - 1] * matrices[i];
+    double multiply_ns = ElapsedNs(begin, repeats * (count - 1));
+    begin = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; ++r)
+        for (int i = 1; i < count; ++i)
+            result[i] = Simd_Multiply(matrices[i - 1], matrices[i]);
+    double simd_multiply_ns = ElapsedNs(begin, repeats * (count - 1));
+    error = 0.0f;
+    for (int i = 1; i < count; ++i)
+        error = std::max(error, MaxDifference(reference[i], result[i]));
+    PrintMatricesRow("mat4 * mat4", multiply_ns, simd_multiply_ns, error);
+
+    // Transformacao de pontos por uma mesma matriz
+    std::vector<glm::vec4> reference_points(count), result_points(count);
+    const glm::mat4& model = matrices[0];
+    begin = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; ++r)
+        for (int i = 0; i < count; ++i)
+            reference_points[i] = model * points[i];
+    double points_ns = ElapsedNs(begin, repeats * count);
+    begin = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; ++r)
+        Simd_TransformPoints(model, &points[0], &result_points[0], count);
+    double simd_points_ns = ElapsedNs(begin, repeats * count);
+    error = 0.0f;
+    for (int i = 0; i < count; ++i)
+        error = std::max(error, MaxDifference(reference_points[i], result_points[i]));
+    PrintMatricesRow("mat4 * vec4 (lote)", points_ns, simd_points_ns, error);
+
+    // Produto vetorial, produto escalar e norma
+    float checksum = 0.0f;
+    begin = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; ++r)
+        for (int i = 1; i < count; ++i)
+        {
+            reference_points[i] = crossproduct(vectors[i - 1], vectors[i]);
+            checksum += dotproduct(vectors[i - 1], vectors[i]) + norm(vectors[i]);
+        }
+    double vector_ns = ElapsedNs(begin, repeats * (count - 1));
+    float simd_checksum = 0.0f;
+    begin = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; ++r)
+        for (int i = 1; i < count; ++i)
+        {
+            result_points[i] = Simd_Cross(vectors[i - 1], vectors[i]);
+            simd_checksum += Simd_Dot(vectors[i - 1], vectors[i]) + Simd_Norm(vectors[i]);
+        }
+    double simd_vector_ns = ElapsedNs(begin, repeats * (count - 1));
+    error = 0.0f;
+    for (int i = 1; i < count; ++i)
+        error = std::max(error, MaxDifference(reference_points[i], result_points[i]));
+    for (int i = 1; i < 100; ++i)
+        error = std::max(error, std::abs(dotproduct(vectors[i - 1], vectors[i]) - Simd_Dot(vectors[i - 1], vectors[i])));
+    PrintMatricesRow("cross + dot + norm", vector_ns, simd_vector_ns, error);
+
+    // Culling de caixas contra os 6 planos de um frustum (caixa de 40x12x40
+    // centrada na origem, como uma sala vista de longe)
+    const glm::vec4 planes[6] = {
+        glm::vec4( 1.0f,  0.0f,  0.0f, 20.0f), glm::vec4(-1.0f,  0.0f,  0.0f, 20.0f),
+        glm::vec4( 0.0f,  1.0f,  0.0f,  8.0f), glm::vec4( 0.0f, -1.0f,  0.0f,  4.0f),
+        glm::vec4( 0.0f,  0.0f,  1.0f, 20.0f), glm::vec4( 0.0f,  0.0f, -1.0f, 20.0f),
+    };
+    std::vector<unsigned char> reference_visible(count), visible(count);
+    int num_visible = 0;
+    begin = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; ++r)
+        for (int i = 0; i < count; ++i)
+        {
+            bool inside = true;
+            for (int p = 0; p < 6 && inside; ++p)
+            {
+                glm::vec4 normal(planes[p].x, planes[p].y, planes[p].z, 0.0f);
+                glm::vec4 corner(planes[p].x >= 0.0f ? box_max[i].x : box_min[i].x,
+                                 planes[p].y >= 0.0f ? box_max[i].y : box_min[i].y,
+                                 planes[p].z >= 0.0f ? box_max[i].z : box_min[i].z, 0.0f);
+                inside = dotproduct(normal, corner) + planes[p].w >= 0.0f;
+            }
+            reference_visible[i] = inside ? 1 : 0;
+        }
+    double cull_ns = ElapsedNs(begin, repeats * count);
+    begin = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; ++r)
+        num_visible = Simd_CullBoxes(planes, 6, &box_min[0], &box_max[0], count, &visible[0]);
+    double simd_cull_ns = ElapsedNs(begin, repeats * count);
+    int mismatches = 0;
+    for (int i = 0; i < count; ++i)
+        mismatches += (visible[i] != reference_visible[i]) ? 1 : 0;
+    PrintMatricesRow("AABB x 6 planos (lote)", cull_ns, simd_cull_ns, (float)mismatches);
+
+    printf("(%d de %d caixas visiveis; checksum %.3f / %.3f)\n", num_visible, count, checksum, simd_checksum);
+}
+
+void Benchmark_TRS()
+{
+    const int count = 100000;
+    const int repeats = 20;
+
+    printf("Transformacoes TRS: %d operacoes, %d repeticoes; %d bytes por Transform, %d por matriz.\n",
+           count, repeats, (int)sizeof(Transform), (int)sizeof(glm::mat4));
+    printf("%-24s %12s %12s %10s %12s\n", "operacao", "matriz (ns)", "TRS (ns)", "speedup", "erro max");
+
+    // Transformacoes como as dos objetos da cena: rotacao em torno de Z e
+    // de X e escala qualquer; os pais tem escala uniforme
+    g_BenchmarkRandomState = 1;
+    std::vector<glm::vec3> translation(count), angles(count), scale(count);
+    std::vector<Transform> transforms(count), parents(count);
+    for (int i = 0; i < count; ++i)
+    {
+        translation[i] = glm::vec3(BenchmarkRandom(-20.0f, 20.0f), BenchmarkRandom(-8.0f, 0.0f), BenchmarkRandom(-20.0f, 20.0f));
+        angles[i] = glm::vec3(BenchmarkRandom(-3.14f, 3.14f), 0.0f, BenchmarkRandom(-3.14f, 3.14f));
+        scale[i] = glm::vec3(BenchmarkRandom(0.5f, 5.0f), BenchmarkRandom(0.5f, 5.0f), BenchmarkRandom(0.5f, 5.0f));
+        transforms[i] = Transform_Make(translation[i], Quaternion_Euler(angles[i].x, angles[i].y, angles[i].z), scale[i]);
+        float s = BenchmarkRandom(0.5f, 2.0f);
+        parents[i] = Transform_Make(glm::vec3(BenchmarkRandom(-5.0f, 5.0f), 0.0f, BenchmarkRandom(-5.0f, 5.0f)),
+                                    Quaternion_Euler(0.0f, BenchmarkRandom(-3.14f, 3.14f), 0.0f), glm::vec3(s, s, s));
+    }
+
+    // Matriz de modelagem: Matrix_Translate * Matrix_Rotate_Z * Matrix_Rotate_X * Matrix_Scale
+    std::vector<glm::mat4> reference(count), result(count), matrices(count), parent_matrices(count);
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; ++r)
+        for (int i = 0; i < count; ++i)
+            reference[i] = Matrix_Translate(translation[i].x, translation[i].y, translation[i].z)
+                         * Matrix_Rotate_Z(angles[i].z) * Matrix_Rotate_X(angles[i].x)
+                         * Matrix_Scale(scale[i].x, scale[i].y, scale[i].z);
+    double chain_ns = ElapsedNs(begin, repeats * count);
+    begin = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; ++r)
+        for (int i = 0; i < count; ++i)
+            result[i] = Transform_ToMatrix(transforms[i]);
+    double to_matrix_ns = ElapsedNs(begin, repeats * count);
+    float error = 0.0f;
+    for (int i = 0; i < count; ++i)
+        error = std::max(error, MaxDifference(reference[i], result[i]));
+    PrintMatricesRow("T*Rz*Rx*S", chain_ns, to_matrix_ns, error);
+    matrices = result;
+    for (int i = 0; i < count; ++i)
+        parent_matrices[i] = Transform_ToMatrix(parents[i]);
+
+    // Composicao com o pai: produto de matrizes contra Transform_Compose()
+    std::vector<Transform> composed(count);
+    begin = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; ++r)
+        for (int i = 0; i < count; ++i)
+            reference[i] = parent_matrices[i] * matrices[i];
+    double multiply_ns = ElapsedNs(begin, repeats * count);
+    begin = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; ++r)
+        for (int i = 0; i < count; ++i)
+            composed[i] = Transform_Compose(parents[i], transforms[i]);
+    double compose_ns = ElapsedNs(begin, repeats * count);
+    error = 0.0f;
+    for (int i = 0; i < count; ++i)
+        error = std::max(error, MaxDifference(reference[i], Transform_ToMatrix(composed[i])));
+    PrintMatricesRow("pai * filho", multiply_ns, compose_ns, error);
+
+    // Inversa: geral do GLM contra a da decomposicao e a afim
+    begin = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; ++r)
+        for (int i = 0; i < count; ++i)
+            reference[i] = glm::inverse(matrices[i]);
+    double inverse_ns = ElapsedNs(begin, repeats * count);
+    begin = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; ++r)
+        for (int i = 0; i < count; ++i)
+            result[i] = Transform_InverseMatrix(transforms[i]);
+    double trs_inverse_ns = ElapsedNs(begin, repeats * count);
+    error = 0.0f;
+    for (int i = 0; i < count; ++i)
+        error = std::max(error, MaxDifference(reference[i], result[i]));
+    PrintMatricesRow("inversa", inverse_ns, trs_inverse_ns, error);
+    begin = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; ++r)
+        for (int i = 0; i < count; ++i)
+            result[i] = Matrix_AffineInverse(matrices[i]);
+    double affine_inverse_ns = ElapsedNs(begin, repeats * count);
+    error = 0.0f;
+    for (int i = 0; i < count; ++i)
+        error = std::max(error, MaxDifference(reference[i], result[i]));
+    PrintMatricesRow("inversa (matriz afim)", inverse_ns, affine_inverse_ns, error);
+
+    // Matriz das normais: inverse(transpose(model)), como era feito no
+    // shader para cada vertice
+    begin = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; ++r)
+        for (int i = 0; i < count; ++i)
+            reference[i] = glm::inverse(glm::transpose(matrices[i]));
+    double normal_ns = ElapsedNs(begin, repeats * count);
+    for (int i = 0; i < count; ++i)
+        reference[i][0][3] = reference[i][1][3] = reference[i][2][3] = 0.0f;  // Sem translacao
+    begin = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; ++r)
+        for (int i = 0; i < count; ++i)
+            result[i] = Transform_NormalMatrix(transforms[i]);
+    double trs_normal_ns = ElapsedNs(begin, repeats * count);
+    error = 0.0f;
+    for (int i = 0; i < count; ++i)
+        error = std::max(error, MaxDifference(reference[i], result[i]));
+    PrintMatricesRow("matriz das normais", normal_ns, trs_normal_ns, error);
+    begin = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; ++r)
+        for (int i = 0; i < count; ++i)
+            result[i] = Matrix_Normal(matrices[i]);
+    double matrix_normal_ns = ElapsedNs(begin, repeats * count);
+    error = 0.0f;
+    for (int i = 0; i < count; ++i)
+        error = std::max(error, MaxDifference(reference[i], result[i]));
+    PrintMatricesRow("normais (matriz afim)", normal_ns, matrix_normal_ns, error);
+}
+
+// PSNR (dB) dos canais RGB da imagem comprimida em relacao a original
+static double CompressedPsnr(BcFormat format, const unsigned char* compressed, const unsigned char* pixels,
+                             int width, int height)
+{
+    int blocks_x = (width + 3) / 4;
+    int blocks_y = (height + 3) / 4;
+    double squared_error = 0.0;
+    unsigned char rgba[64];
+    for (int by = 0; by < blocks_y; ++by)
+        for (int bx = 0; bx < blocks_x; ++bx)
+        {
+            Bc_DecodeBlock(format, &compressed[((size_t)by * blocks_x + bx) * Bc_BlockSize(format)], rgba);
+            for (int i = 0; i < 16; ++i)
+            {
+                int x = bx*4 + (i & 3), y = by*4 + (i >> 2);
+                if (x >= width || y >= height)
+                    continue;
+                for (int k = 0; k < 3; ++k)
+                {
+                    double d = (double)rgba[i*4 + k] - pixels[((size_t)y * width + x) * 3 + k];
+                    squared_error += d * d;
+                }
+            }
+        }
+    double mse = squared_error / ((double)width * height * 3);
+    return mse > 0.0 ? 10.0 * std::log10(255.0 * 255.0 / mse) : std::numeric_limits<double>::infinity();
+}
+
+void Benchmark_BlockCompression(const char* filename)
+{
+    int width, height, channels;
+    unsigned char* pixels = stbi_load(filename, &width, &height, &channels, 3);
+    if (pixels == NULL)
+    {
+        fprintf(stderr, "ERROR: Cannot open image file \"%s\".\n", filename);
+        return;
+    }
+
+    int num_threads = std::max(1, (int)std::thread::hardware_concurrency());
+    printf("Compressao de texturas: \"%s\" (%dx%d), %d threads, implementacao %s.\n",
+           filename, width, height, num_threads, Simd_Name());
+    printf("%-14s %14s %14s %10s %10s\n", "formato", "1 thread (MT/s)", "todas (MT/s)", "speedup", "PSNR (dB)");
+
+    double megatexels = (double)width * height / 1.0e6;
+    BcFormat formats[] = { BC_FORMAT_BC1, BC_FORMAT_BC3, BC_FORMAT_BC7 };
+    for (int f = 0; f < 3; ++f)
+        for (int q = BC_QUALITY_FAST; q <= BC_QUALITY_HIGH; ++q)
+        {
+            std::vector<unsigned char> compressed(Bc_CompressedSize(formats[f], width, height));
+
+            std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+            Bc_EncodeImage(formats[f], (BcQuality)q, pixels, width, height, 3, &compressed[0], 1);
+            double single_s = ElapsedNs(begin, 1) * 1.0e-9;
+
+            begin = std::chrono::steady_clock::now();
+            Bc_EncodeImage(formats[f], (BcQuality)q, pixels, width, height, 3, &compressed[0], num_threads);
+            double all_s = ElapsedNs(begin, 1) * 1.0e-9;
+
+            char name[32];
+            snprintf(name, sizeof(name), "%s %s", Bc_FormatName(formats[f]), Bc_QualityName((BcQuality)q));
+            printf("%-14s %14.2f %14.2f %9.1fx %10.2f\n", name, megatexels / single_s, megatexels / all_s,
+                   single_s / all_s, CompressedPsnr(formats[f], &compressed[0], pixels, width, height));
+        }
+
+    stbi_image_free(pixels);
+}
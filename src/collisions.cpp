@@ -1,43 +1,408 @@
-#include <glm/vec4.hpp>
-#include "collisions.h"
-
-bool CheckWallCollision(glm::vec4 charPos, RoomWallModel wall)
-{
-    float wallFirstX = wall.positionX - wall.scaleX;
-    float wallLastX = wall.positionX + wall.scaleX;
-    float epsilon = 0.5;
-
-    if((charPos.x >= wallFirstX && charPos.x <= wallLastX)
-      && std::abs(wall.positionZ - charPos.z) < epsilon)
-        return true;
-    return false;
-}
-
-bool CheckWallYZCollision(glm::vec4 charPos, RoomWallModel wall)
-{
-    float wallFirstZ = wall.positionZ - wall.scaleX;
-    float wallLastZ = wall.positionZ + wall.scaleX;
-    float epsilon = 0.5;
-
-    if((charPos.z >= wallFirstZ && charPos.z <= wallLastZ) && std::abs(wall.positionX - charPos.x) < epsilon)
-        return true;
-    return false;
-}
-
-bool CheckGetObjCollision(glm::vec4 charPos, RoomWallModel getObj)
-{
-    float getObjFirstZ = getObj.positionZ - getObj.scaleX;
-    float getObjLastZ = getObj.positionZ + getObj.scaleX;
-    float epsilon = 0.5;
-
-    if((charPos.z >= getObjFirstZ && charPos.z <= getObjLastZ) && std::abs(getObj.positionX - charPos.x) < epsilon)
-        return true;
-    return false;
-}
-
-bool CollisionObj(float x1, float x2, RoomWallModel getObj)
-{
-    if(x1 <= getObj.positionX && x2 >= getObj.positionX)
-        return true;
-    return false;
-}
+#include <cmath>
+#include <vector>
+#include <limits>
+#include <algorithm>
+
+#include <glm/vec4.hpp>
+#include "collisions.h"
+
+bool CheckGetObjCollision(glm::vec4 charPos, RoomWallModel getObj)
+{
+    float getObjFirstZ = getObj.positionZ - getObj.scaleX;
+    float getObjLastZ = getObj.positionZ + getObj.scaleX;
+    float epsilon = 0.5;
+
+    if((charPos.z >= getObjFirstZ && charPos.z <= getObjLastZ) && std::abs(getObj.positionX - charPos.x) < epsilon)
+        return true;
+    return false;
+}
+
+bool CollisionObj(float x1, float x2, RoomWallModel getObj)
+{
+    if(x1 <= getObj.positionX && x2 >= getObj.positionX)
+        return true;
+    return false;
+}
+
+// Caixa do mundo de colisao, no plano XZ. O eixo local X e (ax, az) e o eixo
+// local Z e (-az, ax); hx e hz sao as meias dimensoes nestes eixos.
+struct CollisionBox
+{
+    float cx, cz;
+    float ax, az;
+    float hx, hz;
+    float ymin, ymax;
+};
+
+static std::vector<CollisionBox> g_CollisionBoxes;
+
+// Grade uniforme no formato CSR: os indices das caixas da celula c estao em
+// g_CollisionCellItems[g_CollisionCellStart[c] .. g_CollisionCellStart[c+1]-1].
+static std::vector<int> g_CollisionCellStart;
+static std::vector<int> g_CollisionCellItems;
+static float g_CollisionGridMinX = 0.0f;
+static float g_CollisionGridMinZ = 0.0f;
+static float g_CollisionCellSize = 1.0f;
+static int   g_CollisionGridWidth = 0;
+static int   g_CollisionGridDepth = 0;
+
+// Marcas usadas para testar cada caixa uma unica vez por consulta, mesmo que
+// ela ocupe varias celulas
+static std::vector<unsigned int> g_CollisionBoxStamp;
+static unsigned int g_CollisionQueryStamp = 0;
+
+// Maior numero de celulas da grade; mundos muito esparsos usam celulas maiores
+#define COLLISION_MAX_CELLS (256*256)
+
+// Distancia mantida entre a capsula e a superficie atingida
+#define COLLISION_SKIN 0.001f
+
+// Numero maximo de deslizamentos por movimento
+#define COLLISION_MAX_SLIDES 4
+
+void CollisionWorld_Clear()
+{
+    g_CollisionBoxes.clear();
+    g_CollisionCellStart.clear();
+    g_CollisionCellItems.clear();
+    g_CollisionGridWidth = 0;
+    g_CollisionGridDepth = 0;
+}
+
+void CollisionWorld_AddBox(glm::vec4 center, glm::vec4 half_size, glm::vec4 axis_x)
+{
+    float length = std::sqrt(axis_x.x*axis_x.x + axis_x.z*axis_x.z);
+    if (length <= 0.0f)
+        return;
+
+    CollisionBox box;
+    box.cx = center.x;
+    box.cz = center.z;
+    box.ax = axis_x.x / length;
+    box.az = axis_x.z / length;
+    box.hx = std::abs(half_size.x);
+    box.hz = std::abs(half_size.z);
+    box.ymin = center.y - std::abs(half_size.y);
+    box.ymax = center.y + std::abs(half_size.y);
+    g_CollisionBoxes.push_back(box);
+}
+
+void CollisionWorld_AddModelBox(const glm::mat4& model, glm::vec3 bbox_min, glm::vec3 bbox_max)
+{
+    glm::vec4 local_center = glm::vec4((bbox_min.x + bbox_max.x) / 2.0f, (bbox_min.y + bbox_max.y) / 2.0f, (bbox_min.z + bbox_max.z) / 2.0f, 1.0f);
+    glm::vec4 local_half   = glm::vec4((bbox_max.x - bbox_min.x) / 2.0f, (bbox_max.y - bbox_min.y) / 2.0f, (bbox_max.z - bbox_min.z) / 2.0f, 0.0f);
+    glm::vec4 center = model * local_center;
+
+    // Eixos locais transformados (colunas da matriz de modelagem)
+    glm::vec4 x_axis = model * glm::vec4(1.0f, 0.0f, 0.0f, 0.0f);
+    glm::vec4 y_axis = model * glm::vec4(0.0f, 1.0f, 0.0f, 0.0f);
+    glm::vec4 z_axis = model * glm::vec4(0.0f, 0.0f, 1.0f, 0.0f);
+
+    float x_length = std::sqrt(x_axis.x*x_axis.x + x_axis.y*x_axis.y + x_axis.z*x_axis.z);
+    float y_length = std::sqrt(y_axis.x*y_axis.x + y_axis.y*y_axis.y + y_axis.z*y_axis.z);
+    float z_length = std::sqrt(z_axis.x*z_axis.x + z_axis.y*z_axis.y + z_axis.z*z_axis.z);
+
+    const float epsilon = 1e-4f;
+    bool upright = std::abs(x_axis.y) <= epsilon * x_length
+                && std::abs(z_axis.y) <= epsilon * z_length
+                && std::abs(y_axis.x) <= epsilon * y_length
+                && std::abs(y_axis.z) <= epsilon * y_length;
+
+    if (upright)
+    {
+        glm::vec4 half_size = glm::vec4(local_half.x * x_length, local_half.y * y_length, local_half.z * z_length, 0.0f);
+        CollisionWorld_AddBox(center, half_size, x_axis);
+        return;
+    }
+
+    // Rotacao arbitraria: AABB da caixa transformada
+    glm::vec4 half_size = glm::vec4(
+        std::abs(x_axis.x)*local_half.x + std::abs(y_axis.x)*local_half.y + std::abs(z_axis.x)*local_half.z,
+        std::abs(x_axis.y)*local_half.x + std::abs(y_axis.y)*local_half.y + std::abs(z_axis.y)*local_half.z,
+        std::abs(x_axis.z)*local_half.x + std::abs(y_axis.z)*local_half.y + std::abs(z_axis.z)*local_half.z,
+        0.0f);
+    CollisionWorld_AddBox(center, half_size, glm::vec4(1.0f, 0.0f, 0.0f, 0.0f));
+}
+
+// Meias dimensoes da AABB de uma caixa no plano XZ
+static void BoxExtents(const CollisionBox& box, float* ex, float* ez)
+{
+    *ex = std::abs(box.ax)*box.hx + std::abs(box.az)*box.hz;
+    *ez = std::abs(box.az)*box.hx + std::abs(box.ax)*box.hz;
+}
+
+static int CellCoord(float value, float min_value, int count)
+{
+    int c = (int)std::floor((value - min_value) / g_CollisionCellSize);
+    return std::min(std::max(c, 0), count - 1);
+}
+
+void CollisionWorld_Build(float cell_size)
+{
+    g_CollisionCellStart.clear();
+    g_CollisionCellItems.clear();
+    g_CollisionBoxStamp.assign(g_CollisionBoxes.size(), 0);
+    g_CollisionQueryStamp = 0;
+
+    if (g_CollisionBoxes.empty())
+    {
+        g_CollisionGridWidth = g_CollisionGridDepth = 0;
+        return;
+    }
+
+    float min_x = std::numeric_limits<float>::max(), max_x = std::numeric_limits<float>::lowest();
+    float min_z = std::numeric_limits<float>::max(), max_z = std::numeric_limits<float>::lowest();
+    for (size_t i = 0; i < g_CollisionBoxes.size(); ++i)
+    {
+        const CollisionBox& b = g_CollisionBoxes[i];
+        float ex, ez;
+        BoxExtents(b, &ex, &ez);
+        min_x = std::min(min_x, b.cx - ex); max_x = std::max(max_x, b.cx + ex);
+        min_z = std::min(min_z, b.cz - ez); max_z = std::max(max_z, b.cz + ez);
+    }
+
+    // Aumentamos as celulas ate que a grade caiba no limite
+    g_CollisionCellSize = std::max(cell_size, 1e-3f);
+    for (;;)
+    {
+        g_CollisionGridWidth = (int)std::floor((max_x - min_x) / g_CollisionCellSize) + 1;
+        g_CollisionGridDepth = (int)std::floor((max_z - min_z) / g_CollisionCellSize) + 1;
+        if ((long)g_CollisionGridWidth * g_CollisionGridDepth <= COLLISION_MAX_CELLS)
+            break;
+        g_CollisionCellSize *= 2.0f;
+    }
+    g_CollisionGridMinX = min_x;
+    g_CollisionGridMinZ = min_z;
+
+    // Contagem das caixas por celula, seguida de soma de prefixos e
+    // preenchimento (counting sort)
+    int num_cells = g_CollisionGridWidth * g_CollisionGridDepth;
+    g_CollisionCellStart.assign(num_cells + 1, 0);
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        std::vector<int> cursor;
+        if (pass == 1)
+        {
+            for (int c = 0; c < num_cells; ++c)
+                g_CollisionCellStart[c+1] += g_CollisionCellStart[c];
+            g_CollisionCellItems.resize(g_CollisionCellStart[num_cells]);
+            cursor.assign(g_CollisionCellStart.begin(), g_CollisionCellStart.end() - 1);
+        }
+
+        for (size_t i = 0; i < g_CollisionBoxes.size(); ++i)
+        {
+            const CollisionBox& b = g_CollisionBoxes[i];
+            float ex, ez;
+            BoxExtents(b, &ex, &ez);
+            int x0 = CellCoord(b.cx - ex, g_CollisionGridMinX, g_CollisionGridWidth);
+            int x1 = CellCoord(b.cx + ex, g_CollisionGridMinX, g_CollisionGridWidth);
+            int z0 = CellCoord(b.cz - ez, g_CollisionGridMinZ, g_CollisionGridDepth);
+            int z1 = CellCoord(b.cz + ez, g_CollisionGridMinZ, g_CollisionGridDepth);
+            for (int z = z0; z <= z1; ++z)
+                for (int x = x0; x <= x1; ++x)
+                {
+                    int c = z * g_CollisionGridWidth + x;
+                    if (pass == 0)
+                        g_CollisionCellStart[c+1] += 1;
+                    else
+                        g_CollisionCellItems[cursor[c]++] = (int)i;
+                }
+        }
+    }
+}
+
+int CollisionWorld_NumBoxes()
+{
+    return (int)g_CollisionBoxes.size();
+}
+
+// Varredura de um circulo de raio r, partindo de (px, pz) com deslocamento
+// (dx, dz), contra uma caixa. A regiao atingida e o retangulo da caixa
+// expandido por r com cantos arredondados: testamos o retangulo expandido e,
+// se o ponto de entrada cair em um canto, o circulo daquele canto. Retorna o
+// instante t em [0, 1] do contato e a normal (no plano XZ) da superficie. Se
+// o circulo ja sobrepoe a caixa (ex.: pelo erro de arredondamento acumulado
+// ao deslizar rente a uma parede), o contato e em t = 0 e "depth" e a
+// distancia, ao longo da normal, que o tira da caixa; nos demais contatos,
+// "depth" e zero.
+static bool SweepCircleBox(const CollisionBox& box, float px, float pz, float dx, float dz, float r,
+                           float* t_hit, float* nx, float* nz, float* depth)
+{
+    // Passamos para o sistema de coordenadas da caixa
+    float rx = px - box.cx, rz = pz - box.cz;
+    float p[2] = { rx*box.ax + rz*box.az, -rx*box.az + rz*box.ax };
+    float d[2] = { dx*box.ax + dz*box.az, -dx*box.az + dz*box.ax };
+    float h[2] = { box.hx, box.hz };
+
+    // Sobreposicao inicial: a normal vem do ponto q da caixa mais proximo do
+    // centro; com o centro dentro da caixa, da face mais proxima
+    float qx = std::min(std::max(p[0], -h[0]), h[0]);
+    float qz = std::min(std::max(p[1], -h[1]), h[1]);
+    float dist2 = (p[0]-qx)*(p[0]-qx) + (p[1]-qz)*(p[1]-qz);
+    if (dist2 <= r*r)
+    {
+        float n[2] = { p[0] - qx, p[1] - qz };
+        if (dist2 > 0.0f)
+        {
+            float length = std::sqrt(dist2);
+            n[0] /= length;
+            n[1] /= length;
+            *depth = r - length;
+        }
+        else
+        {
+            int k = (h[0] - std::abs(p[0]) < h[1] - std::abs(p[1])) ? 0 : 1;
+            n[k] = p[k] >= 0.0f ? 1.0f : -1.0f;
+            n[1 - k] = 0.0f;
+            *depth = r + h[k] - std::abs(p[k]);
+        }
+        *t_hit = 0.0f;
+        *nx = n[0]*box.ax - n[1]*box.az;
+        *nz = n[0]*box.az + n[1]*box.ax;
+        return true;
+    }
+
+    // Retangulo expandido (teste de "slabs")
+    float t_enter = -std::numeric_limits<float>::max();
+    float t_exit = std::numeric_limits<float>::max();
+    int axis = 0;
+    for (int k = 0; k < 2; ++k)
+    {
+        float e = h[k] + r;
+        if (std::abs(d[k]) < 1e-12f)
+        {
+            if (std::abs(p[k]) > e)
+                return false;
+            continue;
+        }
+        float t0 = (-e - p[k]) / d[k];
+        float t1 = ( e - p[k]) / d[k];
+        if (t0 > t1)
+            std::swap(t0, t1);
+        if (t0 > t_enter)
+        {
+            t_enter = t0;
+            axis = k;
+        }
+        t_exit = std::min(t_exit, t1);
+        if (t_enter > t_exit)
+            return false;
+    }
+    if (t_enter > 1.0f || t_exit < 0.0f)
+        return false;
+
+    float t = std::max(t_enter, 0.0f);
+    float hit[2] = { p[0] + t*d[0], p[1] + t*d[1] };
+    float n[2] = { 0.0f, 0.0f };
+
+    if (std::abs(hit[0]) > h[0] && std::abs(hit[1]) > h[1])
+    {
+        // Entrada por um canto: intersecao com o circulo do canto
+        float c[2] = { hit[0] > 0.0f ? h[0] : -h[0], hit[1] > 0.0f ? h[1] : -h[1] };
+        float m[2] = { p[0] - c[0], p[1] - c[1] };
+        float a = d[0]*d[0] + d[1]*d[1];
+        float b = m[0]*d[0] + m[1]*d[1];
+        float cc = m[0]*m[0] + m[1]*m[1] - r*r;
+        float disc = b*b - a*cc;
+        if (b >= 0.0f || disc < 0.0f)
+            return false;
+        t = (-b - std::sqrt(disc)) / a;
+        if (t < 0.0f || t > 1.0f)
+            return false;
+        n[0] = (m[0] + t*d[0]) / r;
+        n[1] = (m[1] + t*d[1]) / r;
+    }
+    else
+    {
+        n[axis] = hit[axis] > 0.0f ? 1.0f : -1.0f;
+    }
+
+    // Normal de volta para o sistema do mundo
+    *t_hit = t;
+    *depth = 0.0f;
+    *nx = n[0]*box.ax - n[1]*box.az;
+    *nz = n[0]*box.az + n[1]*box.ax;
+    return true;
+}
+
+glm::vec4 CollisionWorld_MoveCapsule(glm::vec4 position, glm::vec4 displacement, float radius, float bottom, float top)
+{
+    float px = position.x, pz = position.z;
+    float dx = displacement.x, dz = displacement.z;
+    float y0 = position.y + bottom;
+    float y1 = position.y + top;
+
+    for (int slide = 0; slide < COLLISION_MAX_SLIDES; ++slide)
+    {
+        float length2 = dx*dx + dz*dz;
+        if (length2 < 1e-12f)
+            break;
+
+        float best_t = 1.0f, best_nx = 0.0f, best_nz = 0.0f, best_depth = 0.0f;
+        bool hit = false;
+
+        if (g_CollisionGridWidth > 0)
+        {
+            // Celulas cobertas pelo volume varrido
+            int x0 = CellCoord(std::min(px, px + dx) - radius, g_CollisionGridMinX, g_CollisionGridWidth);
+            int x1 = CellCoord(std::max(px, px + dx) + radius, g_CollisionGridMinX, g_CollisionGridWidth);
+            int z0 = CellCoord(std::min(pz, pz + dz) - radius, g_CollisionGridMinZ, g_CollisionGridDepth);
+            int z1 = CellCoord(std::max(pz, pz + dz) + radius, g_CollisionGridMinZ, g_CollisionGridDepth);
+
+            if (++g_CollisionQueryStamp == 0)
+            {
+                std::fill(g_CollisionBoxStamp.begin(), g_CollisionBoxStamp.end(), 0);
+                g_CollisionQueryStamp = 1;
+            }
+
+            for (int z = z0; z <= z1; ++z)
+                for (int x = x0; x <= x1; ++x)
+                {
+                    int c = z * g_CollisionGridWidth + x;
+                    for (int k = g_CollisionCellStart[c]; k < g_CollisionCellStart[c+1]; ++k)
+                    {
+                        int i = g_CollisionCellItems[k];
+                        if (g_CollisionBoxStamp[i] == g_CollisionQueryStamp)
+                            continue;
+                        g_CollisionBoxStamp[i] = g_CollisionQueryStamp;
+
+                        const CollisionBox& box = g_CollisionBoxes[i];
+                        if (box.ymax < y0 || box.ymin > y1)
+                            continue;
+
+                        float t, nx, nz, depth;
+                        if (SweepCircleBox(box, px, pz, dx, dz, radius, &t, &nx, &nz, &depth)
+                            && (t < best_t || (t == best_t && depth > best_depth)))
+                        {
+                            best_t = t;
+                            best_nx = nx;
+                            best_nz = nz;
+                            best_depth = depth;
+                            hit = true;
+                        }
+                    }
+                }
+        }
+
+        if (!hit)
+        {
+            px += dx;
+            pz += dz;
+            break;
+        }
+
+        // Avancamos ate o contato (menos uma pequena folga), ou saimos da
+        // caixa que ja sobrepunhamos, e deslizamos o restante do deslocamento
+        // ao longo da superficie
+        float t = std::max(best_t - COLLISION_SKIN / std::sqrt(length2), 0.0f);
+        px += t*dx + (best_depth > 0.0f ? (best_depth + COLLISION_SKIN)*best_nx : 0.0f);
+        pz += t*dz + (best_depth > 0.0f ? (best_depth + COLLISION_SKIN)*best_nz : 0.0f);
+        float rest_x = (1.0f - t)*dx;
+        float rest_z = (1.0f - t)*dz;
+        float into = std::min(rest_x*best_nx + rest_z*best_nz, 0.0f);
+        dx = rest_x - into*best_nx;
+        dz = rest_z - into*best_nz;
+    }
+
+    return glm::vec4(px, position.y, pz, position.w);
+}
@@ -0,0 +1,288 @@
+// Selecao de objetos na GPU com leitura assincrona. Veja "gpupick.h".
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <glm/geometric.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include "gpupick.h"
+#include "profiler.h"
+#include "trace.h"
+
+GLuint CreateGpuProgram(GLuint vertex_shader_id, GLuint fragment_shader_id); // Funcao definida em main.cpp
+void TextRendering_LoadShader(const GLchar* const shader_string, GLuint shader_id); // Funcao definida em textrendering.cpp
+
+// Numero de consultas que podem estar pendentes ao mesmo tempo. Com tres
+// PBOs, um novo pedido pode ser feito a cada quadro mesmo que a GPU esteja
+// dois quadros atras da CPU.
+#define GPU_PICK_SLOTS 3
+
+const GLchar* const pickvertexshader_source = ""
+"#version 330\n"
+"layout (location = 0) in vec4 model_coefficients;\n"
+"uniform mat4 model;\n"
+"uniform mat4 view;\n"
+"uniform mat4 projection;\n"
+"out vec4 position_view;\n"
+"void main()\n"
+"{\n"
+    "position_view = view * model * model_coefficients;\n"
+    "gl_Position = projection * position_view;\n"
+"}\n"
+"\0";
+
+const GLchar* const pickfragmentshader_source = ""
+"#version 330\n"
+"uniform uint handle;\n"
+"in vec4 position_view;\n"
+"layout (location = 0) out uint out_handle;\n"
+"layout (location = 1) out float out_distance;\n"
+"void main()\n"
+"{\n"
+    "out_handle = handle;\n"
+    "out_distance = length(position_view.xyz);\n"
+"}\n"
+"\0";
+
+struct GpuPickInstance
+{
+    GLuint      vertex_array_object_id;
+    GLenum      rendering_mode;
+    void*       first_index;
+    int         num_indices;
+    glm::mat4   model;
+    const char* name;
+};
+
+// Uma consulta em andamento: o PBO de destino e a fence que indica que a
+// copia terminou
+struct GpuPickSlot
+{
+    GLuint       pixel_buffer;
+    GLsync       fence;
+    unsigned int request_frame;
+    unsigned int generation;  // g_GpuPickGeneration no momento do pedido
+    glm::vec4    origin;      // Camera usada no pedido (veja GpuPickResult)
+    glm::vec4    direction;
+};
+
+static std::vector<GpuPickInstance> g_GpuPickInstances;
+static unsigned int g_GpuPickGeneration = 0;
+
+static GpuPickSlot  g_GpuPickSlots[GPU_PICK_SLOTS];
+static int          g_GpuPickFirstPending = 0;
+static int          g_GpuPickNumPending = 0;
+static unsigned int g_GpuPickFrame = 0;
+static int          g_GpuPickLastLatency = -1;
+
+static GLuint g_GpuPickFramebuffer = 0;
+static GLuint g_GpuPickProgram = 0;
+static GLint  g_GpuPickModelUniform;
+static GLint  g_GpuPickViewUniform;
+static GLint  g_GpuPickProjectionUniform;
+static GLint  g_GpuPickHandleUniform;
+
+void GpuPick_Init()
+{
+    // Framebuffer de 1x1 pixel: identificador, distancia e profundidade
+    GLuint handle_renderbuffer, distance_renderbuffer, depth_renderbuffer;
+    glGenRenderbuffers(1, &handle_renderbuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, handle_renderbuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_R32UI, 1, 1);
+
+    glGenRenderbuffers(1, &distance_renderbuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, distance_renderbuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_R32F, 1, 1);
+
+    glGenRenderbuffers(1, &depth_renderbuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, depth_renderbuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, 1, 1);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+    glGenFramebuffers(1, &g_GpuPickFramebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, g_GpuPickFramebuffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, handle_renderbuffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT1, GL_RENDERBUFFER, distance_renderbuffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depth_renderbuffer);
+
+    const GLenum draw_buffers[2] = { GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1 };
+    glDrawBuffers(2, draw_buffers);
+
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+        fprintf(stderr, "ERROR: Picking framebuffer is incomplete.\n");
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    // Cada PBO recebe o identificador (4 bytes) seguido da distancia (4 bytes)
+    for (int i = 0; i < GPU_PICK_SLOTS; ++i)
+    {
+        glGenBuffers(1, &g_GpuPickSlots[i].pixel_buffer);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, g_GpuPickSlots[i].pixel_buffer);
+        glBufferData(GL_PIXEL_PACK_BUFFER, 2 * sizeof(GLuint), NULL, GL_STREAM_READ);
+        g_GpuPickSlots[i].fence = 0;
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    GLuint vertex_shader_id = glCreateShader(GL_VERTEX_SHADER);
+    TextRendering_LoadShader(pickvertexshader_source, vertex_shader_id);
+    GLuint fragment_shader_id = glCreateShader(GL_FRAGMENT_SHADER);
+    TextRendering_LoadShader(pickfragmentshader_source, fragment_shader_id);
+
+    g_GpuPickProgram = CreateGpuProgram(vertex_shader_id, fragment_shader_id);
+    g_GpuPickModelUniform      = glGetUniformLocation(g_GpuPickProgram, "model");
+    g_GpuPickViewUniform       = glGetUniformLocation(g_GpuPickProgram, "view");
+    g_GpuPickProjectionUniform = glGetUniformLocation(g_GpuPickProgram, "projection");
+    g_GpuPickHandleUniform     = glGetUniformLocation(g_GpuPickProgram, "handle");
+}
+
+void GpuPick_ClearInstances()
+{
+    g_GpuPickInstances.clear();
+    g_GpuPickGeneration += 1;
+}
+
+void GpuPick_AddInstance(GLuint vertex_array_object_id, GLenum rendering_mode, void* first_index, int num_indices,
+                         const glm::mat4& model, const char* name)
+{
+    GpuPickInstance instance;
+    instance.vertex_array_object_id = vertex_array_object_id;
+    instance.rendering_mode = rendering_mode;
+    instance.first_index = first_index;
+    instance.num_indices = num_indices;
+    instance.model = model;
+    instance.name = name;
+    g_GpuPickInstances.push_back(instance);
+}
+
+bool GpuPick_Request(const glm::mat4& view, const glm::mat4& projection, int width, int height)
+{
+    TRACE_ZONE("GpuPick_Request");
+
+    if (g_GpuPickNumPending == GPU_PICK_SLOTS || width <= 0 || height <= 0)
+        return false;
+
+    GpuPickSlot& slot = g_GpuPickSlots[(g_GpuPickFirstPending + g_GpuPickNumPending) % GPU_PICK_SLOTS];
+    g_GpuPickNumPending += 1;
+
+    // Matriz de "pick": leva o pixel (width/2, height/2) da tela, em NDC,
+    // para o viewport inteiro de 1x1. Aplicada apos a projecao, em
+    // coordenadas de recorte: x' = width * (x - cx * w).
+    float cx = 2.0f * (width / 2 + 0.5f) / width - 1.0f;
+    float cy = 2.0f * (height / 2 + 0.5f) / height - 1.0f;
+    glm::mat4 pick(1.0f);
+    pick[0][0] = (float)width;
+    pick[1][1] = (float)height;
+    pick[3][0] = -cx * width;
+    pick[3][1] = -cy * height;
+    glm::mat4 pick_projection = pick * projection;
+
+    // Guardamos o estado que sera alterado
+    GLint previous_framebuffer, previous_program, previous_viewport[4];
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previous_framebuffer);
+    glGetIntegerv(GL_CURRENT_PROGRAM, &previous_program);
+    glGetIntegerv(GL_VIEWPORT, previous_viewport);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, g_GpuPickFramebuffer);
+    glViewport(0, 0, 1, 1);
+
+    const GLuint no_handle[4] = { 0, 0, 0, 0 };
+    const GLfloat no_distance[4] = { -1.0f, 0.0f, 0.0f, 0.0f };
+    glClearBufferuiv(GL_COLOR, 0, no_handle);
+    glClearBufferfv(GL_COLOR, 1, no_distance);
+    glClear(GL_DEPTH_BUFFER_BIT);
+
+    glUseProgram(g_GpuPickProgram);
+    glUniformMatrix4fv(g_GpuPickViewUniform, 1, GL_FALSE, glm::value_ptr(view));
+    glUniformMatrix4fv(g_GpuPickProjectionUniform, 1, GL_FALSE, glm::value_ptr(pick_projection));
+
+    // O identificador de cada instancia e seu indice + 1; zero e o fundo
+    for (size_t i = 0; i < g_GpuPickInstances.size(); ++i)
+    {
+        const GpuPickInstance& instance = g_GpuPickInstances[i];
+        glUniformMatrix4fv(g_GpuPickModelUniform, 1, GL_FALSE, glm::value_ptr(instance.model));
+        glUniform1ui(g_GpuPickHandleUniform, (GLuint)(i + 1));
+        glBindVertexArray(instance.vertex_array_object_id);
+        Profiler_CountDraw(instance.num_indices / 3);
+        glDrawElements(instance.rendering_mode, instance.num_indices, GL_UNSIGNED_INT, instance.first_index);
+    }
+    glBindVertexArray(0);
+
+    // Copia para o PBO: a chamada retorna imediatamente, e a copia acontece
+    // na GPU depois do desenho
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pixel_buffer);
+    glReadBuffer(GL_COLOR_ATTACHMENT0);
+    glReadPixels(0, 0, 1, 1, GL_RED_INTEGER, GL_UNSIGNED_INT, (void*)0);
+    glReadBuffer(GL_COLOR_ATTACHMENT1);
+    glReadPixels(0, 0, 1, 1, GL_RED, GL_FLOAT, (void*)sizeof(GLuint));
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    slot.request_frame = g_GpuPickFrame;
+    slot.generation = g_GpuPickGeneration;
+
+    // A camera e a mira sao extraidas de "view", que e uma transformacao
+    // rigida: a posicao e -R^T t e a mira e o eixo -z da camera
+    glm::vec3 t = glm::vec3(view[3]);
+    slot.origin = glm::vec4(-glm::dot(glm::vec3(view[0]), t),
+                            -glm::dot(glm::vec3(view[1]), t),
+                            -glm::dot(glm::vec3(view[2]), t), 1.0f);
+    slot.direction = glm::vec4(-view[0][2], -view[1][2], -view[2][2], 0.0f);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, previous_framebuffer);
+    glViewport(previous_viewport[0], previous_viewport[1], previous_viewport[2], previous_viewport[3]);
+    glUseProgram(previous_program);
+
+    return true;
+}
+
+bool GpuPick_Poll(GpuPickResult* result)
+{
+    g_GpuPickFrame += 1;
+
+    if (g_GpuPickNumPending == 0)
+        return false;
+
+    // As consultas terminam na ordem em que foram pedidas; basta testar a
+    // mais antiga. Timeout zero: so verifica, nunca espera.
+    GpuPickSlot& slot = g_GpuPickSlots[g_GpuPickFirstPending];
+    GLenum status = glClientWaitSync(slot.fence, 0, 0);
+    if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+        return false;
+
+    glDeleteSync(slot.fence);
+    slot.fence = 0;
+    g_GpuPickFirstPending = (g_GpuPickFirstPending + 1) % GPU_PICK_SLOTS;
+    g_GpuPickNumPending -= 1;
+
+    GLuint handle = 0;
+    float distance = -1.0f;
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pixel_buffer);
+    const GLuint* data = (const GLuint*)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, 2 * sizeof(GLuint), GL_MAP_READ_BIT);
+    if (data)
+    {
+        handle = data[0];
+        distance = *(const float*)(data + 1);
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    g_GpuPickLastLatency = (int)(g_GpuPickFrame - slot.request_frame);
+
+    // Se as instancias mudaram desde o pedido (troca de sala), o
+    // identificador nao corresponde mais a nenhum objeto
+    result->name = NULL;
+    result->distance = distance;
+    result->latency = g_GpuPickLastLatency;
+    result->origin = slot.origin;
+    result->direction = slot.direction;
+    if (handle != 0 && slot.generation == g_GpuPickGeneration && handle <= g_GpuPickInstances.size())
+        result->name = g_GpuPickInstances[handle - 1].name;
+
+    return true;
+}
+
+int GpuPick_LastLatency()
+{
+    return g_GpuPickLastLatency;
+}
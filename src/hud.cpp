@@ -0,0 +1,222 @@
+// Camada do HUD desenhada em uma textura. Veja "hud.h".
+#include <cstdio>
+#include <string>
+
+#include "hud.h"
+#include "profiler.h"
+#include "texturememory.h"
+
+GLuint CreateGpuProgram(GLuint vertex_shader_id, GLuint fragment_shader_id); // Funcao definida em main.cpp
+
+// Funcoes definidas em textrendering.cpp
+void TextRendering_LoadShader(const GLchar* const shader_string, GLuint shader_id);
+void TextRendering_PrintString(GLFWwindow* window, const std::string &str, float x, float y, float scale);
+float TextRendering_LineHeight(GLFWwindow* window);
+void TextRendering_Flush(GLFWwindow* window);
+
+// Unidade de textura do HUD (a 31 e usada pela fonte)
+#define HUD_TEXTURE_UNIT 30
+
+// Quadrilatero que cobre o viewport, gerado a partir de gl_VertexID
+const GLchar* const hudvertexshader_source = ""
+"#version 330\n"
+"out vec2 texCoords;\n"
+"void main()\n"
+"{\n"
+    "texCoords = vec2(gl_VertexID & 1, gl_VertexID >> 1);\n"
+    "gl_Position = vec4(texCoords * 2.0 - 1.0, 0, 1);\n"
+"}\n"
+"\0";
+
+// A textura guarda cores pre-multiplicadas pelo alpha
+const GLchar* const hudfragmentshader_source = ""
+"#version 330\n"
+"uniform sampler2D tex;\n"
+"in vec2 texCoords;\n"
+"out vec4 fragColor;\n"
+"void main()\n"
+"{\n"
+    "fragColor = texture(tex, texCoords);\n"
+"}\n"
+"\0";
+
+struct HudElementState
+{
+    std::string text;
+    float x, y;
+};
+
+static HudElementState g_HudElements[HUD_NUM_ELEMENTS];
+
+// A textura precisa ser redesenhada
+static bool g_HudDirty = true;
+
+// Tamanho pedido (framebuffer) e tamanho da textura alocada
+static int g_HudWidth = 0, g_HudHeight = 0;
+static int g_HudTextureWidth = 0, g_HudTextureHeight = 0;
+
+static GLuint g_HudFramebuffer = 0;
+static GLuint g_HudTexture = 0;
+static GLuint g_HudVertexArray = 0;
+static GLuint g_HudProgram = 0;
+
+void Hud_Init()
+{
+    glGenFramebuffers(1, &g_HudFramebuffer);
+    glGenTextures(1, &g_HudTexture);
+
+    // O quadrilatero nao tem atributos, mas o perfil core exige um VAO
+    glGenVertexArrays(1, &g_HudVertexArray);
+
+    // A textura tem o tamanho do framebuffer: amostragem de um texel por pixel
+    GLuint sampler;
+    glGenSamplers(1, &sampler);
+    glSamplerParameteri(sampler, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glSamplerParameteri(sampler, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glSamplerParameteri(sampler, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glSamplerParameteri(sampler, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glBindSampler(HUD_TEXTURE_UNIT, sampler);
+
+    GLuint vertex_shader_id = glCreateShader(GL_VERTEX_SHADER);
+    TextRendering_LoadShader(hudvertexshader_source, vertex_shader_id);
+    GLuint fragment_shader_id = glCreateShader(GL_FRAGMENT_SHADER);
+    TextRendering_LoadShader(hudfragmentshader_source, fragment_shader_id);
+    g_HudProgram = CreateGpuProgram(vertex_shader_id, fragment_shader_id);
+
+    glUseProgram(g_HudProgram);
+    glUniform1i(glGetUniformLocation(g_HudProgram, "tex"), HUD_TEXTURE_UNIT);
+    glUseProgram(0);
+}
+
+void Hud_SetSize(int width, int height)
+{
+    if (width != g_HudWidth || height != g_HudHeight)
+    {
+        g_HudWidth = width;
+        g_HudHeight = height;
+        g_HudDirty = true;
+    }
+}
+
+size_t Hud_TextureBytes()
+{
+    return (size_t)g_HudWidth * g_HudHeight * 4;
+}
+
+void Hud_SetText(HudElement element, const std::string& text, float x, float y)
+{
+    HudElementState& e = g_HudElements[element];
+    if (e.text != text || e.x != x || e.y != y)
+    {
+        e.text = text;
+        e.x = x;
+        e.y = y;
+        g_HudDirty = true;
+    }
+}
+
+void Hud_Hide(HudElement element)
+{
+    if (!g_HudElements[element].text.empty())
+    {
+        g_HudElements[element].text.clear();
+        g_HudDirty = true;
+    }
+}
+
+// (Re)aloca a textura com o tamanho atual do framebuffer
+static void ResizeTexture()
+{
+    glActiveTexture(GL_TEXTURE0 + HUD_TEXTURE_UNIT);
+    glBindTexture(GL_TEXTURE_2D, g_HudTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, g_HudWidth, g_HudHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+
+    char description[64];
+    snprintf(description, sizeof(description), "%dx%d, rgba8", g_HudWidth, g_HudHeight);
+    TextureMemory_Set("hud", description, Hud_TextureBytes());
+
+    glBindFramebuffer(GL_FRAMEBUFFER, g_HudFramebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, g_HudTexture, 0);
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+        fprintf(stderr, "ERROR: HUD framebuffer is incomplete.\n");
+
+    g_HudTextureWidth = g_HudWidth;
+    g_HudTextureHeight = g_HudHeight;
+}
+
+// Desenha o texto de todos os elementos na textura
+static void RedrawTexture(GLFWwindow* window)
+{
+    GLint previous_framebuffer, previous_viewport[4];
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previous_framebuffer);
+    glGetIntegerv(GL_VIEWPORT, previous_viewport);
+
+    if (g_HudTextureWidth != g_HudWidth || g_HudTextureHeight != g_HudHeight)
+        ResizeTexture();
+
+    glBindFramebuffer(GL_FRAMEBUFFER, g_HudFramebuffer);
+    glViewport(0, 0, g_HudWidth, g_HudHeight);
+
+    const GLfloat transparent[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    glClearBufferfv(GL_COLOR, 0, transparent);
+
+    float lineheight = TextRendering_LineHeight(window);
+    for (int i = 0; i < HUD_NUM_ELEMENTS; ++i)
+    {
+        const HudElementState& e = g_HudElements[i];
+        size_t begin = 0;
+        for (int line = 0; begin < e.text.size(); ++line)
+        {
+            size_t end = e.text.find('\n', begin);
+            if (end == std::string::npos)
+                end = e.text.size();
+            TextRendering_PrintString(window, e.text.substr(begin, end - begin), e.x, e.y - line*lineheight, 1.0f);
+            begin = end + 1;
+        }
+    }
+    TextRendering_Flush(window);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, previous_framebuffer);
+    glViewport(previous_viewport[0], previous_viewport[1], previous_viewport[2], previous_viewport[3]);
+}
+
+bool Hud_Draw(GLFWwindow* window)
+{
+    if (g_HudWidth <= 0 || g_HudHeight <= 0)
+        return false;
+
+    bool visible = false;
+    for (int i = 0; i < HUD_NUM_ELEMENTS; ++i)
+        visible = visible || !g_HudElements[i].text.empty();
+
+    // Sem texto nao ha o que compor; a textura so e redesenhada quando
+    // algum elemento voltar a aparecer
+    if (!visible)
+        return false;
+
+    bool redrawn = g_HudDirty;
+    if (g_HudDirty)
+    {
+        RedrawTexture(window);
+        g_HudDirty = false;
+    }
+
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+    glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+    glDepthFunc(GL_ALWAYS);
+    glUseProgram(g_HudProgram);
+    glActiveTexture(GL_TEXTURE0 + HUD_TEXTURE_UNIT);
+    glBindTexture(GL_TEXTURE_2D, g_HudTexture);
+    glBindVertexArray(g_HudVertexArray);
+
+    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+    Profiler_CountDraw(2);
+
+    glBindVertexArray(0);
+    glUseProgram(0);
+    glDepthFunc(GL_LESS);
+    glDisable(GL_BLEND);
+
+    return redrawn;
+}
@@ -0,0 +1,229 @@
+// Gravacao e reproducao deterministica da entrada. Veja "inputrecord.h".
+//
+// Formato do log (little-endian):
+//
+//   cabecalho: "FCGI" (4 bytes), versao (uint32)
+//   registros: tipo (uint8) seguido do conteudo
+//     INPUT_RECORD_FRAME  : tempo do inicio do quadro (double)
+//     INPUT_RECORD_KEY    : atraso desde o inicio do quadro (float), key (int16),
+//                           scancode (int16), action (uint8), mods (uint8)
+//     INPUT_RECORD_CURSOR : atraso desde o inicio do quadro (float), x (double), y (double)
+//
+// Os eventos gravados depois de um registro INPUT_RECORD_FRAME pertencem ao
+// mesmo quadro e sao entregues em Input_DispatchReplayEvents(), todos no
+// mesmo ponto do quadro, como glfwPollEvents() faz ao vivo. O atraso de cada
+// evento nao afeta a reproducao: ele fica no log para a analise de sessoes
+// gravadas (ex.: latencia entre a entrada e o quadro que a processa).
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include <stdint.h>
+
+#include "inputrecord.h"
+
+// Funcoes definidas em main.cpp
+void KeyCallback(GLFWwindow* window, int key, int scancode, int action, int mode);
+void CursorPosCallback(GLFWwindow* window, double xpos, double ypos);
+
+#define INPUT_RECORD_VERSION 3
+
+enum InputRecordType
+{
+    INPUT_RECORD_FRAME  = 1,
+    INPUT_RECORD_KEY    = 2,
+    INPUT_RECORD_CURSOR = 3
+};
+
+static FILE*   g_InputRecordFile = NULL;
+static double  g_InputFrameStart = 0.0;
+
+static std::vector<uint8_t> g_InputReplayData;
+static size_t  g_InputReplayOffset = 0;
+static bool    g_InputReplaying = false;
+static bool    g_InputReplayFinished = false;
+static bool    g_InputDispatching = false;
+static unsigned long g_InputReplayFrames = 0;
+
+template <typename T>
+static void WriteValue(T value)
+{
+    fwrite(&value, sizeof(T), 1, g_InputRecordFile);
+}
+
+template <typename T>
+static bool ReadValue(T* value)
+{
+    if (g_InputReplayOffset + sizeof(T) > g_InputReplayData.size())
+        return false;
+    memcpy(value, &g_InputReplayData[g_InputReplayOffset], sizeof(T));
+    g_InputReplayOffset += sizeof(T);
+    return true;
+}
+
+bool Input_StartRecording(const char* filename)
+{
+    g_InputRecordFile = fopen(filename, "wb");
+    if (g_InputRecordFile == NULL)
+    {
+        fprintf(stderr, "ERROR: Cannot open file \"%s\".\n", filename);
+        return false;
+    }
+
+    fwrite("FCGI", 1, 4, g_InputRecordFile);
+    WriteValue<uint32_t>(INPUT_RECORD_VERSION);
+
+    printf("Gravando entrada em \"%s\".\n", filename);
+    return true;
+}
+
+bool Input_StartReplay(const char* filename)
+{
+    FILE* file = fopen(filename, "rb");
+    if (file == NULL)
+    {
+        fprintf(stderr, "ERROR: Cannot open file \"%s\".\n", filename);
+        return false;
+    }
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    g_InputReplayData.resize(size > 0 ? size : 0);
+    size_t read = g_InputReplayData.empty() ? 0 : fread(&g_InputReplayData[0], 1, g_InputReplayData.size(), file);
+    fclose(file);
+
+    uint32_t version = 0;
+    g_InputReplayOffset = 4;
+    if (read != g_InputReplayData.size() || read < 8 || memcmp(&g_InputReplayData[0], "FCGI", 4) != 0
+        || !ReadValue(&version) || version != INPUT_RECORD_VERSION)
+    {
+        fprintf(stderr, "ERROR: \"%s\" is not a valid input log.\n", filename);
+        g_InputReplayData.clear();
+        return false;
+    }
+
+    g_InputReplaying = true;
+    printf("Reproduzindo entrada de \"%s\".\n", filename);
+    return true;
+}
+
+bool Input_IsRecording()
+{
+    return g_InputRecordFile != NULL;
+}
+
+bool Input_IsReplaying()
+{
+    return g_InputReplaying;
+}
+
+bool Input_ReplayFinished()
+{
+    return g_InputReplayFinished;
+}
+
+double Input_BeginFrame(double live_time)
+{
+    if (g_InputReplaying)
+    {
+        // O proximo registro deve ser o inicio de um quadro
+        uint8_t type = 0;
+        double time = 0.0;
+        if (!ReadValue(&type) || type != INPUT_RECORD_FRAME || !ReadValue(&time))
+        {
+            if (!g_InputReplayFinished)
+                printf("Reproducao terminada apos %lu quadros.\n", g_InputReplayFrames);
+            g_InputReplayFinished = true;
+            return g_InputFrameStart;
+        }
+
+        g_InputReplayFrames += 1;
+        g_InputFrameStart = time;
+        return time;
+    }
+
+    g_InputFrameStart = live_time;
+    if (g_InputRecordFile != NULL)
+    {
+        WriteValue<uint8_t>(INPUT_RECORD_FRAME);
+        WriteValue<double>(live_time);
+    }
+    return live_time;
+}
+
+void Input_DispatchReplayEvents(GLFWwindow* window)
+{
+    if (!g_InputReplaying || g_InputReplayFinished)
+        return;
+
+    g_InputDispatching = true;
+    while (g_InputReplayOffset < g_InputReplayData.size())
+    {
+        uint8_t type = g_InputReplayData[g_InputReplayOffset];
+        if (type == INPUT_RECORD_FRAME)
+            break;
+        g_InputReplayOffset += 1;
+
+        float delay;
+        if (type == INPUT_RECORD_KEY)
+        {
+            int16_t key, scancode;
+            uint8_t action, mods;
+            if (!ReadValue(&delay) || !ReadValue(&key) || !ReadValue(&scancode) || !ReadValue(&action) || !ReadValue(&mods))
+                break;
+            KeyCallback(window, key, scancode, action, mods);
+        }
+        else if (type == INPUT_RECORD_CURSOR)
+        {
+            double xpos, ypos;
+            if (!ReadValue(&delay) || !ReadValue(&xpos) || !ReadValue(&ypos))
+                break;
+            CursorPosCallback(window, xpos, ypos);
+        }
+        else
+        {
+            fprintf(stderr, "ERROR: Unknown input log record %d.\n", type);
+            g_InputReplayOffset = g_InputReplayData.size();
+        }
+    }
+    g_InputDispatching = false;
+}
+
+bool Input_AcceptEvent()
+{
+    return !g_InputReplaying || g_InputDispatching;
+}
+
+void Input_RecordKey(int key, int scancode, int action, int mods)
+{
+    if (g_InputRecordFile == NULL)
+        return;
+
+    WriteValue<uint8_t>(INPUT_RECORD_KEY);
+    WriteValue<float>((float)(glfwGetTime() - g_InputFrameStart));
+    WriteValue<int16_t>((int16_t)key);
+    WriteValue<int16_t>((int16_t)scancode);
+    WriteValue<uint8_t>((uint8_t)action);
+    WriteValue<uint8_t>((uint8_t)mods);
+}
+
+void Input_RecordCursorPos(double xpos, double ypos)
+{
+    if (g_InputRecordFile == NULL)
+        return;
+
+    WriteValue<uint8_t>(INPUT_RECORD_CURSOR);
+    WriteValue<float>((float)(glfwGetTime() - g_InputFrameStart));
+    WriteValue<double>(xpos);
+    WriteValue<double>(ypos);
+}
+
+void Input_Finish()
+{
+    if (g_InputRecordFile != NULL)
+    {
+        fclose(g_InputRecordFile);
+        g_InputRecordFile = NULL;
+    }
+}
@@ -0,0 +1,436 @@
+// Texturas dos materiais em um GL_TEXTURE_2D_ARRAY. Veja "materials.h".
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+#include "materials.h"
+#include "textureupload.h"
+#include "texturememory.h"
+#include "trace.h"
+
+// Formatos comprimidos sRGB. A GLAD foi gerada somente com o OpenGL 3.3,
+// sem extensoes; S3TC vem de GL_EXT_texture_compression_s3tc (com
+// GL_EXT_texture_sRGB) e BPTC de GL_ARB_texture_compression_bptc ou do
+// OpenGL 4.2.
+#define GL_COMPRESSED_SRGB_S3TC_DXT1_EXT       0x8C4C
+#define GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT 0x8C4F
+#define GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM    0x8E8D
+
+static GLuint g_MaterialTextures[MATERIAL_RESOLUTION_TIERS];   // Um array por nivel de resolucao
+static GLuint g_MaterialSampler = 0;
+static int    g_MaterialCount = 0;
+
+bool Materials_IsFormatSupported(TextureCacheFormat format)
+{
+    GLint major = 0, minor = 0;
+    glGetIntegerv(GL_MAJOR_VERSION, &major);
+    glGetIntegerv(GL_MINOR_VERSION, &minor);
+    switch (format)
+    {
+    case TEXTURE_CACHE_RGB8:
+    case TEXTURE_CACHE_RGBA8:
+        return true;
+    case TEXTURE_CACHE_BC1:
+    case TEXTURE_CACHE_BC3:
+        // As variantes sRGB vem de GL_EXT_texture_sRGB, que nem sempre e
+        // listada em contextos core; se o driver as recusar, a alocacao do
+        // array falha e Materials_CreateTexture() volta ao RGBA8
+        return TextureUpload_HasGLExtension("GL_EXT_texture_compression_s3tc");
+    case TEXTURE_CACHE_BC7:
+        return major > 4 || (major == 4 && minor >= 2) || TextureUpload_HasGLExtension("GL_ARB_texture_compression_bptc");
+    }
+    return false;
+}
+
+static GLenum InternalFormat(int format)
+{
+    switch (format)
+    {
+    case TEXTURE_CACHE_BC1: return GL_COMPRESSED_SRGB_S3TC_DXT1_EXT;
+    case TEXTURE_CACHE_BC3: return GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT;
+    case TEXTURE_CACHE_BC7: return GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM;
+    case TEXTURE_CACHE_RGBA8: return GL_SRGB8_ALPHA8;
+    }
+    return GL_SRGB8;
+}
+
+// Uma imagem em leitura: preenchida pela thread de trabalho e consumida
+// pela thread do OpenGL
+struct MaterialLoad
+{
+    std::string   filename;
+    int           priority;
+    int           base_tier;    // Niveis que a imagem nao tem, por ser menor que a camada maior
+    int           tier;         // Niveis de mipmap ignorados (array do material)
+    int           layer;        // Camada no array
+    CookedTexture texture;
+    bool          ok;
+    double        read_ms;      // Tempo de TextureCache_Load()
+};
+
+static std::vector<MaterialLoad> g_MaterialLoads;
+static std::vector<std::thread>  g_MaterialWorkers;
+static TextureCacheFormat        g_MaterialFormat = TEXTURE_CACHE_RGBA8;
+static BcQuality                 g_MaterialQuality = BC_QUALITY_NORMAL;
+static size_t                    g_MaterialMemoryBudget = 0;
+static int                       g_MaterialTierLayers[MATERIAL_RESOLUTION_TIERS];
+static std::atomic<int>          g_MaterialNextLoad(0);
+static int                       g_MaterialEncodeThreads = 1;   // Threads da compressao em cada thread de trabalho
+
+// Indices de g_MaterialLoads na ordem em que as leituras terminaram
+static std::mutex                g_MaterialMutex;
+static std::vector<int>          g_MaterialCompletionOrder;
+
+// Leituras ja entregues ao envio (veja Materials_Update()) e inicio da leitura
+static int                                   g_MaterialHanded = 0;
+static std::chrono::steady_clock::time_point g_MaterialBegin;
+
+static double ElapsedMs(std::chrono::steady_clock::time_point begin)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+}
+
+static void LoadWorker()
+{
+    Trace_SetThreadName("Materials");
+    for (int i = g_MaterialNextLoad.fetch_add(1); i < (int)g_MaterialLoads.size(); i = g_MaterialNextLoad.fetch_add(1))
+    {
+        MaterialLoad& load = g_MaterialLoads[i];
+        {
+            TRACE_ZONE_DETAIL("Materials_Read", load.filename.c_str());
+            std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+            load.ok = TextureCache_Load(load.filename.c_str(), MATERIAL_TEXTURE_WIDTH >> load.base_tier,
+                                        MATERIAL_TEXTURE_HEIGHT >> load.base_tier, g_MaterialFormat, g_MaterialQuality, g_MaterialEncodeThreads, &load.texture);
+            load.read_ms = ElapsedMs(begin);
+        }
+
+        std::lock_guard<std::mutex> lock(g_MaterialMutex);
+        g_MaterialCompletionOrder.push_back(i);
+    }
+}
+
+// Numero de niveis de mipmap das camadas (o mesmo calculado pelo cache de
+// texturas)
+static int NumLevels()
+{
+    int num_levels = 1;
+    while (num_levels < TEXTURE_CACHE_MAX_LEVELS
+           && ((MATERIAL_TEXTURE_WIDTH >> (num_levels - 1)) > 1 || (MATERIAL_TEXTURE_HEIGHT >> (num_levels - 1)) > 1))
+        num_levels += 1;
+    return num_levels;
+}
+
+// Bytes de uma camada sem os "tier" primeiros niveis
+static size_t LayerBytes(TextureCacheFormat format, int tier)
+{
+    size_t bytes = 0;
+    for (int level = tier; level < NumLevels(); ++level)
+        bytes += TextureCache_LevelSize(format, std::max(1, MATERIAL_TEXTURE_WIDTH >> level),
+                                        std::max(1, MATERIAL_TEXTURE_HEIGHT >> level));
+    return bytes;
+}
+
+// Primeiro nivel de resolucao que cabe dentro da imagem "filename", para
+// que ela nunca seja ampliada ao gerar o cache: uma imagem de 2000x738 fica
+// com camadas de 1024x512, no array 1, em vez de ser ampliada para
+// 2048x1024. Imagens menores que o ultimo nivel sao ampliadas para ele.
+static int BaseTier(const std::string& filename)
+{
+    // Uma imagem que nao pode ser lida e informada ao fim da leitura
+    int width, height;
+    if (!TextureCache_ImageSize(filename.c_str(), &width, &height))
+        return 0;
+
+    int tier = 0;
+    while (tier < MATERIAL_RESOLUTION_TIERS - 1
+           && ((MATERIAL_TEXTURE_WIDTH >> tier) > width || (MATERIAL_TEXTURE_HEIGHT >> tier) > height))
+        tier += 1;
+    return tier;
+}
+
+// Escolhe quantos niveis cada material ignora para que o total caiba no
+// orcamento: a cada passo, o material de menor prioridade (e, entre os de
+// mesma prioridade, o maior) perde o seu nivel mais fino. Depois distribui
+// as camadas dos arrays de cada nivel de resolucao.
+static void FitMemoryBudget()
+{
+    size_t total = 0;
+    for (size_t i = 0; i < g_MaterialLoads.size(); ++i)
+    {
+        g_MaterialLoads[i].tier = g_MaterialLoads[i].base_tier;
+        total += LayerBytes(g_MaterialFormat, g_MaterialLoads[i].base_tier);
+    }
+
+    while (g_MaterialMemoryBudget > 0 && total > g_MaterialMemoryBudget)
+    {
+        int chosen = -1;
+        for (int i = 0; i < (int)g_MaterialLoads.size(); ++i)
+        {
+            const MaterialLoad& load = g_MaterialLoads[i];
+            if (load.tier == MATERIAL_RESOLUTION_TIERS - 1)
+                continue;
+            if (chosen < 0 || load.priority < g_MaterialLoads[chosen].priority
+                || (load.priority == g_MaterialLoads[chosen].priority && load.tier < g_MaterialLoads[chosen].tier))
+                chosen = i;
+        }
+        if (chosen < 0)
+        {
+            fprintf(stderr, "WARNING: Material textures need %.1f MB, above the %.1f MB texture memory budget.\n",
+                    total / (1024.0 * 1024.0), g_MaterialMemoryBudget / (1024.0 * 1024.0));
+            break;
+        }
+
+        MaterialLoad& load = g_MaterialLoads[chosen];
+        total -= LayerBytes(g_MaterialFormat, load.tier) - LayerBytes(g_MaterialFormat, load.tier + 1);
+        load.tier += 1;
+    }
+
+    for (int tier = 0; tier < MATERIAL_RESOLUTION_TIERS; ++tier)
+        g_MaterialTierLayers[tier] = 0;
+    for (size_t i = 0; i < g_MaterialLoads.size(); ++i)
+        g_MaterialLoads[i].layer = g_MaterialTierLayers[g_MaterialLoads[i].tier]++;
+
+    if (g_MaterialMemoryBudget > 0)
+        printf("Materiais: %.1f MB de texturas (orcamento de %.1f MB).\n", total / (1024.0 * 1024.0),
+               g_MaterialMemoryBudget / (1024.0 * 1024.0));
+}
+
+void Materials_BeginLoad(const std::vector<std::string>& filenames, const std::vector<int>& priorities,
+                         TextureCacheFormat format, BcQuality quality, size_t memory_budget)
+{
+    g_MaterialLoads.assign(filenames.size(), MaterialLoad());
+    for (size_t i = 0; i < filenames.size(); ++i)
+    {
+        g_MaterialLoads[i].filename = filenames[i];
+        g_MaterialLoads[i].priority = priorities[i];
+        g_MaterialLoads[i].base_tier = BaseTier(filenames[i]);
+    }
+    g_MaterialFormat = format;
+    g_MaterialQuality = quality;
+    g_MaterialMemoryBudget = memory_budget;
+    FitMemoryBudget();
+    g_MaterialNextLoad = 0;
+    g_MaterialCompletionOrder.clear();
+    g_MaterialHanded = 0;
+    g_MaterialBegin = std::chrono::steady_clock::now();
+
+    // Os nucleos sao divididos entre as threads de trabalho: cada uma
+    // comprime seus niveis em hardware_concurrency / num_threads threads, em
+    // vez de criar uma thread por nucleo para cada nivel
+    int num_cores = std::max(1, (int)std::thread::hardware_concurrency());
+    int num_threads = std::min((int)filenames.size(), MATERIAL_LOAD_THREADS);
+    num_threads = std::min(num_threads, num_cores);
+    g_MaterialEncodeThreads = std::max(1, num_cores / std::max(1, num_threads));
+    for (int i = 0; i < num_threads; ++i)
+        g_MaterialWorkers.push_back(std::thread(LoadWorker));
+}
+
+// Espera as threads de trabalho e libera as imagens que nao foram entregues
+// ao envio
+static void EndLoad()
+{
+    for (size_t i = 0; i < g_MaterialWorkers.size(); ++i)
+        g_MaterialWorkers[i].join();
+    g_MaterialWorkers.clear();
+    for (size_t i = 0; i < g_MaterialLoads.size(); ++i)
+        TextureCache_Release(&g_MaterialLoads[i].texture);
+}
+
+// Aloca os niveis do array ligado em GL_TEXTURE_2D_ARRAY, sem os "tier"
+// primeiros niveis das imagens. O tamanho e o formato das camadas sao
+// conhecidos antes de qualquer imagem ficar pronta. Retorna false se o
+// OpenGL acusar erro.
+static bool Allocate(TextureCacheFormat format, int num_layers, int tier)
+{
+    while (glGetError() != GL_NO_ERROR)
+        ;
+
+    GLenum internal_format = InternalFormat(format);
+    int num_levels = NumLevels() - tier;
+    for (int level = 0; level < num_levels; ++level)
+    {
+        int width = std::max(1, MATERIAL_TEXTURE_WIDTH >> (tier + level));
+        int height = std::max(1, MATERIAL_TEXTURE_HEIGHT >> (tier + level));
+        if (format == TEXTURE_CACHE_RGB8 || format == TEXTURE_CACHE_RGBA8)
+            glTexImage3D(GL_TEXTURE_2D_ARRAY, level, internal_format, width, height, num_layers, 0,
+                         format == TEXTURE_CACHE_RGB8 ? GL_RGB : GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+        else
+            glCompressedTexImage3D(GL_TEXTURE_2D_ARRAY, level, internal_format, width, height, num_layers, 0,
+                                   (GLsizei)(TextureCache_LevelSize(format, width, height) * num_layers), NULL);
+    }
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL, num_levels - 1);
+    return glGetError() == GL_NO_ERROR;
+}
+
+bool Materials_CreateTexture(GLuint first_texture_unit)
+{
+    TRACE_ZONE("Materials_CreateTexture");
+
+    g_MaterialCount = 0;
+    int num_layers = (int)g_MaterialLoads.size();
+    if (num_layers == 0)
+        return true;
+
+    GLint max_layers = 0;
+    glGetIntegerv(GL_MAX_ARRAY_TEXTURE_LAYERS, &max_layers);
+    for (int tier = 0; tier < MATERIAL_RESOLUTION_TIERS; ++tier)
+    {
+        if (g_MaterialTierLayers[tier] > max_layers)
+        {
+            fprintf(stderr, "ERROR: %d materials, but the GPU supports at most %d texture array layers.\n",
+                    g_MaterialTierLayers[tier], max_layers);
+            EndLoad();
+            return false;
+        }
+    }
+
+    if (g_MaterialSampler == 0)
+    {
+        glGenTextures(MATERIAL_RESOLUTION_TIERS, g_MaterialTextures);
+        glGenSamplers(1, &g_MaterialSampler);
+
+        // Veja slide 95-96 do documento Aula_20_Mapeamento_de_Texturas.pdf
+        glSamplerParameteri(g_MaterialSampler, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glSamplerParameteri(g_MaterialSampler, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+        glSamplerParameteri(g_MaterialSampler, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+        glSamplerParameteri(g_MaterialSampler, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    }
+
+    // Cada nivel de resolucao usado e um array, na unidade de textura
+    // first_texture_unit + nivel
+    bool allocated = true;
+    for (int tier = 0; tier < MATERIAL_RESOLUTION_TIERS; ++tier)
+    {
+        if (g_MaterialTierLayers[tier] == 0)
+            continue;
+        glActiveTexture(GL_TEXTURE0 + first_texture_unit + tier);
+        glBindTexture(GL_TEXTURE_2D_ARRAY, g_MaterialTextures[tier]);
+        glBindSampler(first_texture_unit + tier, g_MaterialSampler);
+        allocated = allocated && Allocate(g_MaterialFormat, g_MaterialTierLayers[tier], tier);
+    }
+    if (!allocated)
+    {
+        if (g_MaterialFormat == TEXTURE_CACHE_RGBA8)
+        {
+            fprintf(stderr, "ERROR: Cannot allocate material textures.\n");
+            EndLoad();
+            return false;
+        }
+
+        // O driver recusou o formato comprimido: lemos as imagens de novo,
+        // sem compressao
+        fprintf(stderr, "WARNING: Cannot allocate %s material textures, using rgba8.\n",
+                TextureCache_FormatName(g_MaterialFormat));
+        std::vector<std::string> filenames;
+        std::vector<int> priorities;
+        for (int i = 0; i < num_layers; ++i)
+        {
+            filenames.push_back(g_MaterialLoads[i].filename);
+            priorities.push_back(g_MaterialLoads[i].priority);
+        }
+        EndLoad();
+        Materials_BeginLoad(filenames, priorities, TEXTURE_CACHE_RGBA8, g_MaterialQuality, g_MaterialMemoryBudget);
+        return Materials_CreateTexture(first_texture_unit);
+    }
+
+    for (int tier = 0; tier < MATERIAL_RESOLUTION_TIERS; ++tier)
+        if (g_MaterialTierLayers[tier] > 0)
+            TextureUpload_RegisterArray(g_MaterialTextures[tier], InternalFormat(g_MaterialFormat),
+                                        g_MaterialTierLayers[tier], NumLevels() - tier);
+
+    // Contabilizamos cada material com os niveis que ele realmente ocupa
+    for (int i = 0; i < num_layers; ++i)
+    {
+        const MaterialLoad& load = g_MaterialLoads[i];
+        char description[128];
+        snprintf(description, sizeof(description), "material, camada %d do array %d, %dx%d, %d niveis, %s",
+                 load.layer, load.tier, std::max(1, MATERIAL_TEXTURE_WIDTH >> load.tier),
+                 std::max(1, MATERIAL_TEXTURE_HEIGHT >> load.tier), NumLevels() - load.tier,
+                 TextureCache_FormatName(g_MaterialFormat));
+        TextureMemory_Set(load.filename.c_str(), description, LayerBytes(g_MaterialFormat, load.tier));
+    }
+    g_MaterialCount = num_layers;
+    return true;
+}
+
+void Materials_Update()
+{
+    if (g_MaterialWorkers.empty())
+        return;
+
+    // Pegamos, sem esperar, as leituras que terminaram desde o ultimo quadro
+    std::vector<int> completed;
+    {
+        std::lock_guard<std::mutex> lock(g_MaterialMutex);
+        completed.assign(g_MaterialCompletionOrder.begin() + g_MaterialHanded, g_MaterialCompletionOrder.end());
+    }
+    g_MaterialHanded += (int)completed.size();
+
+    for (size_t k = 0; k < completed.size(); ++k)
+    {
+        int i = completed[k];
+        MaterialLoad& load = g_MaterialLoads[i];
+        if (!load.ok)
+        {
+            fprintf(stderr, "ERROR: Cannot open image file \"%s\".\n", load.filename.c_str());
+            TextureUpload_SkipLayer(g_MaterialTextures[load.tier], load.layer);
+            continue;
+        }
+
+        CookedTexture& texture = load.texture;
+        printf("Imagem \"%s\": camada %d do array %d, %dx%d, %d niveis (%d ignorados), %s, %s; leitura %.1f ms.\n",
+               load.filename.c_str(), load.layer, load.tier, texture.width, texture.height, texture.num_levels,
+               load.tier - load.base_tier, TextureCache_FormatName((TextureCacheFormat)texture.format),
+               texture.from_cache ? "cache" : "decodificada", load.read_ms);
+        if (texture.width != (MATERIAL_TEXTURE_WIDTH >> load.base_tier)
+            || texture.height != (MATERIAL_TEXTURE_HEIGHT >> load.base_tier)
+            || texture.num_levels != NumLevels() - load.base_tier || texture.format != g_MaterialFormat)
+        {
+            fprintf(stderr, "ERROR: Unexpected size or format in image file \"%s\".\n", load.filename.c_str());
+            TextureUpload_SkipLayer(g_MaterialTextures[load.tier], load.layer);
+            continue;
+        }
+        TextureUpload_Add(g_MaterialTextures[load.tier], load.layer, &texture, load.tier - load.base_tier,
+                          load.filename.c_str());
+    }
+
+    if (g_MaterialHanded == (int)g_MaterialLoads.size())
+    {
+        printf("Materiais: %d imagens lidas em %d threads em %.1f ms.\n", (int)g_MaterialLoads.size(),
+               (int)g_MaterialWorkers.size(), ElapsedMs(g_MaterialBegin));
+        EndLoad();
+    }
+}
+
+bool Materials_IsLoading()
+{
+    return !g_MaterialWorkers.empty();
+}
+
+void Materials_Shutdown()
+{
+    EndLoad();
+}
+
+int Materials_Count()
+{
+    return g_MaterialCount;
+}
+
+int Materials_Tier(int material)
+{
+    if (material < 0 || material >= (int)g_MaterialLoads.size())
+        return 0;
+    return g_MaterialLoads[material].tier;
+}
+
+int Materials_Layer(int material)
+{
+    if (material < 0 || material >= (int)g_MaterialLoads.size())
+        return 0;
+    return g_MaterialLoads[material].layer;
+}
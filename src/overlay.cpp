@@ -0,0 +1,68 @@
+// Mensagens temporizadas sobre a cena. Veja "overlay.h".
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "hud.h"
+#include "overlay.h"
+
+float TextRendering_LineHeight(GLFWwindow* window); // Funcao definida em "textrendering.cpp"
+
+struct OverlayMessage
+{
+    char   text[OVERLAY_MESSAGE_LENGTH];
+    double duration;
+    double expire_time;    // Negativo ate a mensagem ser desenhada
+};
+
+// Fila em ordem de chegada, com capacidade fixa
+static OverlayMessage g_OverlayMessages[OVERLAY_CAPACITY];
+static int g_OverlayCount = 0;
+
+static void RemoveMessage(int index)
+{
+    memmove(&g_OverlayMessages[index], &g_OverlayMessages[index + 1],
+            (g_OverlayCount - index - 1) * sizeof(OverlayMessage));
+    --g_OverlayCount;
+}
+
+void Overlay_Post(const char* message, double duration)
+{
+    if (g_OverlayCount == OVERLAY_CAPACITY)
+        RemoveMessage(0);
+
+    OverlayMessage& m = g_OverlayMessages[g_OverlayCount++];
+    snprintf(m.text, OVERLAY_MESSAGE_LENGTH, "%s", message);
+    m.duration = duration;
+    m.expire_time = -1.0;
+}
+
+void Overlay_Update(GLFWwindow* window, double now)
+{
+    // O tempo de uma mensagem comeca a contar no primeiro quadro em que ela
+    // aparece, e nao quando foi enfileirada
+    for (int i = 0; i < g_OverlayCount; )
+    {
+        OverlayMessage& m = g_OverlayMessages[i];
+        if (m.duration >= 0.0 && m.expire_time < 0.0)
+            m.expire_time = now + m.duration;
+
+        if (m.duration >= 0.0 && now >= m.expire_time)
+            RemoveMessage(i);
+        else
+            ++i;
+    }
+
+    if (g_OverlayCount == 0)
+    {
+        Hud_Hide(HUD_OVERLAY);
+        return;
+    }
+
+    std::string text = g_OverlayMessages[0].text;
+    for (int i = 1; i < g_OverlayCount; ++i)
+        text += std::string("\n") + g_OverlayMessages[i].text;
+
+    float padding = TextRendering_LineHeight(window);
+    Hud_SetText(HUD_OVERLAY, text, -0.7f + padding/3, 0.4f + 2*padding/5);
+}
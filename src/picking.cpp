@@ -0,0 +1,518 @@
+// Selecao de objetos por raio com BVH de triangulos. Veja "picking.h".
+#include <cmath>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+#include <algorithm>
+
+#include "picking.h"
+#include "trace.h"
+
+// Numero de "bins" avaliados por eixo na construcao com SAH
+#define PICK_BINS 12
+
+// Folhas com ate este numero de triangulos podem ser mantidas quando a SAH
+// indicar que dividir nao compensa
+#define PICK_MAX_LEAF_TRIANGLES 8
+
+// Profundidade maxima da pilha de travessia. A travessia empilha no maximo
+// um no por nivel, entao BuildBvh() transforma em folha todo no nesta
+// profundidade, qualquer que seja a malha.
+#define PICK_STACK_SIZE 64
+
+// No da BVH (32 bytes). Em nos internos, "count" e zero e os filhos estao em
+// "first" e "first + 1"; em folhas, os triangulos sao
+// triangles[first .. first + count - 1].
+struct PickNode
+{
+    float bmin[3];
+    int   first;
+    float bmax[3];
+    int   count;
+};
+
+// Triangulo pre-processado para o teste de Moller-Trumbore: um vertice e as
+// duas arestas que partem dele
+struct PickTriangle
+{
+    float v0[3];
+    float e1[3];
+    float e2[3];
+};
+
+struct PickMesh
+{
+    std::vector<PickNode>     nodes;
+    std::vector<PickTriangle> triangles;
+};
+
+struct PickInstance
+{
+    int         mesh;
+    std::string name;
+    float       bmin[3], bmax[3]; // AABB em coordenadas globais
+    float       inverse[12];      // Inversa da matriz de modelagem (3 linhas de uma matriz afim)
+};
+
+static std::vector<PickMesh>     g_PickMeshes;
+static std::vector<PickInstance> g_PickInstances;
+
+static float HalfArea(const float* bmin, const float* bmax)
+{
+    float dx = bmax[0] - bmin[0], dy = bmax[1] - bmin[1], dz = bmax[2] - bmin[2];
+    return dx*dy + dy*dz + dz*dx;
+}
+
+static void ResetBounds(float* bmin, float* bmax)
+{
+    for (int k = 0; k < 3; ++k)
+    {
+        bmin[k] = std::numeric_limits<float>::max();
+        bmax[k] = std::numeric_limits<float>::lowest();
+    }
+}
+
+static void GrowBounds(float* bmin, float* bmax, const float* other_min, const float* other_max)
+{
+    for (int k = 0; k < 3; ++k)
+    {
+        bmin[k] = std::min(bmin[k], other_min[k]);
+        bmax[k] = std::max(bmax[k], other_max[k]);
+    }
+}
+
+// Dados de cada triangulo usados somente durante a construcao
+struct PickBuildTriangle
+{
+    float bmin[3], bmax[3], centroid[3];
+};
+
+static void ComputeNodeBounds(PickNode& node, const std::vector<int>& order, const std::vector<PickBuildTriangle>& info)
+{
+    ResetBounds(node.bmin, node.bmax);
+    for (int i = node.first; i < node.first + node.count; ++i)
+        GrowBounds(node.bmin, node.bmax, info[order[i]].bmin, info[order[i]].bmax);
+}
+
+static void BuildBvh(PickMesh& mesh, std::vector<PickTriangle>& triangles)
+{
+    int n = (int)triangles.size();
+    if (n == 0)
+        return;
+
+    std::vector<int> order(n);
+    std::vector<PickBuildTriangle> info(n);
+    for (int i = 0; i < n; ++i)
+    {
+        const PickTriangle& t = triangles[i];
+        PickBuildTriangle& b = info[i];
+        for (int k = 0; k < 3; ++k)
+        {
+            float a = t.v0[k], p1 = a + t.e1[k], p2 = a + t.e2[k];
+            b.bmin[k] = std::min(a, std::min(p1, p2));
+            b.bmax[k] = std::max(a, std::max(p1, p2));
+            b.centroid[k] = (a + p1 + p2) / 3.0f;
+        }
+        order[i] = i;
+    }
+
+    mesh.nodes.reserve(2 * n);
+    PickNode root;
+    root.first = 0;
+    root.count = n;
+    ComputeNodeBounds(root, order, info);
+    mesh.nodes.push_back(root);
+
+    // Nos a dividir e suas profundidades
+    std::vector<std::pair<int, int> > work(1, std::make_pair(0, 0));
+    while (!work.empty())
+    {
+        int node_index = work.back().first;
+        int depth = work.back().second;
+        work.pop_back();
+
+        int first = mesh.nodes[node_index].first;
+        int count = mesh.nodes[node_index].count;
+        if (count <= 2 || depth >= PICK_STACK_SIZE)
+            continue;
+
+        // Limites dos centroides, que definem os "bins"
+        float cmin[3], cmax[3];
+        ResetBounds(cmin, cmax);
+        for (int i = first; i < first + count; ++i)
+            GrowBounds(cmin, cmax, info[order[i]].centroid, info[order[i]].centroid);
+
+        // Avaliamos a SAH em cada divisao entre "bins" de cada eixo
+        float best_cost = std::numeric_limits<float>::max();
+        int best_axis = -1, best_split = 0;
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            float extent = cmax[axis] - cmin[axis];
+            if (extent <= 1e-12f)
+                continue;
+            float scale = PICK_BINS / extent;
+
+            int   bin_count[PICK_BINS] = { 0 };
+            float bin_min[PICK_BINS][3], bin_max[PICK_BINS][3];
+            for (int b = 0; b < PICK_BINS; ++b)
+                ResetBounds(bin_min[b], bin_max[b]);
+
+            for (int i = first; i < first + count; ++i)
+            {
+                const PickBuildTriangle& t = info[order[i]];
+                int b = std::min((int)((t.centroid[axis] - cmin[axis]) * scale), PICK_BINS - 1);
+                bin_count[b] += 1;
+                GrowBounds(bin_min[b], bin_max[b], t.bmin, t.bmax);
+            }
+
+            // Custo da esquerda acumulado da esquerda para a direita, e da
+            // direita acumulado no sentido contrario
+            float left_cost[PICK_BINS - 1];
+            float lmin[3], lmax[3];
+            int left = 0;
+            ResetBounds(lmin, lmax);
+            for (int b = 0; b < PICK_BINS - 1; ++b)
+            {
+                left += bin_count[b];
+                if (bin_count[b] > 0)
+                    GrowBounds(lmin, lmax, bin_min[b], bin_max[b]);
+                left_cost[b] = left > 0 ? left * HalfArea(lmin, lmax) : 0.0f;
+            }
+
+            float rmin[3], rmax[3];
+            int right = 0;
+            ResetBounds(rmin, rmax);
+            for (int b = PICK_BINS - 1; b > 0; --b)
+            {
+                right += bin_count[b];
+                if (bin_count[b] > 0)
+                    GrowBounds(rmin, rmax, bin_min[b], bin_max[b]);
+                if (right == 0 || right == count)
+                    continue;
+                float cost = left_cost[b - 1] + right * HalfArea(rmin, rmax);
+                if (cost < best_cost)
+                {
+                    best_cost = cost;
+                    best_axis = axis;
+                    best_split = b;
+                }
+            }
+        }
+
+        const PickNode& node = mesh.nodes[node_index];
+        float leaf_cost = count * HalfArea(node.bmin, node.bmax);
+        if (best_axis < 0 || (best_cost >= leaf_cost && count <= PICK_MAX_LEAF_TRIANGLES))
+            continue;
+
+        // Particionamos os triangulos do no de acordo com a divisao escolhida
+        float scale = PICK_BINS / (cmax[best_axis] - cmin[best_axis]);
+        int i = first, j = first + count - 1;
+        while (i <= j)
+        {
+            int b = std::min((int)((info[order[i]].centroid[best_axis] - cmin[best_axis]) * scale), PICK_BINS - 1);
+            if (b < best_split)
+                ++i;
+            else
+                std::swap(order[i], order[j--]);
+        }
+
+        int left_count = i - first;
+        if (left_count == 0 || left_count == count)
+            continue;
+
+        PickNode left, right;
+        left.first = first;
+        left.count = left_count;
+        right.first = i;
+        right.count = count - left_count;
+        ComputeNodeBounds(left, order, info);
+        ComputeNodeBounds(right, order, info);
+
+        int left_index = (int)mesh.nodes.size();
+        mesh.nodes.push_back(left);
+        mesh.nodes.push_back(right);
+        mesh.nodes[node_index].first = left_index;
+        mesh.nodes[node_index].count = 0;
+
+        work.push_back(std::make_pair(left_index, depth + 1));
+        work.push_back(std::make_pair(left_index + 1, depth + 1));
+    }
+
+    // Triangulos na ordem das folhas
+    mesh.triangles.resize(n);
+    for (int i = 0; i < n; ++i)
+        mesh.triangles[i] = triangles[order[i]];
+}
+
+int Pick_AddShape(const tinyobj::attrib_t& attrib, const tinyobj::shape_t& shape)
+{
+    TRACE_ZONE_DETAIL("Pick_AddShape", shape.name.c_str());
+
+    std::vector<PickTriangle> triangles;
+    size_t num_triangles = shape.mesh.num_face_vertices.size();
+    triangles.reserve(num_triangles);
+
+    for (size_t triangle = 0; triangle < num_triangles; ++triangle)
+    {
+        if (shape.mesh.num_face_vertices[triangle] != 3)
+            continue;
+
+        float p[3][3];
+        for (int vertex = 0; vertex < 3; ++vertex)
+        {
+            int index = shape.mesh.indices[3*triangle + vertex].vertex_index;
+            p[vertex][0] = attrib.vertices[3*index + 0];
+            p[vertex][1] = attrib.vertices[3*index + 1];
+            p[vertex][2] = attrib.vertices[3*index + 2];
+        }
+
+        PickTriangle t;
+        for (int k = 0; k < 3; ++k)
+        {
+            t.v0[k] = p[0][k];
+            t.e1[k] = p[1][k] - p[0][k];
+            t.e2[k] = p[2][k] - p[0][k];
+        }
+        triangles.push_back(t);
+    }
+
+    g_PickMeshes.push_back(PickMesh());
+    BuildBvh(g_PickMeshes.back(), triangles);
+    return (int)g_PickMeshes.size() - 1;
+}
+
+int Pick_MeshTriangles(int mesh)
+{
+    return (int)g_PickMeshes[mesh].triangles.size();
+}
+
+int Pick_MeshNodes(int mesh)
+{
+    return (int)g_PickMeshes[mesh].nodes.size();
+}
+
+void Pick_ClearInstances()
+{
+    g_PickInstances.clear();
+}
+
+void Pick_AddInstance(int mesh, const glm::mat4& model, const char* name)
+{
+    if (mesh < 0 || mesh >= (int)g_PickMeshes.size() || g_PickMeshes[mesh].nodes.empty())
+        return;
+
+    PickInstance instance;
+    instance.mesh = mesh;
+    instance.name = name;
+
+    // AABB global: transformamos os oito cantos da caixa da raiz
+    const PickNode& root = g_PickMeshes[mesh].nodes[0];
+    ResetBounds(instance.bmin, instance.bmax);
+    for (int corner = 0; corner < 8; ++corner)
+    {
+        glm::vec4 p = model * glm::vec4((corner & 1) ? root.bmax[0] : root.bmin[0],
+                                        (corner & 2) ? root.bmax[1] : root.bmin[1],
+                                        (corner & 4) ? root.bmax[2] : root.bmin[2],
+                                        1.0f);
+        float q[3] = { p.x, p.y, p.z };
+        GrowBounds(instance.bmin, instance.bmax, q, q);
+    }
+
+    // Inversa da parte linear (3x3) por cofatores; a translacao inversa e
+    // -A^{-1} t. Os elementos da matriz sao model[coluna][linha].
+    float a[3][3];
+    for (int r = 0; r < 3; ++r)
+        for (int c = 0; c < 3; ++c)
+            a[r][c] = model[c][r];
+
+    float cof[3][3];
+    cof[0][0] = a[1][1]*a[2][2] - a[1][2]*a[2][1];
+    cof[0][1] = a[1][2]*a[2][0] - a[1][0]*a[2][2];
+    cof[0][2] = a[1][0]*a[2][1] - a[1][1]*a[2][0];
+    cof[1][0] = a[0][2]*a[2][1] - a[0][1]*a[2][2];
+    cof[1][1] = a[0][0]*a[2][2] - a[0][2]*a[2][0];
+    cof[1][2] = a[0][1]*a[2][0] - a[0][0]*a[2][1];
+    cof[2][0] = a[0][1]*a[1][2] - a[0][2]*a[1][1];
+    cof[2][1] = a[0][2]*a[1][0] - a[0][0]*a[1][2];
+    cof[2][2] = a[0][0]*a[1][1] - a[0][1]*a[1][0];
+
+    float det = a[0][0]*cof[0][0] + a[0][1]*cof[0][1] + a[0][2]*cof[0][2];
+    if (std::abs(det) < 1e-20f)
+        return;
+    float inv_det = 1.0f / det;
+
+    float t[3] = { model[3][0], model[3][1], model[3][2] };
+    for (int r = 0; r < 3; ++r)
+    {
+        // A inversa e a transposta da matriz de cofatores dividida pelo determinante
+        for (int c = 0; c < 3; ++c)
+            instance.inverse[4*r + c] = cof[c][r] * inv_det;
+        instance.inverse[4*r + 3] = -(instance.inverse[4*r + 0]*t[0] + instance.inverse[4*r + 1]*t[1] + instance.inverse[4*r + 2]*t[2]);
+    }
+
+    g_PickInstances.push_back(instance);
+}
+
+// Teste raio-AABB ("slabs"). Retorna a distancia de entrada ou infinito.
+static float RayBox(const float* bmin, const float* bmax, const float* o, const float* inv_d, float t_max)
+{
+    float t0 = 0.0f, t1 = t_max;
+    for (int k = 0; k < 3; ++k)
+    {
+        float ta = (bmin[k] - o[k]) * inv_d[k];
+        float tb = (bmax[k] - o[k]) * inv_d[k];
+        t0 = std::max(t0, std::min(ta, tb));
+        t1 = std::min(t1, std::max(ta, tb));
+    }
+    return t0 <= t1 ? t0 : std::numeric_limits<float>::infinity();
+}
+
+// Percorre a BVH, retornando o t do triangulo mais proximo (ou t_max)
+static float TraverseMesh(const PickMesh& mesh, const float* o, const float* d, float t_max, int* hit_triangle)
+{
+    float inv_d[3] = { 1.0f / d[0], 1.0f / d[1], 1.0f / d[2] };
+    float best = t_max;
+    const float inf = std::numeric_limits<float>::infinity();
+
+    if (mesh.nodes.empty() || RayBox(mesh.nodes[0].bmin, mesh.nodes[0].bmax, o, inv_d, best) == inf)
+        return best;
+
+    // Pilha com os nos a visitar e a distancia de entrada em cada um
+    int   stack_node[PICK_STACK_SIZE];
+    float stack_t[PICK_STACK_SIZE];
+    int   sp = 0;
+    int   node_index = 0;
+
+    for (;;)
+    {
+        const PickNode& node = mesh.nodes[node_index];
+        if (node.count > 0)
+        {
+            for (int i = node.first; i < node.first + node.count; ++i)
+            {
+                const PickTriangle& tri = mesh.triangles[i];
+                float p[3] = { d[1]*tri.e2[2] - d[2]*tri.e2[1], d[2]*tri.e2[0] - d[0]*tri.e2[2], d[0]*tri.e2[1] - d[1]*tri.e2[0] };
+                float det = tri.e1[0]*p[0] + tri.e1[1]*p[1] + tri.e1[2]*p[2];
+                if (std::abs(det) < 1e-12f)
+                    continue;
+                float inv_det = 1.0f / det;
+                float s[3] = { o[0] - tri.v0[0], o[1] - tri.v0[1], o[2] - tri.v0[2] };
+                float u = (s[0]*p[0] + s[1]*p[1] + s[2]*p[2]) * inv_det;
+                if (u < 0.0f || u > 1.0f)
+                    continue;
+                float q[3] = { s[1]*tri.e1[2] - s[2]*tri.e1[1], s[2]*tri.e1[0] - s[0]*tri.e1[2], s[0]*tri.e1[1] - s[1]*tri.e1[0] };
+                float v = (d[0]*q[0] + d[1]*q[1] + d[2]*q[2]) * inv_det;
+                if (v < 0.0f || u + v > 1.0f)
+                    continue;
+                float t = (tri.e2[0]*q[0] + tri.e2[1]*q[1] + tri.e2[2]*q[2]) * inv_det;
+                if (t > 1e-6f && t < best)
+                {
+                    best = t;
+                    *hit_triangle = i;
+                }
+            }
+        }
+        else
+        {
+            // Visitamos primeiro o filho mais proximo
+            int near_child = node.first, far_child = node.first + 1;
+            float t_near = RayBox(mesh.nodes[near_child].bmin, mesh.nodes[near_child].bmax, o, inv_d, best);
+            float t_far  = RayBox(mesh.nodes[far_child].bmin, mesh.nodes[far_child].bmax, o, inv_d, best);
+            if (t_far < t_near)
+            {
+                std::swap(near_child, far_child);
+                std::swap(t_near, t_far);
+            }
+
+            if (t_near != inf)
+            {
+                if (t_far != inf && sp < PICK_STACK_SIZE)
+                {
+                    stack_node[sp] = far_child;
+                    stack_t[sp] = t_far;
+                    ++sp;
+                }
+                node_index = near_child;
+                continue;
+            }
+        }
+
+        // Proximo no da pilha que ainda pode conter um triangulo mais proximo
+        bool found = false;
+        while (sp > 0)
+        {
+            --sp;
+            if (stack_t[sp] < best)
+            {
+                node_index = stack_node[sp];
+                found = true;
+                break;
+            }
+        }
+        if (!found)
+            break;
+    }
+
+    return best;
+}
+
+float Pick_RayMesh(int mesh, const float origin[3], const float direction[3], float max_t)
+{
+    int triangle = -1;
+    float t = TraverseMesh(g_PickMeshes[mesh], origin, direction, max_t, &triangle);
+    return triangle >= 0 ? t : -1.0f;
+}
+
+bool Pick_CastRay(glm::vec4 origin, glm::vec4 direction, float max_distance, PickHit* hit)
+{
+    float length = std::sqrt(direction.x*direction.x + direction.y*direction.y + direction.z*direction.z);
+    if (length <= 0.0f)
+        return false;
+
+    float o[3] = { origin.x, origin.y, origin.z };
+    float d[3] = { direction.x / length, direction.y / length, direction.z / length };
+    float inv_d[3] = { 1.0f / d[0], 1.0f / d[1], 1.0f / d[2] };
+
+    float best = max_distance;
+    int best_instance = -1, best_triangle = -1;
+
+    for (size_t i = 0; i < g_PickInstances.size(); ++i)
+    {
+        const PickInstance& instance = g_PickInstances[i];
+
+        // Primeiro a AABB global da instancia
+        if (RayBox(instance.bmin, instance.bmax, o, inv_d, best) == std::numeric_limits<float>::infinity())
+            continue;
+
+        // Depois a BVH, com o raio no sistema de coordenadas do modelo. Como
+        // a direcao nao e normalizada novamente, o parametro t continua sendo
+        // a distancia global.
+        const float* m = instance.inverse;
+        float lo[3], ld[3];
+        for (int r = 0; r < 3; ++r)
+        {
+            lo[r] = m[4*r]*o[0] + m[4*r + 1]*o[1] + m[4*r + 2]*o[2] + m[4*r + 3];
+            ld[r] = m[4*r]*d[0] + m[4*r + 1]*d[1] + m[4*r + 2]*d[2];
+        }
+
+        int triangle = -1;
+        float t = TraverseMesh(g_PickMeshes[instance.mesh], lo, ld, best, &triangle);
+        if (triangle >= 0)
+        {
+            best = t;
+            best_instance = (int)i;
+            best_triangle = triangle;
+        }
+    }
+
+    if (best_instance < 0)
+        return false;
+
+    hit->instance = best_instance;
+    hit->name = g_PickInstances[best_instance].name.c_str();
+    hit->distance = best;
+    hit->point = glm::vec4(o[0] + best*d[0], o[1] + best*d[1], o[2] + best*d[2], 1.0f);
+    hit->triangle = best_triangle;
+    return true;
+}
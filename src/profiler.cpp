@@ -0,0 +1,376 @@
+// Instrumentacao de desempenho por quadro. Veja "profiler.h".
+//
+// Os tempos de CPU sao medidos com o temporizador de alta resolucao da GLFW.
+// Os tempos de GPU sao medidos com consultas GL_TIMESTAMP (quadro inteiro) e
+// GL_TIME_ELAPSED (uma por fase), organizadas em um anel de
+// PROFILER_GPU_LATENCY conjuntos. O resultado de cada conjunto so e lido
+// quando GL_QUERY_RESULT_AVAILABLE indicar que ele ja esta pronto, normalmente
+// 2-3 quadros depois, de forma que o pipeline nunca e bloqueado.
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "hud.h"
+#include "profiler.h"
+#include "texturememory.h"
+#include "trace.h"
+
+float TextRendering_LineHeight(GLFWwindow* window); // Funcao definida em textrendering.cpp
+
+// Numero de quadros mantidos no historico (percentis e CSV)
+#define PROFILER_HISTORY 1024
+// Numero de conjuntos de consultas de GPU em voo
+#define PROFILER_GPU_LATENCY 4
+// Intervalo minimo (em segundos) entre atualizacoes do texto do HUD
+#define PROFILER_HUD_REFRESH 0.25
+
+static const char* const g_ProfilerZoneNames[PROFILER_NUM_ZONES] = {
+    "input", "draw", "pick", "cubes", "text", "upload"
+};
+
+// Dados de um quadro. Tempos de GPU ficam negativos ate serem lidos.
+struct ProfilerFrameSample
+{
+    unsigned long frame;
+    double frame_ms;   // Intervalo entre o inicio deste quadro e o anterior
+    double cpu_ms;     // Tempo de CPU entre Profiler_BeginFrame() e Profiler_EndFrame()
+    double gpu_ms;     // Tempo de GPU do quadro inteiro
+    double zone_cpu_ms[PROFILER_NUM_ZONES];
+    double zone_gpu_ms[PROFILER_NUM_ZONES];
+    int    draws;
+    long   triangles;
+};
+
+// Conjunto de consultas de GPU de um quadro
+struct ProfilerGpuQueries
+{
+    GLuint        frame_begin;
+    GLuint        frame_end;
+    GLuint        zone[PROFILER_NUM_ZONES];
+    bool          zone_issued[PROFILER_NUM_ZONES];
+    bool          pending;
+    unsigned long frame;
+};
+
+static ProfilerFrameSample g_ProfilerHistory[PROFILER_HISTORY];
+static ProfilerGpuQueries  g_ProfilerQueries[PROFILER_GPU_LATENCY];
+
+static bool          g_ProfilerInitialized = false;
+static unsigned long g_ProfilerFrame = 0;     // Numero do quadro atual
+static uint64_t      g_ProfilerFrameStart = 0;
+static uint64_t      g_ProfilerZoneStart[PROFILER_NUM_ZONES];
+static int           g_ProfilerActiveGpuZone = -1;
+static double        g_ProfilerTicksToMs = 0.0;
+
+static double        g_ProfilerHudLastUpdate = -1.0;
+static std::string   g_ProfilerHudLines[4];
+
+static ProfilerFrameSample& CurrentSample()
+{
+    return g_ProfilerHistory[g_ProfilerFrame % PROFILER_HISTORY];
+}
+
+// Le, sem bloquear, os resultados de todos os conjuntos de consultas que ja
+// estiverem disponiveis.
+void Profiler_ResolveGpuQueries()
+{
+    for (int i = 0; i < PROFILER_GPU_LATENCY; ++i)
+    {
+        ProfilerGpuQueries& q = g_ProfilerQueries[i];
+        if (!q.pending)
+            continue;
+
+        GLint available = 0;
+        glGetQueryObjectiv(q.frame_end, GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available)
+            continue;
+
+        // O quadro pode ja ter saido do historico se a GPU estiver muito atrasada
+        ProfilerFrameSample& s = g_ProfilerHistory[q.frame % PROFILER_HISTORY];
+        bool in_history = (s.frame == q.frame);
+
+        GLuint64 t0 = 0, t1 = 0;
+        glGetQueryObjectui64v(q.frame_begin, GL_QUERY_RESULT, &t0);
+        glGetQueryObjectui64v(q.frame_end, GL_QUERY_RESULT, &t1);
+        if (in_history)
+            s.gpu_ms = (t1 - t0) / 1.0e6;
+
+        for (int z = 0; z < PROFILER_NUM_ZONES; ++z)
+        {
+            if (!q.zone_issued[z])
+                continue;
+            GLuint64 elapsed = 0;
+            glGetQueryObjectui64v(q.zone[z], GL_QUERY_RESULT, &elapsed);
+            if (in_history)
+                s.zone_gpu_ms[z] = elapsed / 1.0e6;
+        }
+
+        q.pending = false;
+    }
+}
+
+void Profiler_Init()
+{
+    for (int i = 0; i < PROFILER_GPU_LATENCY; ++i)
+    {
+        ProfilerGpuQueries& q = g_ProfilerQueries[i];
+        glGenQueries(1, &q.frame_begin);
+        glGenQueries(1, &q.frame_end);
+        glGenQueries(PROFILER_NUM_ZONES, q.zone);
+        q.pending = false;
+    }
+
+    for (int i = 0; i < PROFILER_HISTORY; ++i)
+        g_ProfilerHistory[i].frame = (unsigned long)-1;
+
+    g_ProfilerTicksToMs = 1000.0 / (double)glfwGetTimerFrequency();
+    g_ProfilerInitialized = true;
+}
+
+void Profiler_BeginFrame()
+{
+    if (!g_ProfilerInitialized)
+        return;
+
+    uint64_t now = glfwGetTimerValue();
+    double frame_ms = (g_ProfilerFrameStart != 0) ? (now - g_ProfilerFrameStart) * g_ProfilerTicksToMs : 0.0;
+    g_ProfilerFrameStart = now;
+    g_ProfilerFrame += 1;
+
+    Profiler_ResolveGpuQueries();
+
+    ProfilerFrameSample& s = CurrentSample();
+    s.frame     = g_ProfilerFrame;
+    s.frame_ms  = frame_ms;
+    s.cpu_ms    = 0.0;
+    s.gpu_ms    = -1.0;
+    s.draws     = 0;
+    s.triangles = 0;
+    for (int z = 0; z < PROFILER_NUM_ZONES; ++z)
+    {
+        s.zone_cpu_ms[z] = 0.0;
+        s.zone_gpu_ms[z] = -1.0;
+    }
+
+    // Se o conjunto de consultas deste slot ainda nao ficou pronto, seu
+    // resultado e descartado: reutilizamos as consultas sem esperar a GPU.
+    ProfilerGpuQueries& q = g_ProfilerQueries[g_ProfilerFrame % PROFILER_GPU_LATENCY];
+    q.pending = false;
+    q.frame = g_ProfilerFrame;
+    for (int z = 0; z < PROFILER_NUM_ZONES; ++z)
+        q.zone_issued[z] = false;
+    glQueryCounter(q.frame_begin, GL_TIMESTAMP);
+}
+
+void Profiler_EndFrame()
+{
+    if (!g_ProfilerInitialized)
+        return;
+
+    ProfilerGpuQueries& q = g_ProfilerQueries[g_ProfilerFrame % PROFILER_GPU_LATENCY];
+    glQueryCounter(q.frame_end, GL_TIMESTAMP);
+    q.pending = true;
+
+    CurrentSample().cpu_ms = (glfwGetTimerValue() - g_ProfilerFrameStart) * g_ProfilerTicksToMs;
+}
+
+bool Profiler_GetLastFrame(ProfilerFrameStats* stats)
+{
+    if (!g_ProfilerInitialized || g_ProfilerFrame == 0)
+        return false;
+
+    const ProfilerFrameSample& s = CurrentSample();
+    stats->frame_ms  = s.frame_ms;
+    stats->cpu_ms    = s.cpu_ms;
+    stats->gpu_ms    = s.gpu_ms;
+    stats->draws     = s.draws;
+    stats->triangles = s.triangles;
+    return true;
+}
+
+void Profiler_BeginZone(ProfilerZone zone)
+{
+    // Cada fase do quadro tambem vira uma zona de rastreamento
+    Trace_Begin(g_ProfilerZoneNames[zone]);
+
+    if (!g_ProfilerInitialized)
+        return;
+
+    g_ProfilerZoneStart[zone] = glfwGetTimerValue();
+
+    // So uma consulta GL_TIME_ELAPSED pode estar ativa; fases repetidas no
+    // mesmo quadro acumulam apenas o tempo de CPU.
+    ProfilerGpuQueries& q = g_ProfilerQueries[g_ProfilerFrame % PROFILER_GPU_LATENCY];
+    if (g_ProfilerActiveGpuZone < 0 && !q.zone_issued[zone])
+    {
+        glBeginQuery(GL_TIME_ELAPSED, q.zone[zone]);
+        q.zone_issued[zone] = true;
+        g_ProfilerActiveGpuZone = zone;
+    }
+}
+
+void Profiler_EndZone(ProfilerZone zone)
+{
+    Trace_End();
+
+    if (!g_ProfilerInitialized)
+        return;
+
+    if (g_ProfilerActiveGpuZone == (int)zone)
+    {
+        glEndQuery(GL_TIME_ELAPSED);
+        g_ProfilerActiveGpuZone = -1;
+    }
+
+    CurrentSample().zone_cpu_ms[zone] += (glfwGetTimerValue() - g_ProfilerZoneStart[zone]) * g_ProfilerTicksToMs;
+}
+
+void Profiler_CountDraw(int num_triangles)
+{
+    ProfilerFrameSample& s = CurrentSample();
+    s.draws += 1;
+    s.triangles += num_triangles;
+}
+
+// Calcula o percentil de uma lista de valores (a lista e reordenada)
+static double Percentile(std::vector<double>& values, double percentile)
+{
+    if (values.empty())
+        return 0.0;
+    size_t k = (size_t)(percentile / 100.0 * (values.size() - 1) + 0.5);
+    std::nth_element(values.begin(), values.begin() + k, values.end());
+    return values[k];
+}
+
+// Coleta um campo do historico, ignorando quadros sem dados validos
+static void CollectHistory(std::vector<double>& out, double ProfilerFrameSample::*field)
+{
+    out.clear();
+    for (int i = 0; i < PROFILER_HISTORY; ++i)
+    {
+        const ProfilerFrameSample& s = g_ProfilerHistory[i];
+        if (s.frame == (unsigned long)-1 || s.frame == g_ProfilerFrame || s.*field <= 0.0)
+            continue;
+        out.push_back(s.*field);
+    }
+}
+
+double Profiler_FrameTimePercentile(double percentile)
+{
+    std::vector<double> values;
+    CollectHistory(values, &ProfilerFrameSample::frame_ms);
+    return Percentile(values, percentile);
+}
+
+// Media de uma fase sobre o historico (CPU ou GPU)
+static double ZoneAverage(int zone, bool gpu)
+{
+    double sum = 0.0;
+    int count = 0;
+    for (int i = 0; i < PROFILER_HISTORY; ++i)
+    {
+        const ProfilerFrameSample& s = g_ProfilerHistory[i];
+        if (s.frame == (unsigned long)-1 || s.frame == g_ProfilerFrame)
+            continue;
+        double v = gpu ? s.zone_gpu_ms[zone] : s.zone_cpu_ms[zone];
+        if (v < 0.0)
+            continue;
+        sum += v;
+        count += 1;
+    }
+    return count > 0 ? sum / count : 0.0;
+}
+
+static void UpdateHudLines()
+{
+    char buffer[128];
+    std::vector<double> values;
+
+    CollectHistory(values, &ProfilerFrameSample::frame_ms);
+    double p50 = Percentile(values, 50.0);
+    double p95 = Percentile(values, 95.0);
+    double p99 = Percentile(values, 99.0);
+    snprintf(buffer, sizeof(buffer), "frame p50 %.2f p95 %.2f p99 %.2f ms (%.0f fps)",
+             p50, p95, p99, p50 > 0.0 ? 1000.0 / p50 : 0.0);
+    g_ProfilerHudLines[0] = buffer;
+
+    CollectHistory(values, &ProfilerFrameSample::cpu_ms);
+    double cpu50 = Percentile(values, 50.0);
+    CollectHistory(values, &ProfilerFrameSample::gpu_ms);
+    double gpu50 = Percentile(values, 50.0);
+    snprintf(buffer, sizeof(buffer), "cpu p50 %.2f ms  gpu p50 %.2f ms", cpu50, gpu50);
+    g_ProfilerHudLines[1] = buffer;
+
+    // Contadores do ultimo quadro completo
+    const ProfilerFrameSample& last = g_ProfilerHistory[(g_ProfilerFrame - 1) % PROFILER_HISTORY];
+    snprintf(buffer, sizeof(buffer), "draws %d  tris %ld  tex %.1f MB", last.draws, last.triangles,
+             TextureMemory_Total() / (1024.0 * 1024.0));
+    g_ProfilerHudLines[2] = buffer;
+
+    std::string zones;
+    for (int z = 0; z < PROFILER_NUM_ZONES; ++z)
+    {
+        snprintf(buffer, sizeof(buffer), "%s %.2f/%.2f  ", g_ProfilerZoneNames[z], ZoneAverage(z, false), ZoneAverage(z, true));
+        zones += buffer;
+    }
+    g_ProfilerHudLines[3] = zones + "ms (cpu/gpu)";
+}
+
+void Profiler_UpdateHud(GLFWwindow* window)
+{
+    if (!g_ProfilerInitialized)
+        return;
+
+    // Os percentis sao recalculados poucas vezes por segundo; o texto pode
+    // ficar um pouco atrasado, mas o HUD so e redesenhado quando ele muda.
+    double now = glfwGetTime();
+    if (g_ProfilerHudLastUpdate < 0.0 || now - g_ProfilerHudLastUpdate > PROFILER_HUD_REFRESH)
+    {
+        UpdateHudLines();
+        g_ProfilerHudLastUpdate = now;
+    }
+
+    float lineheight = TextRendering_LineHeight(window);
+    std::string text = g_ProfilerHudLines[0];
+    for (int i = 1; i < 4; ++i)
+        text += "\n" + g_ProfilerHudLines[i];
+    Hud_SetText(HUD_PROFILER, text, -1.0f + lineheight/10, 1.0f - lineheight);
+}
+
+bool Profiler_DumpCsv(const char* filename)
+{
+    FILE* file = fopen(filename, "w");
+    if (file == NULL)
+    {
+        fprintf(stderr, "ERROR: Cannot open file \"%s\".\n", filename);
+        return false;
+    }
+
+    fprintf(file, "frame,frame_ms,cpu_ms,gpu_ms");
+    for (int z = 0; z < PROFILER_NUM_ZONES; ++z)
+        fprintf(file, ",%s_cpu_ms", g_ProfilerZoneNames[z]);
+    for (int z = 0; z < PROFILER_NUM_ZONES; ++z)
+        fprintf(file, ",%s_gpu_ms", g_ProfilerZoneNames[z]);
+    fprintf(file, ",draws,triangles\n");
+
+    // Percorremos o anel do quadro mais antigo para o mais recente, ignorando
+    // o quadro atual (incompleto).
+    for (unsigned long i = 1; i <= PROFILER_HISTORY; ++i)
+    {
+        const ProfilerFrameSample& s = g_ProfilerHistory[(g_ProfilerFrame + i) % PROFILER_HISTORY];
+        if (s.frame == (unsigned long)-1 || s.frame == g_ProfilerFrame)
+            continue;
+
+        fprintf(file, "%lu,%.4f,%.4f,%.4f", s.frame, s.frame_ms, s.cpu_ms, s.gpu_ms);
+        for (int z = 0; z < PROFILER_NUM_ZONES; ++z)
+            fprintf(file, ",%.4f", s.zone_cpu_ms[z]);
+        for (int z = 0; z < PROFILER_NUM_ZONES; ++z)
+            fprintf(file, ",%.4f", s.zone_gpu_ms[z]);
+        fprintf(file, ",%d,%ld\n", s.draws, s.triangles);
+    }
+
+    fclose(file);
+    printf("Profiler: historico de quadros salvo em \"%s\".\n", filename);
+    return true;
+}
@@ -0,0 +1,69 @@
+// Conjunto de projeteis em estrutura de arrays. Veja "projectiles.h".
+#include "projectiles.h"
+
+void Projectiles_Clear(ProjectilePool* pool)
+{
+    pool->count = 0;
+}
+
+bool Projectiles_Spawn(ProjectilePool* pool, glm::vec4 position, glm::vec4 velocity, float lifetime)
+{
+    if (pool->count >= PROJECTILE_CAPACITY)
+        return false;
+
+    int i = pool->count++;
+    pool->position_x[i] = position.x;
+    pool->position_y[i] = position.y;
+    pool->position_z[i] = position.z;
+    pool->velocity_x[i] = velocity.x;
+    pool->velocity_y[i] = velocity.y;
+    pool->velocity_z[i] = velocity.z;
+    pool->lifetime[i]   = lifetime;
+    return true;
+}
+
+void Projectiles_Integrate(ProjectilePool* pool, float dt)
+{
+    // Lacos separados por atributo, sem desvios: cada um e vetorizado
+    int count = pool->count;
+    float* px = pool->position_x;
+    float* py = pool->position_y;
+    float* pz = pool->position_z;
+    const float* vx = pool->velocity_x;
+    const float* vy = pool->velocity_y;
+    const float* vz = pool->velocity_z;
+    float* life = pool->lifetime;
+
+    for (int i = 0; i < count; ++i)
+        px[i] += vx[i] * dt;
+    for (int i = 0; i < count; ++i)
+        py[i] += vy[i] * dt;
+    for (int i = 0; i < count; ++i)
+        pz[i] += vz[i] * dt;
+    for (int i = 0; i < count; ++i)
+        life[i] -= dt;
+}
+
+void Projectiles_RemoveExpired(ProjectilePool* pool)
+{
+    int i = 0;
+    while (i < pool->count)
+    {
+        if (pool->lifetime[i] > 0.0f)
+        {
+            ++i;
+            continue;
+        }
+
+        // O ultimo projetil ocupa o lugar do removido; o indice "i" e
+        // testado novamente no proximo passo do laco
+        int last = --pool->count;
+        pool->position_x[i] = pool->position_x[last];
+        pool->position_y[i] = pool->position_y[last];
+        pool->position_z[i] = pool->position_z[last];
+        pool->velocity_x[i] = pool->velocity_x[last];
+        pool->velocity_y[i] = pool->velocity_y[last];
+        pool->velocity_z[i] = pool->velocity_z[last];
+        pool->lifetime[i]   = pool->lifetime[last];
+    }
+}
@@ -0,0 +1,224 @@
+// Cena em entidades e componentes. Veja "scene.h".
+#include <cstdio>
+#include <vector>
+
+#include <glm/gtc/type_ptr.hpp>
+
+#include "scene.h"
+#include "simdmath.h"
+#include "transform.h"
+#include "collisions.h"
+#include "gpupick.h"
+#include "picking.h"
+#include "profiler.h"
+#include "trace.h"
+
+// Um vetor por componente, todos indexados pela entidade. Os vetores de
+// componentes que a entidade nao possui guardam valores nao utilizados; com
+// isso nao ha indirecao entre entidade e componente, e cada sistema le
+// somente os vetores de que precisa.
+static std::vector<unsigned char>   g_SceneComponents;
+static std::vector<int>             g_SceneRoom;
+static std::vector<glm::mat4>       g_SceneTransform;  // Matriz global
+static std::vector<glm::mat4>       g_SceneNormal;     // Matriz das normais da matriz global
+static std::vector<glm::mat4>       g_SceneLocal;      // Matriz relativa ao pai
+static std::vector<int>             g_SceneParent;     // Sempre menor que a entidade, ou -1
+static std::vector<unsigned char>   g_SceneDirty;      // Matriz local alterada
+static std::vector<unsigned char>   g_SceneChanged;    // Matriz global recalculada na ultima passada
+static std::vector<SceneRenderable> g_SceneRenderable;
+static std::vector<SceneCollider>   g_SceneCollider;
+static std::vector<ScenePickable>   g_ScenePickable;
+
+// Numero de entidades sujas: sem nenhuma, Scene_UpdateTransforms() nao
+// percorre os vetores
+static int g_SceneNumDirty = 0;
+
+void Scene_Clear()
+{
+    g_SceneComponents.clear();
+    g_SceneRoom.clear();
+    g_SceneTransform.clear();
+    g_SceneNormal.clear();
+    g_SceneLocal.clear();
+    g_SceneParent.clear();
+    g_SceneDirty.clear();
+    g_SceneChanged.clear();
+    g_SceneNumDirty = 0;
+    g_SceneRenderable.clear();
+    g_SceneCollider.clear();
+    g_ScenePickable.clear();
+}
+
+int Scene_CreateEntity(int room, const glm::mat4& transform, int parent)
+{
+    if (parent >= Scene_NumEntities())
+    {
+        fprintf(stderr, "ERROR: Scene entity parent %d does not exist.\n", parent);
+        parent = -1;
+    }
+
+    g_SceneComponents.push_back(0);
+    g_SceneRoom.push_back(room);
+    g_SceneTransform.push_back(parent >= 0 ? Simd_Multiply(g_SceneTransform[parent], transform) : transform);
+    g_SceneNormal.push_back(Matrix_Normal(g_SceneTransform.back()));
+    g_SceneLocal.push_back(transform);
+    g_SceneParent.push_back(parent);
+    g_SceneDirty.push_back(0);
+    g_SceneChanged.push_back(0);
+    g_SceneRenderable.push_back(SceneRenderable());
+    g_SceneCollider.push_back(SceneCollider());
+    g_ScenePickable.push_back(ScenePickable());
+    return (int)g_SceneComponents.size() - 1;
+}
+
+void Scene_AddRenderable(int entity, const SceneRenderable& renderable)
+{
+    g_SceneRenderable[entity] = renderable;
+    g_SceneComponents[entity] |= SCENE_RENDERABLE;
+}
+
+void Scene_AddCollider(int entity, glm::vec3 box_min, glm::vec3 box_max)
+{
+    g_SceneCollider[entity].box_min = box_min;
+    g_SceneCollider[entity].box_max = box_max;
+    g_SceneComponents[entity] |= SCENE_COLLIDER;
+}
+
+void Scene_AddPickable(int entity, int pick_mesh, const char* name)
+{
+    g_ScenePickable[entity].pick_mesh = pick_mesh;
+    g_ScenePickable[entity].name = name;
+    g_SceneComponents[entity] |= SCENE_PICKABLE;
+}
+
+int Scene_NumEntities()
+{
+    return (int)g_SceneComponents.size();
+}
+
+void Scene_SetLocalTransform(int entity, const glm::mat4& transform)
+{
+    g_SceneLocal[entity] = transform;
+    if (!g_SceneDirty[entity])
+    {
+        g_SceneDirty[entity] = 1;
+        g_SceneNumDirty += 1;
+    }
+}
+
+const glm::mat4& Scene_LocalTransform(int entity)
+{
+    return g_SceneLocal[entity];
+}
+
+int Scene_Parent(int entity)
+{
+    return g_SceneParent[entity];
+}
+
+int Scene_UpdateTransforms()
+{
+    if (g_SceneNumDirty == 0)
+        return 0;
+
+    TRACE_ZONE("Scene_UpdateTransforms");
+
+    // Como o pai vem antes dos filhos, quando chegamos a uma entidade a
+    // matriz global do pai ja esta atualizada, e g_SceneChanged[parent] diz
+    // se ela mudou nesta passada.
+    int count = Scene_NumEntities();
+    int updated = 0;
+    const int* parent = g_SceneParent.data();
+    const glm::mat4* local = g_SceneLocal.data();
+    glm::mat4* world = g_SceneTransform.data();
+    unsigned char* dirty = g_SceneDirty.data();
+    unsigned char* changed = g_SceneChanged.data();
+    for (int i = 0; i < count; ++i)
+    {
+        int p = parent[i];
+        unsigned char c = dirty[i] | (p >= 0 ? changed[p] : 0);
+        changed[i] = c;
+        dirty[i] = 0;
+        if (!c)
+            continue;
+
+        world[i] = (p >= 0) ? Simd_Multiply(world[p], local[i]) : local[i];
+        g_SceneNormal[i] = Matrix_Normal(world[i]);
+        updated += 1;
+    }
+
+    g_SceneNumDirty = 0;
+    return updated;
+}
+
+void Scene_DrawRoom(int room, const SceneUniforms& uniforms)
+{
+    TRACE_ZONE("Scene_DrawRoom");
+
+    // Entidades consecutivas frequentemente usam o mesmo VAO (paredes e
+    // chao, ou as partes de um mesmo modelo); so trocamos quando necessario.
+    GLuint bound_vertex_array = 0;
+    int count = Scene_NumEntities();
+    for (int i = 0; i < count; ++i)
+    {
+        if (g_SceneRoom[i] != room || !(g_SceneComponents[i] & SCENE_RENDERABLE))
+            continue;
+
+        const SceneRenderable& r = g_SceneRenderable[i];
+        glUniformMatrix4fv(uniforms.model, 1, GL_FALSE, glm::value_ptr(g_SceneTransform[i]));
+        glUniformMatrix4fv(uniforms.normal_matrix, 1, GL_FALSE, glm::value_ptr(g_SceneNormal[i]));
+        glUniform1i(uniforms.object_id, r.object_id);
+        glUniform1i(uniforms.material_tier, r.material_tier);
+        glUniform1i(uniforms.material_layer, r.material_layer);
+        glUniform4f(uniforms.bbox_min, r.bbox_min.x, r.bbox_min.y, r.bbox_min.z, 1.0f);
+        glUniform4f(uniforms.bbox_max, r.bbox_max.x, r.bbox_max.y, r.bbox_max.z, 1.0f);
+
+        if (r.vertex_array_object_id != bound_vertex_array)
+        {
+            glBindVertexArray(r.vertex_array_object_id);
+            bound_vertex_array = r.vertex_array_object_id;
+        }
+
+        Profiler_CountDraw(r.num_indices / 3);
+        glDrawElements(r.rendering_mode, r.num_indices, GL_UNSIGNED_INT, r.first_index);
+    }
+    glBindVertexArray(0);
+}
+
+void Scene_BuildRoomColliders(int room)
+{
+    TRACE_ZONE("Scene_BuildRoomColliders");
+
+    CollisionWorld_Clear();
+    int count = Scene_NumEntities();
+    for (int i = 0; i < count; ++i)
+    {
+        if (g_SceneRoom[i] == room && (g_SceneComponents[i] & SCENE_COLLIDER))
+            CollisionWorld_AddModelBox(g_SceneTransform[i], g_SceneCollider[i].box_min, g_SceneCollider[i].box_max);
+    }
+    CollisionWorld_Build();
+}
+
+void Scene_RegisterRoomPickables(int room)
+{
+    TRACE_ZONE("Scene_RegisterRoomPickables");
+
+    Pick_ClearInstances();
+    GpuPick_ClearInstances();
+    int count = Scene_NumEntities();
+    for (int i = 0; i < count; ++i)
+    {
+        if (g_SceneRoom[i] != room || !(g_SceneComponents[i] & SCENE_PICKABLE))
+            continue;
+
+        const ScenePickable& p = g_ScenePickable[i];
+        Pick_AddInstance(p.pick_mesh, g_SceneTransform[i], p.name);
+
+        if (g_SceneComponents[i] & SCENE_RENDERABLE)
+        {
+            const SceneRenderable& r = g_SceneRenderable[i];
+            GpuPick_AddInstance(r.vertex_array_object_id, r.rendering_mode, r.first_index, r.num_indices,
+                                g_SceneTransform[i], p.name);
+        }
+    }
+}
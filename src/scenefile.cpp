@@ -0,0 +1,529 @@
+// Leitura e gravacao da descricao da cena. Veja "scenefile.h".
+//
+// Formato binario (little-endian):
+//
+//   cabecalho: "FCGS" (4 bytes), versao (uint32)
+//   modelos  : quantidade (uint32), e para cada um: filename, basepath
+//   materiais: quantidade (uint32), e para cada um: nome, filename,
+//              prioridade (int32)
+//   salas    : quantidade (uint32), e para cada uma: nome do objeto procurado
+//   objetos  : quantidade (uint32), e para cada um: sala (int32), nome,
+//              matriz de modelagem (16 floats, por colunas), pai (int32),
+//              object_id (int32), material (int32), colisao (uint8),
+//              picking (uint8)
+//
+// Strings sao gravadas como tamanho (uint32) seguido dos caracteres.
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+
+#include <stdint.h>
+#include <sys/stat.h>
+
+#include <glm/gtc/type_ptr.hpp>
+
+#include "scenefile.h"
+#include "matrices.h"
+
+#define SCENE_FILE_VERSION 4
+
+#define SCENE_FILE_PI 3.14159265359
+
+// Valores de "object_id" aceitos no arquivo de texto
+struct SceneFileShading
+{
+    const char* name;
+    int         object_id;
+};
+
+static const SceneFileShading g_SceneFileShadings[] = {
+    { "room1",  ROOM1 },
+    { "room2",  ROOM2 },
+    { "room3",  ROOM3 },
+    { "london", LONDON },
+    { "knife",  KNIFE },
+    { "broom",  BROOM },
+};
+
+// Rotacoes das paredes nos planos XY (wall_x) e YZ (wall_y), calculadas em
+// tempo de compilacao
+static constexpr ConstMatrix g_SceneFileWallX = ConstMatrix_Rotate_X((float)(SCENE_FILE_PI / 2.0));
+static constexpr ConstMatrix g_SceneFileWallY = ConstMatrix_Rotate_Y((float)(SCENE_FILE_PI / 2.0))
+                                              * ConstMatrix_Rotate_X((float)(SCENE_FILE_PI / 2.0));
+
+// Rotacao de "degrees" graus em torno do eixo "axis" (0 = X, 1 = Y, 2 = Z)
+static glm::mat4 SceneFileRotate(int axis, float degrees)
+{
+    float angle = degrees * (float)(SCENE_FILE_PI / 180.0);
+    if (axis == 0)
+        return Matrix_Rotate_X(angle);
+    if (axis == 1)
+        return Matrix_Rotate_Y(angle);
+    return Matrix_Rotate_Z(angle);
+}
+
+// Estado da leitura do arquivo de texto, usado nas mensagens de erro
+struct SceneFileParser
+{
+    const char*                filename;
+    int                        line;
+    std::vector<std::string>   tokens;
+    std::map<std::string, int> labels;  // Rotulo -> indice do objeto
+};
+
+static bool SceneFileError(const SceneFileParser& parser, const char* message)
+{
+    fprintf(stderr, "ERROR: %s:%d: %s\n", parser.filename, parser.line, message);
+    return false;
+}
+
+static bool SceneFileFloat(const SceneFileParser& parser, size_t index, float* value)
+{
+    if (index >= parser.tokens.size())
+        return SceneFileError(parser, "missing number.");
+
+    char* end;
+    *value = strtof(parser.tokens[index].c_str(), &end);
+    if (*end != '\0')
+        return SceneFileError(parser, "invalid number.");
+    return true;
+}
+
+// Le os numeros tokens[first..first+count-1]
+static bool SceneFileFloats(const SceneFileParser& parser, size_t first, int count, float* values)
+{
+    for (int i = 0; i < count; ++i)
+        if (!SceneFileFloat(parser, first + i, &values[i]))
+            return false;
+    return true;
+}
+
+// Le uma sequencia de transformacoes a partir de tokens[first], compondo-as
+// na ordem em que aparecem: "translate 1 2 3 rotate_y 90" e T * R. Os
+// rotulos "label <nome>" e "parent <nome>" podem aparecer em qualquer
+// posicao da sequencia.
+static bool SceneFileTransform(const SceneFileParser& parser, size_t first, glm::mat4* model,
+                               std::string* label, std::string* parent)
+{
+    *model = glm::mat4(1.0f);
+    size_t i = first;
+    while (i < parser.tokens.size())
+    {
+        const std::string& op = parser.tokens[i];
+        float v[3];
+        if (op == "label" || op == "parent")
+        {
+            if (i + 1 >= parser.tokens.size())
+                return SceneFileError(parser, "missing label.");
+            *(op == "label" ? label : parent) = parser.tokens[i + 1];
+            i += 2;
+        }
+        else if (op == "translate" || op == "scale")
+        {
+            if (!SceneFileFloats(parser, i + 1, 3, v))
+                return false;
+            *model = *model * (op == "translate" ? Matrix_Translate(v[0], v[1], v[2]) : Matrix_Scale(v[0], v[1], v[2]));
+            i += 4;
+        }
+        else if (op == "rotate_x" || op == "rotate_y" || op == "rotate_z")
+        {
+            if (!SceneFileFloat(parser, i + 1, &v[0]))
+                return false;
+            *model = *model * SceneFileRotate(op[7] - 'x', v[0]);
+            i += 2;
+        }
+        else
+        {
+            return SceneFileError(parser, "unknown transformation.");
+        }
+    }
+    return true;
+}
+
+static bool SceneFileParseLine(SceneFileParser& parser, int* room, SceneDescription* scene)
+{
+    const std::vector<std::string>& t = parser.tokens;
+    const std::string& command = t[0];
+
+    if (command == "model")
+    {
+        if (t.size() != 2 && t.size() != 3)
+            return SceneFileError(parser, "expected \"model <obj> [<basepath>]\".");
+        SceneFileModel model;
+        model.filename = t[1];
+        model.basepath = (t.size() == 3) ? t[2] : "";
+        scene->models.push_back(model);
+        return true;
+    }
+
+    if (command == "material")
+    {
+        if (t.size() != 3 && t.size() != 4)
+            return SceneFileError(parser, "expected \"material <name> <image> [<priority>]\".");
+        for (size_t i = 0; i < scene->materials.size(); ++i)
+            if (scene->materials[i].name == t[1])
+                return SceneFileError(parser, "duplicated material.");
+        SceneFileMaterial material;
+        material.name = t[1];
+        material.filename = t[2];
+        material.priority = 0;
+        if (t.size() == 4)
+        {
+            char* end;
+            material.priority = (int)strtol(t[3].c_str(), &end, 10);
+            if (*end != '\0')
+                return SceneFileError(parser, "invalid priority.");
+        }
+        scene->materials.push_back(material);
+        return true;
+    }
+
+    if (command == "room")
+    {
+        float number;
+        if (t.size() != 2 || !SceneFileFloat(parser, 1, &number) || number < 1.0f)
+            return SceneFileError(parser, "expected \"room <number>\".");
+        *room = (int)number;
+        if ((int)scene->targets.size() < *room)
+            scene->targets.resize(*room);
+        return true;
+    }
+
+    if (*room == 0)
+        return SceneFileError(parser, "object outside of a room.");
+
+    if (command == "target")
+    {
+        if (t.size() != 2)
+            return SceneFileError(parser, "expected \"target <object>\".");
+        scene->targets[*room - 1] = t[1];
+        return true;
+    }
+
+    SceneFileObject object;
+    object.room = *room;
+    object.parent = -1;
+    object.pickable = false;
+
+    if (command == "wall_x" || command == "wall_y" || command == "floor")
+    {
+        // Paredes e chao sao o modelo "plane" (de -1 a 1 em X e Z) com
+        // centro "x y z", meias dimensoes "sx sz" e o material dado, ou
+        // "wall"/"floor" se omitido
+        float v[5];
+        if ((t.size() != 6 && t.size() != 7) || !SceneFileFloats(parser, 1, 5, v))
+            return SceneFileError(parser, "expected \"wall_x|wall_y|floor <x> <y> <z> <sx> <sz> [<material>]\".");
+
+        std::string material = t.size() == 7 ? t[6] : (command == "floor" ? "floor" : "wall");
+        object.material = -1;
+        for (size_t i = 0; i < scene->materials.size(); ++i)
+            if (scene->materials[i].name == material)
+                object.material = (int)i;
+        if (object.material < 0)
+            return SceneFileError(parser, "unknown material (it must be declared before the plane).");
+
+        object.name = "plane";
+        object.object_id = PLANE;
+        object.model = Matrix_Translate(v[0], v[1], v[2]);
+        if (command == "floor")
+        {
+            object.collider = SCENE_FILE_NO_COLLIDER;
+        }
+        else
+        {
+            object.model = object.model * Matrix_FromConst(command == "wall_y" ? g_SceneFileWallY : g_SceneFileWallX);
+            object.collider = SCENE_FILE_WALL_COLLIDER;
+        }
+        object.model = object.model * Matrix_Scale(v[3], 1.0f, v[4]);
+        scene->objects.push_back(object);
+        return true;
+    }
+
+    if (command == "object")
+    {
+        if (t.size() < 4)
+            return SceneFileError(parser, "expected \"object <name> <shading> <flags> <transformations>\".");
+
+        object.name = t[1];
+        object.material = 0;
+
+        object.object_id = -1;
+        for (size_t i = 0; i < sizeof(g_SceneFileShadings) / sizeof(g_SceneFileShadings[0]); ++i)
+            if (t[2] == g_SceneFileShadings[i].name)
+                object.object_id = g_SceneFileShadings[i].object_id;
+        if (object.object_id < 0)
+            return SceneFileError(parser, "unknown shading.");
+
+        // Flags: "collider", "pickable", ambas separadas por virgula, ou "-"
+        const std::string& flags = t[3];
+        object.collider = (flags.find("collider") != std::string::npos) ? SCENE_FILE_BBOX_COLLIDER : SCENE_FILE_NO_COLLIDER;
+        object.pickable = (flags.find("pickable") != std::string::npos);
+
+        std::string label, parent;
+        if (!SceneFileTransform(parser, 4, &object.model, &label, &parent))
+            return false;
+
+        // O pai precisa ter sido declarado antes, na mesma sala
+        if (!parent.empty())
+        {
+            std::map<std::string, int>::const_iterator it = parser.labels.find(parent);
+            if (it == parser.labels.end())
+                return SceneFileError(parser, "unknown parent (it must be declared before the object).");
+            if (scene->objects[it->second].room != object.room)
+                return SceneFileError(parser, "parent is in another room.");
+            object.parent = it->second;
+        }
+        if (!label.empty())
+        {
+            if (parser.labels.count(label))
+                return SceneFileError(parser, "duplicated label.");
+            parser.labels[label] = (int)scene->objects.size();
+        }
+
+        scene->objects.push_back(object);
+        return true;
+    }
+
+    return SceneFileError(parser, "unknown command.");
+}
+
+static bool SceneFileLoadText(const char* filename, FILE* file, SceneDescription* scene)
+{
+    SceneFileParser parser;
+    parser.filename = filename;
+    parser.line = 0;
+
+    int room = 0;
+    char buffer[1024];
+    while (fgets(buffer, sizeof(buffer), file))
+    {
+        parser.line += 1;
+
+        // Ignoramos comentarios (de "#" ate o fim da linha)
+        char* comment = strchr(buffer, '#');
+        if (comment)
+            *comment = '\0';
+
+        parser.tokens.clear();
+        const char* separators = " \t\r\n";
+        for (char* token = strtok(buffer, separators); token; token = strtok(NULL, separators))
+            parser.tokens.push_back(token);
+
+        if (parser.tokens.empty())
+            continue;
+
+        if (!SceneFileParseLine(parser, &room, scene))
+            return false;
+    }
+
+    for (size_t i = 0; i < scene->targets.size(); ++i)
+        if (scene->targets[i].empty())
+            fprintf(stderr, "WARNING: %s: room %d has no target.\n", filename, (int)i + 1);
+
+    return true;
+}
+
+template <typename T>
+static void WriteValue(FILE* file, T value)
+{
+    fwrite(&value, sizeof(T), 1, file);
+}
+
+static void WriteString(FILE* file, const std::string& s)
+{
+    WriteValue<uint32_t>(file, (uint32_t)s.size());
+    fwrite(s.data(), 1, s.size(), file);
+}
+
+template <typename T>
+static bool ReadValue(FILE* file, T* value)
+{
+    return fread(value, sizeof(T), 1, file) == 1;
+}
+
+static bool ReadString(FILE* file, std::string* s)
+{
+    uint32_t size;
+    if (!ReadValue(file, &size) || size > 4096)
+        return false;
+    s->resize(size);
+    return size == 0 || fread(&(*s)[0], 1, size, file) == size;
+}
+
+static bool SceneFileLoadBinary(FILE* file, SceneDescription* scene)
+{
+    uint32_t version, count;
+    if (!ReadValue(file, &version) || version != SCENE_FILE_VERSION)
+        return false;
+
+    if (!ReadValue(file, &count))
+        return false;
+    scene->models.resize(count);
+    for (uint32_t i = 0; i < count; ++i)
+        if (!ReadString(file, &scene->models[i].filename) || !ReadString(file, &scene->models[i].basepath))
+            return false;
+
+    if (!ReadValue(file, &count))
+        return false;
+    scene->materials.resize(count);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        int32_t priority;
+        if (!ReadString(file, &scene->materials[i].name) || !ReadString(file, &scene->materials[i].filename)
+            || !ReadValue(file, &priority))
+            return false;
+        scene->materials[i].priority = priority;
+    }
+
+    if (!ReadValue(file, &count))
+        return false;
+    scene->targets.resize(count);
+    for (uint32_t i = 0; i < count; ++i)
+        if (!ReadString(file, &scene->targets[i]))
+            return false;
+
+    if (!ReadValue(file, &count))
+        return false;
+    scene->objects.resize(count);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        SceneFileObject& object = scene->objects[i];
+        int32_t room, parent, object_id, material;
+        uint8_t collider, pickable;
+        if (!ReadValue(file, &room) || !ReadString(file, &object.name)
+            || fread(glm::value_ptr(object.model), sizeof(float), 16, file) != 16
+            || !ReadValue(file, &parent) || parent >= (int32_t)i
+            || !ReadValue(file, &object_id) || !ReadValue(file, &material)
+            || material < 0 || (material > 0 && material >= (int32_t)scene->materials.size())
+            || !ReadValue(file, &collider) || !ReadValue(file, &pickable))
+            return false;
+        object.room = room;
+        object.parent = parent < 0 ? -1 : parent;
+        object.object_id = object_id;
+        object.material = material;
+        object.collider = collider;
+        object.pickable = (pickable != 0);
+    }
+    return true;
+}
+
+bool SceneFile_Load(const char* filename, SceneDescription* scene)
+{
+    FILE* file = fopen(filename, "rb");
+    if (file == NULL)
+    {
+        fprintf(stderr, "ERROR: Cannot open file \"%s\".\n", filename);
+        return false;
+    }
+
+    scene->models.clear();
+    scene->materials.clear();
+    scene->targets.clear();
+    scene->objects.clear();
+
+    char magic[4] = { 0, 0, 0, 0 };
+    bool ok;
+    if (fread(magic, 1, 4, file) == 4 && memcmp(magic, "FCGS", 4) == 0)
+    {
+        ok = SceneFileLoadBinary(file, scene);
+        if (!ok)
+            fprintf(stderr, "ERROR: \"%s\" is not a valid scene file.\n", filename);
+    }
+    else
+    {
+        rewind(file);
+        ok = SceneFileLoadText(filename, file, scene);
+    }
+
+    fclose(file);
+
+    if (ok)
+        printf("Cena \"%s\": %d modelos, %d materiais, %d objetos.\n", filename, (int)scene->models.size(),
+               (int)scene->materials.size(), (int)scene->objects.size());
+    return ok;
+}
+
+bool SceneFile_LoadNewest(const char* text_filename, const char* binary_filename, SceneDescription* scene)
+{
+    struct stat text_stat, binary_stat;
+    bool has_text = (stat(text_filename, &text_stat) == 0);
+    bool has_binary = (stat(binary_filename, &binary_stat) == 0);
+
+    if (!has_binary || (has_text && binary_stat.st_mtime < text_stat.st_mtime))
+        return SceneFile_Load(text_filename, scene);
+    if (!has_text)
+        return SceneFile_Load(binary_filename, scene);
+
+    // Um binario gravado por outra versao do programa (ex.: depois de
+    // recompilar com um SCENE_FILE_VERSION novo) nao impede a execucao: o
+    // texto ainda e a descricao original da cena
+    uint32_t version = 0;
+    char magic[4] = { 0, 0, 0, 0 };
+    FILE* file = fopen(binary_filename, "rb");
+    if (file != NULL)
+    {
+        if (fread(magic, 1, 4, file) != 4 || memcmp(magic, "FCGS", 4) != 0 || !ReadValue(file, &version))
+            version = 0;
+        fclose(file);
+    }
+    if (version == SCENE_FILE_VERSION && SceneFile_Load(binary_filename, scene))
+        return true;
+
+    fprintf(stderr, "WARNING: \"%s\" is outdated or invalid, loading \"%s\" (run \"make scene\" to rebuild it).\n",
+            binary_filename, text_filename);
+    return SceneFile_Load(text_filename, scene);
+}
+
+bool SceneFile_SaveBinary(const char* filename, const SceneDescription& scene)
+{
+    FILE* file = fopen(filename, "wb");
+    if (file == NULL)
+    {
+        fprintf(stderr, "ERROR: Cannot open file \"%s\".\n", filename);
+        return false;
+    }
+
+    fwrite("FCGS", 1, 4, file);
+    WriteValue<uint32_t>(file, SCENE_FILE_VERSION);
+
+    WriteValue<uint32_t>(file, (uint32_t)scene.models.size());
+    for (size_t i = 0; i < scene.models.size(); ++i)
+    {
+        WriteString(file, scene.models[i].filename);
+        WriteString(file, scene.models[i].basepath);
+    }
+
+    WriteValue<uint32_t>(file, (uint32_t)scene.materials.size());
+    for (size_t i = 0; i < scene.materials.size(); ++i)
+    {
+        WriteString(file, scene.materials[i].name);
+        WriteString(file, scene.materials[i].filename);
+        WriteValue<int32_t>(file, scene.materials[i].priority);
+    }
+
+    WriteValue<uint32_t>(file, (uint32_t)scene.targets.size());
+    for (size_t i = 0; i < scene.targets.size(); ++i)
+        WriteString(file, scene.targets[i]);
+
+    WriteValue<uint32_t>(file, (uint32_t)scene.objects.size());
+    for (size_t i = 0; i < scene.objects.size(); ++i)
+    {
+        const SceneFileObject& object = scene.objects[i];
+        WriteValue<int32_t>(file, object.room);
+        WriteString(file, object.name);
+        fwrite(glm::value_ptr(object.model), sizeof(float), 16, file);
+        WriteValue<int32_t>(file, object.parent);
+        WriteValue<int32_t>(file, object.object_id);
+        WriteValue<int32_t>(file, object.material);
+        WriteValue<uint8_t>(file, (uint8_t)object.collider);
+        WriteValue<uint8_t>(file, object.pickable ? 1 : 0);
+    }
+
+    bool ok = (ferror(file) == 0);
+    fclose(file);
+    if (!ok)
+        fprintf(stderr, "ERROR: Cannot write file \"%s\".\n", filename);
+    return ok;
+}
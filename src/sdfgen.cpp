@@ -0,0 +1,328 @@
+// Gerador do atlas de campo de distancia com sinal (SDF) da fonte embutida.
+// Programa separado, sem OpenGL, construido por "make sdf":
+//
+//   ./bin/Linux/sdfgen include/dejavufont_sdf.h
+//
+// Para cada glifo de "dejavufont.h", a cobertura (anti-aliased) e ampliada
+// por interpolacao bilinear e binarizada em 0.5, que e aproximadamente o
+// contorno do glifo. A distancia euclidiana exata de cada amostra ao
+// contorno e calculada nos dois lados (Felzenszwalb e Huttenlocher) e
+// reduzida de volta a resolucao original. Cada texel guarda
+// 0.5 + d / (2 * SDF_SPREAD), com d em pixels da fonte, positivo dentro do
+// glifo; o contorno fica em 0.5 e distancias alem de SDF_SPREAD saturam.
+//
+// Como o campo se estende para fora do glifo, os glifos sao reempacotados
+// com SDF_SPREAD texels de margem em cada lado, e as metricas (tamanho,
+// deslocamento e coordenadas de textura) sao ajustadas para essa margem. O
+// resultado e um "texture_font_t" com o mesmo formato de "dejavufont.h".
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <stdint.h>
+#include <algorithm>
+#include <vector>
+
+#include "dejavufont.h"
+
+// Alcance do campo de distancia, em pixels da fonte (e margem dos glifos)
+static const int SDF_SPREAD = 4;
+
+// Fator de ampliacao usado para localizar o contorno com precisao sub-pixel
+static const int SDF_UPSAMPLE = 8;
+
+static const float SDF_INFINITY = 1e20f;
+
+// Glifo de origem: retangulo no atlas original, em pixels
+struct SourceGlyph
+{
+    int x, y, width, height;
+};
+
+// Cobertura do atlas original no ponto (x, y) relativo ao glifo, em pixels
+// (centros dos pixels em i + 0.5), com interpolacao bilinear. Fora do
+// retangulo do glifo a cobertura e zero.
+static float SampleCoverage(const SourceGlyph& g, float x, float y)
+{
+    x -= 0.5f;
+    y -= 0.5f;
+    int x0 = (int)std::floor(x);
+    int y0 = (int)std::floor(y);
+    float fx = x - x0;
+    float fy = y - y0;
+
+    float c[2][2];
+    for (int j = 0; j < 2; ++j)
+        for (int i = 0; i < 2; ++i)
+        {
+            int px = x0 + i, py = y0 + j;
+            if (px < 0 || py < 0 || px >= g.width || py >= g.height)
+                c[j][i] = 0.0f;
+            else
+                c[j][i] = dejavufont.tex_data[(g.y + py) * dejavufont.tex_width + g.x + px] / 255.0f;
+        }
+
+    float top = c[0][0] + (c[0][1] - c[0][0]) * fx;
+    float bottom = c[1][0] + (c[1][1] - c[1][0]) * fx;
+    return top + (bottom - top) * fy;
+}
+
+// Transformada de distancia 1D (quadrado da distancia), Felzenszwalb e
+// Huttenlocher, "Distance Transforms of Sampled Functions"
+static void DistanceTransform1D(const float* f, float* d, int n, int* v, float* z)
+{
+    int k = 0;
+    v[0] = 0;
+    z[0] = -SDF_INFINITY;
+    z[1] = SDF_INFINITY;
+    for (int q = 1; q < n; ++q)
+    {
+        float s = ((f[q] + q*q) - (f[v[k]] + v[k]*v[k])) / (2.0f*q - 2.0f*v[k]);
+        while (s <= z[k])
+        {
+            --k;
+            s = ((f[q] + q*q) - (f[v[k]] + v[k]*v[k])) / (2.0f*q - 2.0f*v[k]);
+        }
+        ++k;
+        v[k] = q;
+        z[k] = s;
+        z[k + 1] = SDF_INFINITY;
+    }
+
+    k = 0;
+    for (int q = 0; q < n; ++q)
+    {
+        while (z[k + 1] < q)
+            ++k;
+        d[q] = (q - v[k]) * (q - v[k]) + f[v[k]];
+    }
+}
+
+// Distancia euclidiana de cada amostra ate a amostra mais proxima em que
+// mask == target (zero nessas amostras)
+static void DistanceTransform2D(const std::vector<unsigned char>& mask, unsigned char target,
+                                int width, int height, std::vector<float>* out)
+{
+    int n = std::max(width, height);
+    std::vector<float> grid(width * height);
+    std::vector<float> f(n), d(n), z(n + 1);
+    std::vector<int> v(n);
+
+    for (int i = 0; i < width * height; ++i)
+        grid[i] = mask[i] == target ? 0.0f : SDF_INFINITY;
+
+    for (int x = 0; x < width; ++x)
+    {
+        for (int y = 0; y < height; ++y)
+            f[y] = grid[y * width + x];
+        DistanceTransform1D(f.data(), d.data(), height, v.data(), z.data());
+        for (int y = 0; y < height; ++y)
+            grid[y * width + x] = d[y];
+    }
+    for (int y = 0; y < height; ++y)
+    {
+        DistanceTransform1D(&grid[y * width], d.data(), width, v.data(), z.data());
+        for (int x = 0; x < width; ++x)
+            grid[y * width + x] = d[x];
+    }
+
+    out->resize(width * height);
+    for (int i = 0; i < width * height; ++i)
+        (*out)[i] = std::sqrt(grid[i]);
+}
+
+// Calcula o campo de distancia do glifo "g" com margem SDF_SPREAD, em
+// (g.width + 2*SDF_SPREAD) x (g.height + 2*SDF_SPREAD) texels
+static void BuildGlyphField(const SourceGlyph& g, std::vector<unsigned char>* field)
+{
+    int out_width = g.width + 2*SDF_SPREAD;
+    int out_height = g.height + 2*SDF_SPREAD;
+    int hi_width = out_width * SDF_UPSAMPLE;
+    int hi_height = out_height * SDF_UPSAMPLE;
+
+    std::vector<unsigned char> inside(hi_width * hi_height);
+    for (int y = 0; y < hi_height; ++y)
+        for (int x = 0; x < hi_width; ++x)
+        {
+            float sx = (x + 0.5f) / SDF_UPSAMPLE - SDF_SPREAD;
+            float sy = (y + 0.5f) / SDF_UPSAMPLE - SDF_SPREAD;
+            inside[y * hi_width + x] = SampleCoverage(g, sx, sy) >= 0.5f ? 1 : 0;
+        }
+
+    // Distancia ate a amostra mais proxima do outro lado do contorno. O
+    // contorno fica a meia amostra dessa amostra.
+    std::vector<float> to_inside, to_outside;
+    DistanceTransform2D(inside, 1, hi_width, hi_height, &to_inside);
+    DistanceTransform2D(inside, 0, hi_width, hi_height, &to_outside);
+
+    field->resize(out_width * out_height);
+    for (int y = 0; y < out_height; ++y)
+        for (int x = 0; x < out_width; ++x)
+        {
+            // Media das amostras cobertas pelo texel
+            float sum = 0.0f;
+            for (int j = 0; j < SDF_UPSAMPLE; ++j)
+                for (int i = 0; i < SDF_UPSAMPLE; ++i)
+                {
+                    int k = (y * SDF_UPSAMPLE + j) * hi_width + x * SDF_UPSAMPLE + i;
+                    sum += inside[k] ? to_outside[k] - 0.5f : -(to_inside[k] - 0.5f);
+                }
+            float distance = sum / (SDF_UPSAMPLE * SDF_UPSAMPLE) / SDF_UPSAMPLE;
+
+            float value = 0.5f + distance / (2.0f * SDF_SPREAD);
+            value = std::min(1.0f, std::max(0.0f, value));
+            (*field)[y * out_width + x] = (unsigned char)std::floor(value * 255.0f + 0.5f);
+        }
+}
+
+static bool CompareHeight(const std::pair<int, int>& a, const std::pair<int, int>& b)
+{
+    return a.first > b.first || (a.first == b.first && a.second < b.second);
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2)
+    {
+        fprintf(stderr, "Uso: %s <dejavufont_sdf.h>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    const int tex_width = (int)dejavufont.tex_width;
+    const int tex_height = (int)dejavufont.tex_height;
+    const int count = (int)dejavufont.glyphs_count;
+
+    static texture_font_t font;
+    memcpy(&font, &dejavufont, sizeof(font));
+    memset(font.tex_data, 0, sizeof(font.tex_data));
+
+    // Empacotamento em prateleiras, dos glifos mais altos para os mais
+    // baixos. Os glifos sem area (codepoint invalido) ficam sem margem.
+    std::vector<std::pair<int, int> > order;
+    for (int i = 0; i < count; ++i)
+        order.push_back(std::make_pair(dejavufont.glyphs[i].height, i));
+    std::sort(order.begin(), order.end(), CompareHeight);
+
+    int shelf_x = 0, shelf_y = 0, shelf_height = 0;
+    for (size_t n = 0; n < order.size(); ++n)
+    {
+        const texture_glyph_t& src = dejavufont.glyphs[order[n].second];
+        texture_glyph_t& dst = font.glyphs[order[n].second];
+        if (src.width == 0 || src.height == 0)
+        {
+            dst.s0 = dst.t0 = dst.s1 = dst.t1 = 0.0f;
+            continue;
+        }
+
+        SourceGlyph g;
+        g.x = (int)std::floor(src.s0 * tex_width + 0.5f);
+        g.y = (int)std::floor(src.t0 * tex_height + 0.5f);
+        g.width = src.width;
+        g.height = src.height;
+
+        std::vector<unsigned char> field;
+        BuildGlyphField(g, &field);
+        int w = g.width + 2*SDF_SPREAD;
+        int h = g.height + 2*SDF_SPREAD;
+
+        if (shelf_x + w > tex_width)
+        {
+            shelf_x = 0;
+            shelf_y += shelf_height;
+            shelf_height = 0;
+        }
+        if (shelf_y + h > tex_height)
+        {
+            fprintf(stderr, "ERROR: Atlas SDF de %dx%d insuficiente para a fonte.\n", tex_width, tex_height);
+            return EXIT_FAILURE;
+        }
+
+        for (int y = 0; y < h; ++y)
+            memcpy(&font.tex_data[(shelf_y + y) * tex_width + shelf_x], &field[y * w], w);
+
+        dst.width = w;
+        dst.height = h;
+        dst.offset_x = src.offset_x - SDF_SPREAD;
+        dst.offset_y = src.offset_y + SDF_SPREAD;
+        dst.s0 = (float)shelf_x / tex_width;
+        dst.s1 = (float)(shelf_x + w) / tex_width;
+        dst.t0 = (float)shelf_y;    // Em texels ate a altura final ser conhecida
+        dst.t1 = (float)(shelf_y + h);
+
+        shelf_x += w;
+        shelf_height = std::max(shelf_height, h);
+    }
+
+    // O atlas gerado tem somente as linhas usadas (arredondadas para um
+    // multiplo de 4), e nao a altura do atlas original: a textura enviada a
+    // GPU e so do tamanho necessario
+    const int atlas_height = (shelf_y + shelf_height + 3) & ~3;
+    for (int i = 0; i < count; ++i)
+    {
+        texture_glyph_t& g = font.glyphs[i];
+        g.t0 /= atlas_height;
+        g.t1 /= atlas_height;
+    }
+
+    FILE* file = fopen(argv[1], "w");
+    if (!file)
+    {
+        fprintf(stderr, "ERROR: Nao foi possivel criar \"%s\".\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    fprintf(file,
+        "// Gerado por \"src/sdfgen.cpp\" (make sdf) a partir de \"dejavufont.h\"; nao\n"
+        "// edite a mao. Campo de distancia com sinal da fonte: cada texel guarda\n"
+        "// 0.5 + d / %d, com d a distancia ao contorno em pixels da fonte (positiva\n"
+        "// dentro do glifo), saturada em %d pixels. Os glifos tem %d texels de margem.\n"
+        "// Requer \"dejavufont.h\", que define texture_font_t.\n"
+        "#ifndef _DEJAVUFONT_SDF_H\n"
+        "#define _DEJAVUFONT_SDF_H\n"
+        "\n"
+        "#define DEJAVUFONT_SDF_SPREAD %d\n"
+        "\n"
+        "#ifdef __cplusplus\n"
+        "extern \"C\" {\n"
+        "#endif\n"
+        "\n"
+        "texture_font_t dejavufont_sdf = {\n"
+        " %d, %d, %d,\n"
+        " {",
+        2*SDF_SPREAD, SDF_SPREAD, SDF_SPREAD, SDF_SPREAD,
+        tex_width, atlas_height, (int)font.tex_depth);
+
+    // O restante de tex_data (ate o tamanho do atlas original) fica zerado
+    int used = atlas_height * tex_width;
+    for (int i = 0; i < used; ++i)
+    {
+        if (i > 0 && i % 32 == 0)
+            fprintf(file, "\n  ");
+        fprintf(file, "%d%s", font.tex_data[i], i + 1 < used ? "," : "");
+    }
+    fprintf(file, "},\n");
+
+    fprintf(file, " %ff, %ff, %ff, %ff, %ff, %d,\n {\n",
+            font.size, font.height, font.linegap, font.ascender, font.descender, count);
+    for (int i = 0; i < count; ++i)
+    {
+        const texture_glyph_t& g = font.glyphs[i];
+        fprintf(file, "  {%u, %d, %d, %d, %d, %ff, %ff, %ff, %ff, %ff, %ff, 0, {{0, 0.0f}} },\n",
+                (unsigned)g.codepoint, g.width, g.height, g.offset_x, g.offset_y,
+                g.advance_x, g.advance_y, g.s0, g.t0, g.s1, g.t1);
+    }
+    fprintf(file,
+        " }\n"
+        "};\n"
+        "\n"
+        "#ifdef __cplusplus\n"
+        "}\n"
+        "#endif\n"
+        "\n"
+        "#endif // _DEJAVUFONT_SDF_H\n");
+    fclose(file);
+
+    printf("Atlas SDF gravado em \"%s\" (%d glifos, %dx%d texels).\n",
+           argv[1], count, tex_width, atlas_height);
+    return 0;
+}
@@ -0,0 +1,208 @@
+// Operacoes de matrizes com SIMD. Veja "simdmath.h".
+//
+// As funcoes sao escritas uma unica vez sobre um pequeno conjunto de
+// operacoes com 4 floats (SimdVec), implementado em "simdvec.h" para SSE2,
+// NEON e de forma escalar. As matrizes do GLM sao guardadas por colunas, de
+// forma que cada coluna e um SimdVec; os produtos sao combinacoes lineares
+// de colunas e nao precisam de transposicoes.
+#include <cmath>
+#include <vector>
+
+#include "simdmath.h"
+#include "simdvec.h"
+
+const char* Simd_Name() { return SIMD_BACKEND_NAME; }
+
+// Colunas de uma matriz do GLM
+static inline SimdVec Column(const glm::mat4& m, int i) { return Simd_Load(&m[i].x); }
+static inline void    SetColumn(glm::mat4* m, int i, SimdVec v) { Simd_Store(&(*m)[i].x, v); }
+
+// a * b + c
+static inline SimdVec MulAdd(SimdVec a, SimdVec b, SimdVec c) { return Simd_Add(Simd_Mul(a, b), c); }
+
+// m * v, com as colunas de m ja carregadas
+static inline SimdVec TransformColumns(const SimdVec* m, const float* v)
+{
+    SimdVec r = Simd_Mul(m[0], Simd_Splat(v[0]));
+    r = MulAdd(m[1], Simd_Splat(v[1]), r);
+    r = MulAdd(m[2], Simd_Splat(v[2]), r);
+    return MulAdd(m[3], Simd_Splat(v[3]), r);
+}
+
+glm::mat4 Simd_Multiply(const glm::mat4& a, const glm::mat4& b)
+{
+    SimdVec columns[4] = { Column(a, 0), Column(a, 1), Column(a, 2), Column(a, 3) };
+    glm::mat4 r;
+    for (int i = 0; i < 4; ++i)
+        SetColumn(&r, i, TransformColumns(columns, &b[i].x));
+    return r;
+}
+
+glm::vec4 Simd_Transform(const glm::mat4& m, const glm::vec4& v)
+{
+    SimdVec columns[4] = { Column(m, 0), Column(m, 1), Column(m, 2), Column(m, 3) };
+    glm::vec4 r;
+    Simd_Store(&r.x, TransformColumns(columns, &v.x));
+    return r;
+}
+
+glm::mat4 Simd_Translate(const glm::mat4& m, float tx, float ty, float tz)
+{
+    // Somente a quarta coluna muda: m3 + m0*tx + m1*ty + m2*tz
+    glm::mat4 r = m;
+    SimdVec c = MulAdd(Column(m, 0), Simd_Splat(tx), Column(m, 3));
+    c = MulAdd(Column(m, 1), Simd_Splat(ty), c);
+    SetColumn(&r, 3, MulAdd(Column(m, 2), Simd_Splat(tz), c));
+    return r;
+}
+
+glm::mat4 Simd_Scale(const glm::mat4& m, float sx, float sy, float sz)
+{
+    glm::mat4 r = m;
+    SetColumn(&r, 0, Simd_Mul(Column(m, 0), Simd_Splat(sx)));
+    SetColumn(&r, 1, Simd_Mul(Column(m, 1), Simd_Splat(sy)));
+    SetColumn(&r, 2, Simd_Mul(Column(m, 2), Simd_Splat(sz)));
+    return r;
+}
+
+// Rotacao em torno de um eixo da base: somente as colunas "i" e "j" mudam,
+// para (mi*c + mj*s, mj*c - mi*s)
+static glm::mat4 RotateColumns(const glm::mat4& m, int i, int j, float angle)
+{
+    SimdVec c = Simd_Splat(std::cos(angle));
+    SimdVec s = Simd_Splat(std::sin(angle));
+    SimdVec mi = Column(m, i);
+    SimdVec mj = Column(m, j);
+    glm::mat4 r = m;
+    SetColumn(&r, i, Simd_Add(Simd_Mul(mi, c), Simd_Mul(mj, s)));
+    SetColumn(&r, j, Simd_Sub(Simd_Mul(mj, c), Simd_Mul(mi, s)));
+    return r;
+}
+
+glm::mat4 Simd_Rotate_X(const glm::mat4& m, float angle) { return RotateColumns(m, 1, 2, angle); }
+glm::mat4 Simd_Rotate_Y(const glm::mat4& m, float angle) { return RotateColumns(m, 2, 0, angle); }
+glm::mat4 Simd_Rotate_Z(const glm::mat4& m, float angle) { return RotateColumns(m, 0, 1, angle); }
+
+glm::mat4 Simd_Rotate(const glm::mat4& m, float angle, const glm::vec4& axis)
+{
+    // Formula de Rodrigues, como em Matrix_Rotate()
+    float c = std::cos(angle);
+    float s = std::sin(angle);
+    float length = Simd_Norm(axis);
+    float vx = axis.x / length;
+    float vy = axis.y / length;
+    float vz = axis.z / length;
+    float k = 1.0f - c;
+
+    glm::mat4 rotation(
+        vx*vx*k + c,    vx*vy*k + vz*s, vx*vz*k - vy*s, 0.0f,  // COLUNA 1
+        vx*vy*k - vz*s, vy*vy*k + c,    vy*vz*k + vx*s, 0.0f,  // COLUNA 2
+        vx*vz*k + vy*s, vy*vz*k - vx*s, vz*vz*k + c,    0.0f,  // COLUNA 3
+        0.0f,           0.0f,           0.0f,           1.0f); // COLUNA 4
+    return Simd_Multiply(m, rotation);
+}
+
+glm::vec4 Simd_Cross(const glm::vec4& u, const glm::vec4& v)
+{
+    SimdVec a = Simd_Load(&u.x);
+    SimdVec b = Simd_Load(&v.x);
+    glm::vec4 r;
+    Simd_Store(&r.x, Simd_Sub(Simd_Mul(Simd_SwizzleYZX(a), Simd_SwizzleZXY(b)), Simd_Mul(Simd_SwizzleZXY(a), Simd_SwizzleYZX(b))));
+    r.w = 0.0f;
+    return r;
+}
+
+float Simd_Dot(const glm::vec4& u, const glm::vec4& v)
+{
+    return Simd_SumXYZ(Simd_Mul(Simd_Load(&u.x), Simd_Load(&v.x)));
+}
+
+float Simd_Norm(const glm::vec4& v)
+{
+    return std::sqrt(Simd_Dot(v, v));
+}
+
+void Simd_TransformPoints(const glm::mat4& m, const glm::vec4* points, glm::vec4* out, int count)
+{
+    SimdVec columns[4] = { Column(m, 0), Column(m, 1), Column(m, 2), Column(m, 3) };
+    for (int i = 0; i < count; ++i)
+        Simd_Store(&out[i].x, TransformColumns(columns, &points[i].x));
+}
+
+void Simd_ComposeTRS(const SimdTRS* trs, glm::mat4* out, int count)
+{
+    for (int i = 0; i < count; ++i)
+    {
+        const SimdTRS& t = trs[i];
+        float cx = std::cos(t.rotation.x), sx = std::sin(t.rotation.x);
+        float cy = std::cos(t.rotation.y), sy = std::sin(t.rotation.y);
+        float cz = std::cos(t.rotation.z), sz = std::sin(t.rotation.z);
+
+        // Colunas de Rz * Ry * Rx, multiplicadas pela escala
+        float sysx = sy * sx;
+        float sycx = sy * cx;
+        SimdVec c0 = Simd_Set(cz*cy,               sz*cy,               -sy,   0.0f);
+        SimdVec c1 = Simd_Set(cz*sysx - sz*cx,     sz*sysx + cz*cx,     cy*sx, 0.0f);
+        SimdVec c2 = Simd_Set(cz*sycx + sz*sx,     sz*sycx - cz*sx,     cy*cx, 0.0f);
+        SetColumn(&out[i], 0, Simd_Mul(c0, Simd_Splat(t.scale.x)));
+        SetColumn(&out[i], 1, Simd_Mul(c1, Simd_Splat(t.scale.y)));
+        SetColumn(&out[i], 2, Simd_Mul(c2, Simd_Splat(t.scale.z)));
+        SetColumn(&out[i], 3, Simd_Set(t.translation.x, t.translation.y, t.translation.z, 1.0f));
+    }
+}
+
+// Quatro planos com as coordenadas separadas (um plano por elemento)
+struct SimdPlaneGroup
+{
+    SimdVec  nx, ny, nz, d;
+    SimdMask px, py, pz;  // Coordenadas da normal que nao sao negativas
+};
+
+int Simd_CullBoxes(const glm::vec4* planes, int num_planes,
+                   const glm::vec3* box_min, const glm::vec3* box_max, int count,
+                   unsigned char* visible)
+{
+    // Os planos sao agrupados de 4 em 4; os grupos incompletos sao
+    // preenchidos com um plano que contem todo o espaco (0, 0, 0, 1)
+    std::vector<SimdPlaneGroup> groups((num_planes + 3) / 4);
+    for (size_t g = 0; g < groups.size(); ++g)
+    {
+        glm::vec4 p[4];
+        for (int k = 0; k < 4; ++k)
+        {
+            int index = (int)g * 4 + k;
+            p[k] = (index < num_planes) ? planes[index] : glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+        }
+        groups[g].nx = Simd_Set(p[0].x, p[1].x, p[2].x, p[3].x);
+        groups[g].ny = Simd_Set(p[0].y, p[1].y, p[2].y, p[3].y);
+        groups[g].nz = Simd_Set(p[0].z, p[1].z, p[2].z, p[3].z);
+        groups[g].d  = Simd_Set(p[0].w, p[1].w, p[2].w, p[3].w);
+        groups[g].px = Simd_NonNegative(groups[g].nx);
+        groups[g].py = Simd_NonNegative(groups[g].ny);
+        groups[g].pz = Simd_NonNegative(groups[g].nz);
+    }
+
+    // Uma caixa esta fora de um plano se o seu vertice mais distante na
+    // direcao da normal estiver fora dele
+    int num_visible = 0;
+    for (int i = 0; i < count; ++i)
+    {
+        SimdVec min_x = Simd_Splat(box_min[i].x), max_x = Simd_Splat(box_max[i].x);
+        SimdVec min_y = Simd_Splat(box_min[i].y), max_y = Simd_Splat(box_max[i].y);
+        SimdVec min_z = Simd_Splat(box_min[i].z), max_z = Simd_Splat(box_max[i].z);
+
+        bool inside = true;
+        for (size_t g = 0; g < groups.size() && inside; ++g)
+        {
+            const SimdPlaneGroup& group = groups[g];
+            SimdVec distance = MulAdd(group.nx, Simd_Select(group.px, max_x, min_x), group.d);
+            distance = MulAdd(group.ny, Simd_Select(group.py, max_y, min_y), distance);
+            distance = MulAdd(group.nz, Simd_Select(group.pz, max_z, min_z), distance);
+            inside = !Simd_AnyNegative(distance);
+        }
+
+        visible[i] = inside ? 1 : 0;
+        num_visible += inside ? 1 : 0;
+    }
+    return num_visible;
+}
@@ -1,227 +1,313 @@
-// Based on http://hamelot.io/visualization/opengl-text-without-any-external-libraries/
-//   and on https://github.com/rougier/freetype-gl
-#include <string>
-
-#include <glad/glad.h>
-#include <GLFW/glfw3.h>
-
-#include <glm/mat4x4.hpp>
-#include <glm/vec4.hpp>
-
-#include "utils.h"
-#include "dejavufont.h"
-
-GLuint CreateGpuProgram(GLuint vertex_shader_id, GLuint fragment_shader_id); // Função definida em main.cpp
-
-const GLchar* const textvertexshader_source = ""
-"#version 330\n"
-"layout (location = 0) in vec4 position;\n"
-"out vec2 texCoords;\n"
-"void main()\n"
-"{\n"
-    "gl_Position = vec4(position.xy, 0, 1);\n"
-    "texCoords = position.zw;\n"
-"}\n"
-"\0";
-
-const GLchar* const textfragmentshader_source = ""
-"#version 330\n"
-"uniform sampler2D tex;\n"
-"in vec2 texCoords;\n"
-"out vec4 fragColor;\n"
-"void main()\n"
-"{\n"
-    "fragColor = vec4(0, 0, 0, texture(tex, texCoords).r);\n"
-"}\n"
-"\0";
-
-void TextRendering_LoadShader(const GLchar* const shader_string, GLuint shader_id)
-{
-    // Define o código do shader, contido na string "shader_string"
-    glShaderSource(shader_id, 1, &shader_string, NULL);
-
-    // Compila o código do shader (em tempo de execução)
-    glCompileShader(shader_id);
-
-    // Verificamos se ocorreu algum erro ou "warning" durante a compilação
-    GLint compiled_ok;
-    glGetShaderiv(shader_id, GL_COMPILE_STATUS, &compiled_ok);
-
-    GLint log_length = 0;
-    glGetShaderiv(shader_id, GL_INFO_LOG_LENGTH, &log_length);
-
-    // Alocamos memória para guardar o log de compilação.
-    // A chamada "new" em C++ é equivalente ao "malloc()" do C.
-    GLchar* log = new GLchar[log_length];
-    glGetShaderInfoLog(shader_id, log_length, &log_length, log);
-
-    // Imprime no terminal qualquer erro ou "warning" de compilação
-    if ( log_length != 0 )
-    {
-        std::string  output;
-
-        if ( !compiled_ok )
-        {
-            output += "ERROR: OpenGL compilation failed.\n";
-            output += "== Start of compilation log\n";
-            output += log;
-            output += "== End of compilation log\n";
-        }
-        else
-        {
-            output += "ERROR: OpenGL compilation failed.\n";
-            output += "== Start of compilation log\n";
-            output += log;
-            output += "== End of compilation log\n";
-        }
-
-        fprintf(stderr, "%s", output.c_str());
-    }
-
-    // A chamada "delete" em C++ é equivalente ao "free()" do C
-    delete [] log;
-}
-
-GLuint textVAO;
-GLuint textVBO;
-GLuint textprogram_id;
-GLuint texttexture_id;
-
-void TextRendering_Init()
-{
-    GLuint sampler;
-
-    glGenBuffers(1, &textVBO);
-    glGenVertexArrays(1, &textVAO);
-    glGenTextures(1, &texttexture_id);
-    glGenSamplers(1, &sampler);
-    glSamplerParameteri(sampler, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glSamplerParameteri(sampler, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glSamplerParameteri(sampler, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glSamplerParameteri(sampler, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glCheckError();
-
-    GLuint textvertexshader_id = glCreateShader(GL_VERTEX_SHADER);
-    TextRendering_LoadShader(textvertexshader_source, textvertexshader_id);
-    glCheckError();
-
-    GLuint textfragmentshader_id = glCreateShader(GL_FRAGMENT_SHADER);
-    TextRendering_LoadShader(textfragmentshader_source, textfragmentshader_id);
-    glCheckError();
-
-    textprogram_id = CreateGpuProgram(textvertexshader_id, textfragmentshader_id);
-    glLinkProgram(textprogram_id);
-    glCheckError();
-
-    GLuint texttex_uniform;
-    texttex_uniform = glGetUniformLocation(textprogram_id, "tex");
-    glCheckError();
-
-    GLuint textureunit = 31;
-    glActiveTexture(GL_TEXTURE0 + textureunit);
-    glBindTexture(GL_TEXTURE_2D, texttexture_id);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, dejavufont.tex_width, dejavufont.tex_height, 0, GL_RED, GL_UNSIGNED_BYTE, dejavufont.tex_data);
-    glBindSampler(textureunit, sampler);
-    glCheckError();
-
-    glBindVertexArray(textVAO);
-
-    glBindBuffer(GL_ARRAY_BUFFER, textVBO);
-    glBufferData(GL_ARRAY_BUFFER, 24 * sizeof(float), NULL, GL_DYNAMIC_DRAW);
-    glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 0, 0);
-    glEnableVertexAttribArray(0);
-    glCheckError();
-
-    glUseProgram(textprogram_id);
-    glUniform1i(texttex_uniform, textureunit);
-    glUseProgram(0);
-    glCheckError();
-
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
-    glCheckError();
-}
-
-float textscale = 1.5f;
-
-void TextRendering_PrintString(GLFWwindow* window, const std::string &str, float x, float y, float scale = 1.0f)
-{
-    scale *= textscale;
-    int width, height;
-    glfwGetWindowSize(window, &width, &height);
-    float sx = scale / width;
-    float sy = scale / height;
-
-    for (size_t i = 0; i < str.size(); i++)
-    {
-        // Find the glyph for the character we are looking for
-        texture_glyph_t *glyph = 0;
-        for (size_t j = 0; j < dejavufont.glyphs_count; ++j)
-        {
-            if (dejavufont.glyphs[j].codepoint == (uint32_t)str[i])
-            {
-                glyph = &dejavufont.glyphs[j];
-                break;
-            }
-        }
-        if (!glyph) {
-            continue;
-        }
-        x += glyph->kerning[0].kerning;
-        float x0 = (float) (x + glyph->offset_x * sx);
-        float y0 = (float) (y + glyph->offset_y * sy);
-        float x1 = (float) (x0 + glyph->width * sx);
-        float y1 = (float) (y0 - glyph->height * sy);
-
-        float s0 = glyph->s0 - 0.5f/dejavufont.tex_width;
-        float t0 = glyph->t0 - 0.5f/dejavufont.tex_height;
-        float s1 = glyph->s1 - 0.5f/dejavufont.tex_width;
-        float t1 = glyph->t1 - 0.5f/dejavufont.tex_height;
-
-        struct {float x, y, s, t;} data[6] = {
-            { x0, y0, s0, t0 },
-            { x0, y1, s0, t1 },
-            { x1, y1, s1, t1 },
-            { x0, y0, s0, t0 },
-            { x1, y1, s1, t1 },
-            { x1, y0, s1, t0 }
-        };
-
-        glEnable(GL_BLEND);
-        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
-        glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
-        glDepthFunc(GL_ALWAYS);
-        glBindBuffer(GL_ARRAY_BUFFER, textVBO);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, 24 * sizeof(float), data);
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
-
-        glUseProgram(textprogram_id);
-        glBindVertexArray(textVAO);
-
-        glDrawArrays(GL_TRIANGLES, 0, 6);
-
-        glBindVertexArray(0);
-        glUseProgram(0);
-        glDepthFunc(GL_LESS);
-
-        glDisable(GL_BLEND);
-
-        x += (glyph->advance_x * sx);
-    }
-}
-
-float TextRendering_LineHeight(GLFWwindow* window)
-{
-    int width, height;
-    glfwGetWindowSize(window, &width, &height);
-    return dejavufont.height / height * textscale;
-}
-
-float TextRendering_CharWidth(GLFWwindow* window)
-{
-    int width, height;
-    glfwGetWindowSize(window, &width, &height);
-    return dejavufont.glyphs[32].advance_x / width * textscale;
-}
-
+// Based on http://hamelot.io/visualization/opengl-text-without-any-external-libraries/
+//   and on https://github.com/rougier/freetype-gl
+//
+// O texto e desenhado em lote: TextRendering_PrintString() somente acrescenta
+// os quadrilateros dos caracteres a um vetor, e TextRendering_Flush() envia
+// o texto de todo o quadro para a GPU e o desenha com uma unica chamada.
+//
+// Por padrao, os glifos vem do atlas de campo de distancia com sinal (SDF)
+// gerado por "make sdf" (veja "sdfgen.cpp"): cada texel guarda a distancia ao
+// contorno do glifo, e o fragment shader recorta o contorno em 0.5 com uma
+// transicao da largura de um pixel da tela (fwidth), de forma que o texto
+// fica nitido em qualquer escala a partir de um unico atlas pequeno. O atlas
+// de cobertura original continua disponivel ("--text-bitmap").
+#include <string>
+#include <vector>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <glm/mat4x4.hpp>
+#include <glm/vec4.hpp>
+
+#include "utils.h"
+#include "dejavufont.h"
+#include "dejavufont_sdf.h"
+#include "profiler.h"
+#include "texturememory.h"
+
+GLuint CreateGpuProgram(GLuint vertex_shader_id, GLuint fragment_shader_id); // Função definida em main.cpp
+
+const GLchar* const textvertexshader_source = ""
+"#version 330\n"
+"layout (location = 0) in vec4 position;\n"
+"out vec2 texCoords;\n"
+"void main()\n"
+"{\n"
+    "gl_Position = vec4(position.xy, 0, 1);\n"
+    "texCoords = position.zw;\n"
+"}\n"
+"\0";
+
+const GLchar* const textfragmentshader_source = ""
+"#version 330\n"
+"uniform sampler2D tex;\n"
+"in vec2 texCoords;\n"
+"out vec4 fragColor;\n"
+"void main()\n"
+"{\n"
+    "fragColor = vec4(0, 0, 0, texture(tex, texCoords).r);\n"
+"}\n"
+"\0";
+
+// Recorta o contorno (0.5) do campo de distancia, suavizando a borda em
+// aproximadamente um pixel da tela, qualquer que seja a escala do texto
+const GLchar* const textsdffragmentshader_source = ""
+"#version 330\n"
+"uniform sampler2D tex;\n"
+"in vec2 texCoords;\n"
+"out vec4 fragColor;\n"
+"void main()\n"
+"{\n"
+    "float d = texture(tex, texCoords).r;\n"
+    "float w = max(fwidth(d), 1e-4);\n"
+    "fragColor = vec4(0, 0, 0, smoothstep(0.5 - w, 0.5 + w, d));\n"
+"}\n"
+"\0";
+
+void TextRendering_LoadShader(const GLchar* const shader_string, GLuint shader_id)
+{
+    // Define o código do shader, contido na string "shader_string"
+    glShaderSource(shader_id, 1, &shader_string, NULL);
+
+    // Compila o código do shader (em tempo de execução)
+    glCompileShader(shader_id);
+
+    // Verificamos se ocorreu algum erro ou "warning" durante a compilação
+    GLint compiled_ok;
+    glGetShaderiv(shader_id, GL_COMPILE_STATUS, &compiled_ok);
+
+    GLint log_length = 0;
+    glGetShaderiv(shader_id, GL_INFO_LOG_LENGTH, &log_length);
+
+    // Alocamos memória para guardar o log de compilação.
+    // A chamada "new" em C++ é equivalente ao "malloc()" do C.
+    GLchar* log = new GLchar[log_length];
+    glGetShaderInfoLog(shader_id, log_length, &log_length, log);
+
+    // Imprime no terminal qualquer erro ou "warning" de compilação
+    if ( log_length != 0 )
+    {
+        std::string  output;
+
+        if ( !compiled_ok )
+        {
+            output += "ERROR: OpenGL compilation failed.\n";
+            output += "== Start of compilation log\n";
+            output += log;
+            output += "== End of compilation log\n";
+        }
+        else
+        {
+            output += "ERROR: OpenGL compilation failed.\n";
+            output += "== Start of compilation log\n";
+            output += log;
+            output += "== End of compilation log\n";
+        }
+
+        fprintf(stderr, "%s", output.c_str());
+    }
+
+    // A chamada "delete" em C++ é equivalente ao "free()" do C
+    delete [] log;
+}
+
+GLuint textVAO;
+GLuint textVBO;
+GLuint textprogram_id;
+GLuint texttexture_id;
+
+// Vertices (x, y, s, t) dos caracteres acumulados desde o ultimo
+// TextRendering_Flush(), e capacidade atual do VBO, em bytes
+struct TextVertex { float x, y, s, t; };
+static std::vector<TextVertex> g_TextVertices;
+static size_t g_TextBufferCapacity = 0;
+
+// Fonte em uso: o atlas SDF ou o atlas de cobertura original
+static bool g_TextSdf = true;
+static const texture_font_t* g_TextFont = &dejavufont_sdf;
+
+// Indice em g_TextFont->glyphs de cada caractere ASCII (-1 se nao existir)
+static int g_TextGlyphIndex[128];
+
+// Tamanho da janela, consultado uma vez por quadro em TextRendering_BeginFrame()
+static int g_TextWindowWidth = 0;
+static int g_TextWindowHeight = 0;
+
+static void UpdateWindowSize(GLFWwindow* window)
+{
+    glfwGetWindowSize(window, &g_TextWindowWidth, &g_TextWindowHeight);
+}
+
+static void EnsureWindowSize(GLFWwindow* window)
+{
+    if (g_TextWindowWidth == 0 || g_TextWindowHeight == 0)
+        UpdateWindowSize(window);
+}
+
+void TextRendering_SetSdf(bool enabled)
+{
+    g_TextSdf = enabled;
+    g_TextFont = enabled ? &dejavufont_sdf : &dejavufont;
+}
+
+void TextRendering_Init()
+{
+    GLuint sampler;
+
+    glGenBuffers(1, &textVBO);
+    glGenVertexArrays(1, &textVAO);
+    glGenTextures(1, &texttexture_id);
+    glGenSamplers(1, &sampler);
+    glSamplerParameteri(sampler, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glSamplerParameteri(sampler, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glSamplerParameteri(sampler, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glSamplerParameteri(sampler, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glCheckError();
+
+    GLuint textvertexshader_id = glCreateShader(GL_VERTEX_SHADER);
+    TextRendering_LoadShader(textvertexshader_source, textvertexshader_id);
+    glCheckError();
+
+    GLuint textfragmentshader_id = glCreateShader(GL_FRAGMENT_SHADER);
+    TextRendering_LoadShader(g_TextSdf ? textsdffragmentshader_source : textfragmentshader_source, textfragmentshader_id);
+    glCheckError();
+
+    textprogram_id = CreateGpuProgram(textvertexshader_id, textfragmentshader_id);
+    glLinkProgram(textprogram_id);
+    glCheckError();
+
+    GLuint texttex_uniform;
+    texttex_uniform = glGetUniformLocation(textprogram_id, "tex");
+    glCheckError();
+
+    GLuint textureunit = 31;
+    glActiveTexture(GL_TEXTURE0 + textureunit);
+    glBindTexture(GL_TEXTURE_2D, texttexture_id);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, g_TextFont->tex_width, g_TextFont->tex_height, 0, GL_RED, GL_UNSIGNED_BYTE, g_TextFont->tex_data);
+    char description[64];
+    snprintf(description, sizeof(description), "%dx%d, r8", (int)g_TextFont->tex_width, (int)g_TextFont->tex_height);
+    TextureMemory_Set("fonte", description, (size_t)g_TextFont->tex_width * g_TextFont->tex_height);
+    glBindSampler(textureunit, sampler);
+    glCheckError();
+
+    glBindVertexArray(textVAO);
+
+    glBindBuffer(GL_ARRAY_BUFFER, textVBO);
+    glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 0, 0);
+    glEnableVertexAttribArray(0);
+    glCheckError();
+
+    glUseProgram(textprogram_id);
+    glUniform1i(texttex_uniform, textureunit);
+    glUseProgram(0);
+    glCheckError();
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+    glCheckError();
+
+    for (int c = 0; c < 128; ++c)
+        g_TextGlyphIndex[c] = -1;
+    for (size_t j = 0; j < g_TextFont->glyphs_count; ++j)
+    {
+        uint32_t codepoint = g_TextFont->glyphs[j].codepoint;
+        if (codepoint < 128 && g_TextGlyphIndex[codepoint] < 0)
+            g_TextGlyphIndex[codepoint] = (int)j;
+    }
+}
+
+float textscale = 1.5f;
+
+void TextRendering_PrintString(GLFWwindow* window, const std::string &str, float x, float y, float scale = 1.0f)
+{
+    EnsureWindowSize(window);
+    scale *= textscale;
+    float sx = scale / g_TextWindowWidth;
+    float sy = scale / g_TextWindowHeight;
+
+    for (size_t i = 0; i < str.size(); i++)
+    {
+        unsigned char c = (unsigned char)str[i];
+        if (c >= 128 || g_TextGlyphIndex[c] < 0)
+            continue;
+        const texture_glyph_t* glyph = &g_TextFont->glyphs[g_TextGlyphIndex[c]];
+
+        x += glyph->kerning[0].kerning;
+        float x0 = (float) (x + glyph->offset_x * sx);
+        float y0 = (float) (y + glyph->offset_y * sy);
+        float x1 = (float) (x0 + glyph->width * sx);
+        float y1 = (float) (y0 - glyph->height * sy);
+
+        float s0 = glyph->s0 - 0.5f/g_TextFont->tex_width;
+        float t0 = glyph->t0 - 0.5f/g_TextFont->tex_height;
+        float s1 = glyph->s1 - 0.5f/g_TextFont->tex_width;
+        float t1 = glyph->t1 - 0.5f/g_TextFont->tex_height;
+
+        TextVertex data[6] = {
+            { x0, y0, s0, t0 },
+            { x0, y1, s0, t1 },
+            { x1, y1, s1, t1 },
+            { x0, y0, s0, t0 },
+            { x1, y1, s1, t1 },
+            { x1, y0, s1, t0 }
+        };
+        g_TextVertices.insert(g_TextVertices.end(), data, data + 6);
+
+        x += (glyph->advance_x * sx);
+    }
+}
+
+void TextRendering_BeginFrame(GLFWwindow* window)
+{
+    UpdateWindowSize(window);
+}
+
+void TextRendering_Flush(GLFWwindow* window)
+{
+    if (!g_TextVertices.empty())
+    {
+        // O VBO e realocado a cada quadro ("orphaning"), de forma que o
+        // driver nao precisa esperar a GPU terminar o desenho anterior
+        size_t size = g_TextVertices.size() * sizeof(TextVertex);
+        if (size > g_TextBufferCapacity)
+            g_TextBufferCapacity = size * 2;
+        glBindBuffer(GL_ARRAY_BUFFER, textVBO);
+        glBufferData(GL_ARRAY_BUFFER, g_TextBufferCapacity, NULL, GL_STREAM_DRAW);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, size, g_TextVertices.data());
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+        // O alpha do destino acumula a cobertura, de forma que o texto
+        // desenhado na textura do HUD (veja "hud.h") fica com cores
+        // pre-multiplicadas
+        glEnable(GL_BLEND);
+        glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+        glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+        glDepthFunc(GL_ALWAYS);
+        glUseProgram(textprogram_id);
+        glBindVertexArray(textVAO);
+
+        glDrawArrays(GL_TRIANGLES, 0, (GLsizei)g_TextVertices.size());
+        Profiler_CountDraw((int)g_TextVertices.size() / 3);
+
+        glBindVertexArray(0);
+        glUseProgram(0);
+        glDepthFunc(GL_LESS);
+        glDisable(GL_BLEND);
+
+        g_TextVertices.clear();
+    }
+}
+
+float TextRendering_LineHeight(GLFWwindow* window)
+{
+    EnsureWindowSize(window);
+    return g_TextFont->height / g_TextWindowHeight * textscale;
+}
+
+float TextRendering_CharWidth(GLFWwindow* window)
+{
+    EnsureWindowSize(window);
+    return g_TextFont->glyphs[32].advance_x / g_TextWindowWidth * textscale;
+}
+
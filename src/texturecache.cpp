@@ -0,0 +1,528 @@
+// Cache de texturas pre-processadas. Veja "texturecache.h".
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <atomic>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <stb_image.h>
+
+#include "texturecache.h"
+#include "trace.h"
+
+// Cabecalho do arquivo, seguido de num_levels TextureCacheLevelHeader.
+// Todos os campos tem alinhamento natural, sem preenchimento.
+struct TextureCacheHeader
+{
+    char     magic[4];          // "FCGT"
+    uint32_t version;
+    uint64_t source_hash;       // TextureCache_Hash() da imagem de origem
+    uint64_t source_size;
+    uint32_t width, height;
+    uint32_t format;
+    uint32_t quality;           // BcQuality (0 nos formatos sem compressao)
+    uint32_t num_levels;
+    uint32_t reserved;          // Zero
+};
+
+struct TextureCacheLevelHeader
+{
+    uint32_t width, height;
+    uint64_t offset;            // A partir do inicio do arquivo
+    uint64_t size;
+};
+
+static_assert(sizeof(TextureCacheHeader) == 48, "Cabecalho do cache de texturas com preenchimento");
+static_assert(sizeof(TextureCacheLevelHeader) == 24, "Cabecalho de nivel do cache de texturas com preenchimento");
+
+// Os dados de cada nivel comecam em um multiplo deste alinhamento
+#define TEXTURE_CACHE_ALIGNMENT 16
+
+const char* TextureCache_FormatName(TextureCacheFormat format)
+{
+    switch (format)
+    {
+    case TEXTURE_CACHE_RGB8: return "rgb8";
+    case TEXTURE_CACHE_RGBA8: return "rgba8";
+    case TEXTURE_CACHE_BC1:  return "bc1";
+    case TEXTURE_CACHE_BC3:  return "bc3";
+    case TEXTURE_CACHE_BC7:  return "bc7";
+    }
+    return "?";
+}
+
+static BcFormat ToBcFormat(uint32_t format)
+{
+    return format == TEXTURE_CACHE_BC1 ? BC_FORMAT_BC1 : (format == TEXTURE_CACHE_BC3 ? BC_FORMAT_BC3 : BC_FORMAT_BC7);
+}
+
+// Tamanho em bytes de um nivel com as dimensoes dadas
+static uint64_t LevelSize(uint32_t format, uint32_t width, uint32_t height)
+{
+    if (format == TEXTURE_CACHE_RGB8)
+        return (uint64_t)width * height * 3;
+    if (format == TEXTURE_CACHE_RGBA8)
+        return (uint64_t)width * height * 4;
+    return Bc_CompressedSize(ToBcFormat(format), width, height);
+}
+
+size_t TextureCache_LevelSize(TextureCacheFormat format, int width, int height)
+{
+    return (size_t)LevelSize(format, width, height);
+}
+
+uint64_t TextureCache_Hash(const void* data, size_t size)
+{
+    const unsigned char* bytes = (const unsigned char*)data;
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+// Arquivo lido por inteiro: mapeado na memoria (POSIX) ou copiado para um
+// buffer (Windows)
+struct MappedFile
+{
+    void*  data;
+    size_t size;
+};
+
+static bool MapFile(const char* filename, MappedFile* file)
+{
+    file->data = NULL;
+    file->size = 0;
+#ifdef _WIN32
+    FILE* f = fopen(filename, "rb");
+    if (f == NULL)
+        return false;
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    if (size > 0)
+    {
+        file->data = malloc(size);
+        if (fread(file->data, 1, size, f) == (size_t)size)
+            file->size = size;
+        else
+        {
+            free(file->data);
+            file->data = NULL;
+        }
+    }
+    fclose(f);
+    return file->data != NULL;
+#else
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0)
+        return false;
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0)
+    {
+        void* data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED)
+        {
+            file->data = data;
+            file->size = st.st_size;
+        }
+    }
+    close(fd);
+    return file->data != NULL;
+#endif
+}
+
+static void UnmapFile(void* data, size_t size)
+{
+    if (data == NULL)
+        return;
+#ifdef _WIN32
+    (void)size;
+    free(data);
+#else
+    munmap(data, size);
+#endif
+}
+
+bool TextureCache_ImageSize(const char* filename, int* width, int* height)
+{
+    int channels;
+    return stbi_info(filename, width, height, &channels) != 0;
+}
+
+void TextureCache_Release(CookedTexture* texture)
+{
+    if (texture->mapped)
+        UnmapFile(texture->storage, texture->storage_size);
+    else
+        free(texture->storage);
+    texture->storage = NULL;
+    texture->storage_size = 0;
+    texture->mapped = false;
+    texture->num_levels = 0;
+}
+
+// Preenche os niveis de "texture" a partir de um arquivo de cache inteiro
+// na memoria. Retorna false se o arquivo for invalido ou de outra imagem.
+// Com width ou height zero, aceita qualquer tamanho.
+static bool ParseCache(const unsigned char* data, size_t size, uint64_t source_hash, uint64_t source_size,
+                       uint32_t width, uint32_t height, uint32_t format, uint32_t quality, CookedTexture* texture)
+{
+    TextureCacheHeader header;
+    if (size < sizeof(header))
+        return false;
+    memcpy(&header, data, sizeof(header));
+
+    if (memcmp(header.magic, "FCGT", 4) != 0 || header.version != TEXTURE_CACHE_VERSION
+        || header.source_hash != source_hash || header.source_size != source_size
+        || header.format != format || header.quality != quality
+        || (width != 0 && height != 0 && (header.width != width || header.height != height))
+        || header.num_levels < 1 || header.num_levels > TEXTURE_CACHE_MAX_LEVELS
+        || size < sizeof(header) + header.num_levels * sizeof(TextureCacheLevelHeader))
+        return false;
+
+    texture->width = header.width;
+    texture->height = header.height;
+    texture->format = header.format;
+    texture->num_levels = header.num_levels;
+    for (uint32_t i = 0; i < header.num_levels; ++i)
+    {
+        TextureCacheLevelHeader level;
+        memcpy(&level, data + sizeof(header) + i * sizeof(level), sizeof(level));
+        if (level.width == 0 || level.height == 0
+            || level.size != LevelSize(header.format, level.width, level.height)
+            || level.offset > size || level.size > size - level.offset)
+            return false;
+        texture->levels[i].width = level.width;
+        texture->levels[i].height = level.height;
+        texture->levels[i].data = data + level.offset;
+        texture->levels[i].size = level.size;
+    }
+    return true;
+}
+
+// Conversoes entre sRGB (8 bits) e intensidade linear
+static float g_SrgbToLinear[256];
+
+static bool InitSrgbTable()
+{
+    for (int i = 0; i < 256; ++i)
+    {
+        float c = i / 255.0f;
+        g_SrgbToLinear[i] = c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+    }
+    return true;
+}
+
+// Tabela preenchida na inicializacao do programa
+static const bool g_SrgbTableReady = InitSrgbTable();
+
+// Numera os arquivos temporarios gravados antes de cada rename()
+static std::atomic<unsigned int> g_TextureCacheTemporaryCounter(0);
+
+static unsigned char LinearToSrgb(float c)
+{
+    float s = c <= 0.0031308f ? c * 12.92f : 1.055f * std::pow(c, 1.0f / 2.4f) - 0.055f;
+    int value = (int)(s * 255.0f + 0.5f);
+    return (unsigned char)(value < 0 ? 0 : (value > 255 ? 255 : value));
+}
+
+// Filtro de Lanczos com 3 lobulos
+static float Lanczos3(float x)
+{
+    const float pi = 3.14159265358979f;
+    x = std::fabs(x);
+    if (x < 1e-6f)
+        return 1.0f;
+    if (x >= 3.0f)
+        return 0.0f;
+    return 3.0f * std::sin(pi * x) * std::sin(pi * x / 3.0f) / (pi * pi * x * x);
+}
+
+// Pesos normalizados do filtro em um eixo: o texel de destino i e a soma de
+// weights[i*taps + t] vezes o texel de origem first[i] + t (limitado a
+// borda). Na reducao, o filtro e alargado na proporcao da escala.
+static int ResampleWeights(int src_size, int dst_size, std::vector<int>* first, std::vector<float>* weights)
+{
+    float scale = (float)src_size / dst_size;
+    float stretch = std::max(1.0f, scale);
+    float support = 3.0f * stretch;
+    int taps = (int)std::ceil(2.0f * support) + 1;
+
+    first->resize(dst_size);
+    weights->assign((size_t)dst_size * taps, 0.0f);
+    for (int i = 0; i < dst_size; ++i)
+    {
+        float center = (i + 0.5f) * scale - 0.5f;
+        int f = (int)std::floor(center - support) + 1;
+        float sum = 0.0f;
+        for (int t = 0; t < taps; ++t)
+        {
+            float w = Lanczos3((f + t - center) / stretch);
+            (*weights)[(size_t)i * taps + t] = w;
+            sum += w;
+        }
+        for (int t = 0; t < taps; ++t)
+            (*weights)[(size_t)i * taps + t] /= sum;
+        (*first)[i] = f;
+    }
+    return taps;
+}
+
+// Redimensiona uma imagem RGB8 sRGB com o filtro de Lanczos, separavel
+// (linhas e depois colunas), em espaco linear. O excesso dos lobulos
+// negativos e cortado ao voltar para 8 bits.
+static void Resample(const unsigned char* src, int src_width, int src_height,
+                     unsigned char* dst, int dst_width, int dst_height)
+{
+    TRACE_ZONE("TextureCache_Resample");
+
+    std::vector<int> first_x, first_y;
+    std::vector<float> weights_x, weights_y;
+    int taps_x = ResampleWeights(src_width, dst_width, &first_x, &weights_x);
+    int taps_y = ResampleWeights(src_height, dst_height, &first_y, &weights_y);
+
+    std::vector<float> rows((size_t)dst_width * src_height * 3);
+    for (int y = 0; y < src_height; ++y)
+        for (int x = 0; x < dst_width; ++x)
+        {
+            float sum[3] = { 0.0f, 0.0f, 0.0f };
+            for (int t = 0; t < taps_x; ++t)
+            {
+                int sx = std::min(std::max(first_x[x] + t, 0), src_width - 1);
+                const unsigned char* p = &src[((size_t)y * src_width + sx) * 3];
+                float w = weights_x[(size_t)x * taps_x + t];
+                for (int k = 0; k < 3; ++k)
+                    sum[k] += w * g_SrgbToLinear[p[k]];
+            }
+            for (int k = 0; k < 3; ++k)
+                rows[((size_t)y * dst_width + x) * 3 + k] = sum[k];
+        }
+
+    for (int y = 0; y < dst_height; ++y)
+        for (int x = 0; x < dst_width; ++x)
+        {
+            float sum[3] = { 0.0f, 0.0f, 0.0f };
+            for (int t = 0; t < taps_y; ++t)
+            {
+                int sy = std::min(std::max(first_y[y] + t, 0), src_height - 1);
+                const float* p = &rows[((size_t)sy * dst_width + x) * 3];
+                float w = weights_y[(size_t)y * taps_y + t];
+                for (int k = 0; k < 3; ++k)
+                    sum[k] += w * p[k];
+            }
+            for (int k = 0; k < 3; ++k)
+                dst[((size_t)y * dst_width + x) * 3 + k] = LinearToSrgb(sum[k]);
+        }
+}
+
+// Reduz um nivel RGB8 sRGB para o proximo (metade do tamanho, no minimo 1),
+// com a media de 2x2 texels em espaco linear. Em dimensoes impares, o
+// ultimo texel e repetido.
+static void Downsample(const unsigned char* src, int src_width, int src_height,
+                       unsigned char* dst, int dst_width, int dst_height)
+{
+    for (int y = 0; y < dst_height; ++y)
+    {
+        int y0 = std::min(2*y, src_height - 1);
+        int y1 = std::min(2*y + 1, src_height - 1);
+        for (int x = 0; x < dst_width; ++x)
+        {
+            int x0 = std::min(2*x, src_width - 1);
+            int x1 = std::min(2*x + 1, src_width - 1);
+            const unsigned char* a = &src[(y0 * src_width + x0) * 3];
+            const unsigned char* b = &src[(y0 * src_width + x1) * 3];
+            const unsigned char* c = &src[(y1 * src_width + x0) * 3];
+            const unsigned char* d = &src[(y1 * src_width + x1) * 3];
+            for (int k = 0; k < 3; ++k)
+            {
+                float sum = g_SrgbToLinear[a[k]] + g_SrgbToLinear[b[k]] + g_SrgbToLinear[c[k]] + g_SrgbToLinear[d[k]];
+                dst[(y * dst_width + x) * 3 + k] = LinearToSrgb(0.25f * sum);
+            }
+        }
+    }
+}
+
+// Monta o arquivo de cache inteiro em um buffer: cabecalho, niveis e dados
+// de toda a cadeia de mipmaps gerada a partir de "pixels" (RGB8), comprimindo
+// cada nivel em ate num_threads threads. Retorna false se o buffer nao puder
+// ser alocado.
+static bool Cook(const unsigned char* pixels, int width, int height, uint64_t source_hash, uint64_t source_size,
+                 uint32_t format, uint32_t quality, int num_threads, CookedTexture* texture)
+{
+    TRACE_ZONE_DETAIL("TextureCache_Cook", TextureCache_FormatName((TextureCacheFormat)format));
+
+    TextureCacheHeader header;
+    memcpy(header.magic, "FCGT", 4);
+    header.version = TEXTURE_CACHE_VERSION;
+    header.source_hash = source_hash;
+    header.source_size = source_size;
+    header.width = width;
+    header.height = height;
+    header.format = format;
+    header.quality = quality;
+    header.num_levels = 1;
+    header.reserved = 0;
+    while (header.num_levels < TEXTURE_CACHE_MAX_LEVELS
+           && ((width >> (header.num_levels - 1)) > 1 || (height >> (header.num_levels - 1)) > 1))
+        header.num_levels += 1;
+
+    TextureCacheLevelHeader levels[TEXTURE_CACHE_MAX_LEVELS] = {};
+    size_t offset = sizeof(header) + header.num_levels * sizeof(TextureCacheLevelHeader);
+    for (uint32_t i = 0; i < header.num_levels; ++i)
+    {
+        offset = (offset + TEXTURE_CACHE_ALIGNMENT - 1) / TEXTURE_CACHE_ALIGNMENT * TEXTURE_CACHE_ALIGNMENT;
+        levels[i].width = std::max(1, width >> i);
+        levels[i].height = std::max(1, height >> i);
+        levels[i].offset = offset;
+        levels[i].size = LevelSize(format, levels[i].width, levels[i].height);
+        offset += levels[i].size;
+    }
+
+    unsigned char* data = (unsigned char*)calloc(offset, 1);
+    if (data == NULL)
+    {
+        fprintf(stderr, "ERROR: Cannot allocate %lu bytes for a texture cache.\n", (unsigned long)offset);
+        return false;
+    }
+    memcpy(data, &header, sizeof(header));
+    memcpy(data + sizeof(header), levels, header.num_levels * sizeof(TextureCacheLevelHeader));
+    if (format == TEXTURE_CACHE_RGB8)
+    {
+        memcpy(data + levels[0].offset, pixels, levels[0].size);
+        for (uint32_t i = 1; i < header.num_levels; ++i)
+            Downsample(data + levels[i-1].offset, levels[i-1].width, levels[i-1].height,
+                       data + levels[i].offset, levels[i].width, levels[i].height);
+    }
+    else
+    {
+        // Os mipmaps sao gerados a partir do nivel anterior em RGB8, e cada
+        // nivel e convertido para RGBA8 ou comprimido por todos os nucleos
+        std::vector<unsigned char> level(pixels, pixels + (size_t)width * height * 3), next;
+        for (uint32_t i = 0; i < header.num_levels; ++i)
+        {
+            if (i > 0)
+            {
+                next.resize((size_t)levels[i].width * levels[i].height * 3);
+                Downsample(&level[0], levels[i-1].width, levels[i-1].height,
+                           &next[0], levels[i].width, levels[i].height);
+                level.swap(next);
+            }
+            if (format == TEXTURE_CACHE_RGBA8)
+            {
+                unsigned char* dst = data + levels[i].offset;
+                for (size_t k = 0; k < (size_t)levels[i].width * levels[i].height; ++k)
+                {
+                    dst[k*4 + 0] = level[k*3 + 0];
+                    dst[k*4 + 1] = level[k*3 + 1];
+                    dst[k*4 + 2] = level[k*3 + 2];
+                    dst[k*4 + 3] = 255;
+                }
+            }
+            else
+                Bc_EncodeImage(ToBcFormat(format), (BcQuality)quality, &level[0], levels[i].width, levels[i].height, 3,
+                               data + levels[i].offset, num_threads);
+        }
+    }
+
+    texture->storage = data;
+    texture->storage_size = offset;
+    texture->mapped = false;
+    ParseCache(data, offset, source_hash, source_size, 0, 0, format, quality, texture);
+    return true;
+}
+
+bool TextureCache_Load(const char* filename, int width, int height, TextureCacheFormat format, BcQuality quality,
+                       int num_threads, CookedTexture* texture)
+{
+    memset(texture, 0, sizeof(*texture));
+    std::string cache_filename = std::string(filename);
+    if (format != TEXTURE_CACHE_RGB8)
+        cache_filename = cache_filename + "." + TextureCache_FormatName(format);
+    cache_filename += ".texcache";
+    uint32_t stored_quality = (format == TEXTURE_CACHE_RGB8 || format == TEXTURE_CACHE_RGBA8) ? 0 : quality;
+
+    MappedFile source;
+    if (!MapFile(filename, &source))
+        return false;
+    uint64_t source_hash = TextureCache_Hash(source.data, source.size);
+
+    // Cache valido: os niveis apontam diretamente para o arquivo mapeado
+    MappedFile cache;
+    if (MapFile(cache_filename.c_str(), &cache))
+    {
+        if (ParseCache((const unsigned char*)cache.data, cache.size, source_hash, source.size, width, height,
+                       format, stored_quality, texture))
+        {
+            UnmapFile(source.data, source.size);
+            texture->storage = cache.data;
+            texture->storage_size = cache.size;
+            texture->mapped = true;
+            texture->from_cache = true;
+            return true;
+        }
+        UnmapFile(cache.data, cache.size);
+    }
+
+    // Sem cache, ou cache de outra versao da imagem, qualidade ou tamanho:
+    // decodificamos a imagem e gravamos um cache novo
+    int source_width, source_height, channels;
+    unsigned char* pixels = stbi_load_from_memory((const stbi_uc*)source.data, (int)source.size,
+                                                  &source_width, &source_height, &channels, 3);
+    UnmapFile(source.data, source.size);
+    if (pixels == NULL)
+        return false;
+
+    bool cooked;
+    if (width > 0 && height > 0 && (width != source_width || height != source_height))
+    {
+        std::vector<unsigned char> resized((size_t)width * height * 3);
+        Resample(pixels, source_width, source_height, &resized[0], width, height);
+        cooked = Cook(&resized[0], width, height, source_hash, source.size, format, stored_quality, num_threads,
+                      texture);
+    }
+    else
+        cooked = Cook(pixels, source_width, source_height, source_hash, source.size, format, stored_quality,
+                      num_threads, texture);
+    stbi_image_free(pixels);
+    if (!cooked)
+        return false;
+
+    // Gravamos em um arquivo temporario, com nome unico, e o renomeamos por
+    // cima do cache: uma falha no meio da gravacao, ou duas threads gerando
+    // o cache da mesma imagem, nunca deixam um cache incompleto para ser
+    // mapeado na proxima carga
+    char suffix[32];
+    snprintf(suffix, sizeof(suffix), ".%u.tmp", g_TextureCacheTemporaryCounter.fetch_add(1));
+    std::string temporary_filename = cache_filename + suffix;
+
+    FILE* file = fopen(temporary_filename.c_str(), "wb");
+    bool saved = file != NULL && fwrite(texture->storage, 1, texture->storage_size, file) == texture->storage_size;
+    if (file != NULL && fclose(file) != 0)
+        saved = false;
+#ifdef _WIN32
+    // No Windows, rename() nao substitui um arquivo existente
+    if (saved)
+        remove(cache_filename.c_str());
+#endif
+    if (saved && rename(temporary_filename.c_str(), cache_filename.c_str()) != 0)
+        saved = false;
+    if (!saved)
+    {
+        fprintf(stderr, "WARNING: Cannot write texture cache \"%s\".\n", cache_filename.c_str());
+        remove(temporary_filename.c_str());
+    }
+    return true;
+}
@@ -0,0 +1,63 @@
+// Contabilidade da memoria de texturas. Veja "texturememory.h".
+#include <cstdio>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "texturememory.h"
+
+struct TextureMemoryEntry
+{
+    std::string name;
+    std::string description;
+    size_t      bytes;
+};
+
+static std::vector<TextureMemoryEntry> g_TextureMemoryEntries;
+
+void TextureMemory_Set(const char* name, const char* description, size_t bytes)
+{
+    for (size_t i = 0; i < g_TextureMemoryEntries.size(); ++i)
+    {
+        if (g_TextureMemoryEntries[i].name != name)
+            continue;
+        if (bytes == 0)
+            g_TextureMemoryEntries.erase(g_TextureMemoryEntries.begin() + i);
+        else
+        {
+            g_TextureMemoryEntries[i].description = description;
+            g_TextureMemoryEntries[i].bytes = bytes;
+        }
+        return;
+    }
+
+    if (bytes == 0)
+        return;
+    TextureMemoryEntry entry;
+    entry.name = name;
+    entry.description = description;
+    entry.bytes = bytes;
+    g_TextureMemoryEntries.push_back(entry);
+}
+
+size_t TextureMemory_Total()
+{
+    size_t total = 0;
+    for (size_t i = 0; i < g_TextureMemoryEntries.size(); ++i)
+        total += g_TextureMemoryEntries[i].bytes;
+    return total;
+}
+
+void TextureMemory_PrintReport()
+{
+    std::vector<TextureMemoryEntry> entries = g_TextureMemoryEntries;
+    std::sort(entries.begin(), entries.end(), [](const TextureMemoryEntry& a, const TextureMemoryEntry& b) {
+        return a.bytes > b.bytes;
+    });
+
+    printf("Memoria de texturas:\n");
+    for (size_t i = 0; i < entries.size(); ++i)
+        printf("  %8.2f MB  %s (%s)\n", entries[i].bytes / (1024.0 * 1024.0), entries[i].name.c_str(),
+               entries[i].description.c_str());
+    printf("  %8.2f MB  total\n", TextureMemory_Total() / (1024.0 * 1024.0));
+}
@@ -0,0 +1,396 @@
+// Envio de texturas em partes por um anel de PBOs. Veja "textureupload.h".
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include "textureupload.h"
+#include "trace.h"
+
+// GL_ARB_buffer_storage (OpenGL 4.4). A GLAD foi gerada somente com o
+// OpenGL 3.3, sem extensoes; a funcao e obtida pela GLFW.
+#define GL_MAP_PERSISTENT_BIT 0x0040
+#define GL_MAP_COHERENT_BIT   0x0080
+typedef void (APIENTRYP BufferStorageProc)(GLenum target, GLsizeiptr size, const void* data, GLbitfield flags);
+
+// Alinhamento do inicio de cada faixa dentro do PBO
+#define TEXTURE_UPLOAD_ALIGNMENT 16
+
+// Uma imagem na fila. Os niveis ficam validos ate o ultimo ser copiado.
+struct UploadImage
+{
+    std::string   name;
+    CookedTexture texture;
+    int           array;            // Indice em g_UploadArrays
+    int           layer;
+    int           first_level;      // Nivel da imagem enviado ao nivel 0 do array
+    int           remaining_levels;
+    unsigned long first_frame;      // Quadro da primeira copia
+};
+
+// Um nivel de uma imagem, copiado em faixas de linhas
+struct UploadLevel
+{
+    int    image;                   // Indice em g_UploadImages
+    int    level;
+    size_t row_bytes;               // Bytes de uma linha de texels (ou de blocos)
+    int    rows_per_unit;           // Linhas de texels por linha de dados (4 em BC*)
+    int    num_rows;                // Linhas de dados do nivel
+    int    next_row;                // Primeira linha ainda nao copiada
+};
+
+// Um GL_TEXTURE_2D_ARRAY registrado
+struct UploadArray
+{
+    GLuint texture;
+    GLenum internal_format;
+    int    num_levels;
+    int    base_level;              // GL_TEXTURE_BASE_LEVEL atual
+    std::vector<int> finest_level;  // Por camada: nivel mais fino ja enviado
+                                    // (num_levels se nenhum)
+};
+
+// Uma faixa copiada para o PBO neste quadro
+struct UploadCopy
+{
+    int    image;
+    int    level;
+    int    y, height;               // Em texels
+    size_t offset, size;            // No PBO
+    bool   last;                    // Ultima faixa do nivel
+};
+
+static GLuint         g_UploadBuffer = 0;
+static unsigned char* g_UploadMapped = NULL;    // Mapeamento persistente, ou NULL
+static size_t         g_UploadBudget = TEXTURE_UPLOAD_DEFAULT_BUDGET;
+static GLsync         g_UploadFences[TEXTURE_UPLOAD_RING_FRAMES];
+static int            g_UploadSegment = 0;
+
+static std::vector<UploadArray> g_UploadArrays;
+static std::vector<UploadImage> g_UploadImages;
+static std::vector<UploadLevel> g_UploadLevels; // Fila, do menor nivel para o maior
+static std::vector<UploadCopy>  g_UploadCopies;
+
+// Estatisticas impressas quando a fila esvazia
+static unsigned long g_UploadFrame = 0;
+static unsigned long g_UploadFirstFrame = 0;
+static unsigned long g_UploadWaitFrames = 0;    // Quadros sem envio por causa de uma fence
+static size_t        g_UploadTotalBytes = 0;
+
+bool TextureUpload_HasGLExtension(const char* name)
+{
+    GLint num_extensions = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &num_extensions);
+    for (GLint i = 0; i < num_extensions; ++i)
+    {
+        const char* extension = (const char*)glGetStringi(GL_EXTENSIONS, i);
+        if (extension != NULL && strcmp(extension, name) == 0)
+            return true;
+    }
+    return false;
+}
+
+void TextureUpload_Init(size_t budget_bytes)
+{
+    // O minimo comporta uma linha RGBA8 de 16384 texels, de forma que toda
+    // faixa cabe em um segmento
+    g_UploadBudget = std::max(budget_bytes, (size_t)TEXTURE_UPLOAD_MIN_BUDGET) & ~(size_t)(TEXTURE_UPLOAD_ALIGNMENT - 1);
+    size_t ring_size = g_UploadBudget * TEXTURE_UPLOAD_RING_FRAMES;
+
+    GLint major = 0, minor = 0;
+    glGetIntegerv(GL_MAJOR_VERSION, &major);
+    glGetIntegerv(GL_MINOR_VERSION, &minor);
+    BufferStorageProc buffer_storage = NULL;
+    if (major > 4 || (major == 4 && minor >= 4) || TextureUpload_HasGLExtension("GL_ARB_buffer_storage"))
+        buffer_storage = (BufferStorageProc)glfwGetProcAddress("glBufferStorage");
+
+    glGenBuffers(1, &g_UploadBuffer);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, g_UploadBuffer);
+    if (buffer_storage != NULL)
+    {
+        GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        buffer_storage(GL_PIXEL_UNPACK_BUFFER, (GLsizeiptr)ring_size, NULL, flags);
+        g_UploadMapped = (unsigned char*)glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, (GLsizeiptr)ring_size, flags);
+        if (g_UploadMapped == NULL)
+        {
+            // O armazenamento de glBufferStorage() e imutavel: criamos
+            // outro buffer para o caminho sem mapeamento persistente
+            glDeleteBuffers(1, &g_UploadBuffer);
+            glGenBuffers(1, &g_UploadBuffer);
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, g_UploadBuffer);
+        }
+    }
+    if (g_UploadMapped == NULL)
+        glBufferData(GL_PIXEL_UNPACK_BUFFER, (GLsizeiptr)ring_size, NULL, GL_STREAM_DRAW);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    for (int i = 0; i < TEXTURE_UPLOAD_RING_FRAMES; ++i)
+        g_UploadFences[i] = 0;
+
+    // As faixas sao linhas inteiras, contiguas na memoria
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
+    glPixelStorei(GL_UNPACK_SKIP_ROWS, 0);
+}
+
+static int FindArray(GLuint texture)
+{
+    for (size_t i = 0; i < g_UploadArrays.size(); ++i)
+        if (g_UploadArrays[i].texture == texture)
+            return (int)i;
+    return -1;
+}
+
+// Ajusta o GL_TEXTURE_BASE_LEVEL do array ligado em GL_TEXTURE_2D_ARRAY
+// para o nivel mais fino presente em todas as camadas
+static void UpdateBaseLevel(UploadArray& array)
+{
+    int base_level = *std::max_element(array.finest_level.begin(), array.finest_level.end());
+    base_level = std::min(base_level, array.num_levels - 1);
+    if (base_level != array.base_level)
+    {
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_BASE_LEVEL, base_level);
+        array.base_level = base_level;
+    }
+}
+
+void TextureUpload_RegisterArray(GLuint texture, GLenum internal_format, int num_layers, int num_levels)
+{
+    int index = FindArray(texture);
+    if (index < 0)
+    {
+        index = (int)g_UploadArrays.size();
+        g_UploadArrays.push_back(UploadArray());
+    }
+    UploadArray& array = g_UploadArrays[index];
+    array.texture = texture;
+    array.internal_format = internal_format;
+    array.num_levels = num_levels;
+    array.base_level = -1;
+    array.finest_level.assign(num_layers, num_levels);
+
+    glActiveTexture(GL_TEXTURE0 + TEXTURE_UPLOAD_TEXTURE_UNIT);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, texture);
+    UpdateBaseLevel(array);
+}
+
+void TextureUpload_Add(GLuint texture, int layer, CookedTexture* image, int first_level, const char* name)
+{
+    int array = FindArray(texture);
+    if (array < 0 || first_level >= image->num_levels)
+    {
+        TextureCache_Release(image);
+        return;
+    }
+
+    if (g_UploadLevels.empty())
+    {
+        g_UploadFirstFrame = g_UploadFrame;
+        g_UploadWaitFrames = 0;
+        g_UploadTotalBytes = 0;
+    }
+
+    UploadImage upload;
+    upload.name = name;
+    upload.texture = *image;
+    upload.array = array;
+    upload.layer = layer;
+    upload.first_level = first_level;
+    upload.remaining_levels = image->num_levels - first_level;
+    upload.first_frame = g_UploadFrame;
+    g_UploadImages.push_back(upload);
+    *image = CookedTexture();
+
+    const CookedTexture& cooked = g_UploadImages.back().texture;
+    bool compressed = cooked.format != TEXTURE_CACHE_RGB8 && cooked.format != TEXTURE_CACHE_RGBA8;
+    for (int level = first_level; level < cooked.num_levels; ++level)
+    {
+        const TextureCacheLevel& l = cooked.levels[level];
+        UploadLevel upload_level;
+        upload_level.image = (int)g_UploadImages.size() - 1;
+        upload_level.level = level;
+        upload_level.rows_per_unit = compressed ? 4 : 1;
+        upload_level.num_rows = (l.height + upload_level.rows_per_unit - 1) / upload_level.rows_per_unit;
+        upload_level.row_bytes = l.size / upload_level.num_rows;
+        upload_level.next_row = 0;
+        g_UploadLevels.push_back(upload_level);
+        g_UploadTotalBytes += l.size;
+    }
+
+    // Os niveis menores, de qualquer imagem, sao enviados primeiro
+    std::stable_sort(g_UploadLevels.begin(), g_UploadLevels.end(), [](const UploadLevel& a, const UploadLevel& b) {
+        return a.row_bytes * a.num_rows < b.row_bytes * b.num_rows;
+    });
+}
+
+void TextureUpload_SkipLayer(GLuint texture, int layer)
+{
+    int index = FindArray(texture);
+    if (index < 0)
+        return;
+    UploadArray& array = g_UploadArrays[index];
+    array.finest_level[layer] = 0;
+
+    glActiveTexture(GL_TEXTURE0 + TEXTURE_UPLOAD_TEXTURE_UNIT);
+    glBindTexture(GL_TEXTURE_2D_ARRAY, array.texture);
+    UpdateBaseLevel(array);
+}
+
+// Copia para o segmento "segment" do anel as faixas da frente da fila que
+// couberem no orcamento, preenchendo g_UploadCopies
+static void CopyToSegment(unsigned char* segment, size_t segment_offset)
+{
+    g_UploadCopies.clear();
+    size_t used = 0;
+    for (size_t i = 0; i < g_UploadLevels.size(); ++i)
+    {
+        UploadLevel& l = g_UploadLevels[i];
+        size_t offset = (used + TEXTURE_UPLOAD_ALIGNMENT - 1) & ~(size_t)(TEXTURE_UPLOAD_ALIGNMENT - 1);
+        if (offset >= g_UploadBudget)
+            break;
+        int rows = (int)std::min((size_t)(l.num_rows - l.next_row), (g_UploadBudget - offset) / l.row_bytes);
+        if (rows == 0)
+            break;
+
+        const TextureCacheLevel& source = g_UploadImages[l.image].texture.levels[l.level];
+        size_t size = rows * l.row_bytes;
+        memcpy(segment + offset, source.data + l.next_row * l.row_bytes, size);
+
+        UploadCopy copy;
+        copy.image = l.image;
+        copy.level = l.level;
+        copy.y = l.next_row * l.rows_per_unit;
+        copy.height = std::min(rows * l.rows_per_unit, source.height - copy.y);
+        copy.offset = segment_offset + offset;
+        copy.size = size;
+        copy.last = l.next_row + rows == l.num_rows;
+        g_UploadCopies.push_back(copy);
+
+        used = offset + size;
+        l.next_row += rows;
+        if (!copy.last)
+            break;
+    }
+}
+
+// Emite os envios das faixas copiadas, a partir do PBO ligado em
+// GL_PIXEL_UNPACK_BUFFER, e libera as imagens que terminaram
+static void IssueCopies()
+{
+    glActiveTexture(GL_TEXTURE0 + TEXTURE_UPLOAD_TEXTURE_UNIT);
+    GLuint bound = 0;
+    for (size_t i = 0; i < g_UploadCopies.size(); ++i)
+    {
+        const UploadCopy& copy = g_UploadCopies[i];
+        UploadImage& image = g_UploadImages[copy.image];
+        UploadArray& array = g_UploadArrays[image.array];
+        const TextureCacheLevel& level = image.texture.levels[copy.level];
+        if (bound != array.texture)
+        {
+            glBindTexture(GL_TEXTURE_2D_ARRAY, array.texture);
+            bound = array.texture;
+        }
+
+        // Linhas RGB8 nao sao alinhadas a 4 bytes
+        const void* pixels = (const void*)copy.offset;
+        int array_level = copy.level - image.first_level;
+        if (image.texture.format == TEXTURE_CACHE_RGB8 || image.texture.format == TEXTURE_CACHE_RGBA8)
+        {
+            glPixelStorei(GL_UNPACK_ALIGNMENT, image.texture.format == TEXTURE_CACHE_RGB8 ? 1 : 4);
+            glTexSubImage3D(GL_TEXTURE_2D_ARRAY, array_level, 0, copy.y, image.layer, level.width, copy.height, 1,
+                            image.texture.format == TEXTURE_CACHE_RGB8 ? GL_RGB : GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+        }
+        else
+            glCompressedTexSubImage3D(GL_TEXTURE_2D_ARRAY, array_level, 0, copy.y, image.layer, level.width,
+                                      copy.height, 1, array.internal_format, (GLsizei)copy.size, pixels);
+        if (!copy.last)
+            continue;
+
+        // Nivel completo: a camada pode ficar mais nitida
+        array.finest_level[image.layer] = std::min(array.finest_level[image.layer], array_level);
+        UpdateBaseLevel(array);
+
+        image.remaining_levels -= 1;
+        if (image.remaining_levels == 0)
+        {
+            printf("Imagem \"%s\": camada %d enviada em %lu quadros.\n", image.name.c_str(), image.layer,
+                   g_UploadFrame - image.first_frame);
+            TextureCache_Release(&image.texture);
+        }
+    }
+}
+
+void TextureUpload_Update()
+{
+    g_UploadFrame += 1;
+    if (g_UploadLevels.empty() || g_UploadBuffer == 0)
+        return;
+
+    TRACE_ZONE("TextureUpload_Update");
+
+    // O segmento so e reescrito depois que a GPU terminou de ler dele; se
+    // ela ainda nao terminou, tentamos de novo no proximo quadro
+    GLsync& fence = g_UploadFences[g_UploadSegment];
+    if (fence != 0)
+    {
+        if (glClientWaitSync(fence, 0, 0) == GL_TIMEOUT_EXPIRED)
+        {
+            g_UploadWaitFrames += 1;
+            return;
+        }
+        glDeleteSync(fence);
+        fence = 0;
+    }
+
+    size_t segment_offset = g_UploadSegment * g_UploadBudget;
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, g_UploadBuffer);
+    if (g_UploadMapped != NULL)
+        CopyToSegment(g_UploadMapped + segment_offset, segment_offset);
+    else
+    {
+        // A fence ja garante que a GPU nao le mais este segmento
+        unsigned char* segment = (unsigned char*)glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, (GLintptr)segment_offset,
+            (GLsizeiptr)g_UploadBudget, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+        if (segment == NULL)
+        {
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            return;
+        }
+        CopyToSegment(segment, segment_offset);
+        glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+    }
+
+    IssueCopies();
+    fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    g_UploadSegment = (g_UploadSegment + 1) % TEXTURE_UPLOAD_RING_FRAMES;
+
+    // O PBO nao pode ficar ligado: os outros envios usam ponteiros da CPU
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    // Retiramos da fila os niveis completos
+    size_t done = 0;
+    while (done < g_UploadLevels.size() && g_UploadLevels[done].next_row == g_UploadLevels[done].num_rows)
+        done += 1;
+    g_UploadLevels.erase(g_UploadLevels.begin(), g_UploadLevels.begin() + done);
+
+    if (g_UploadLevels.empty())
+    {
+        printf("Texturas: %.1f MB enviados em %lu quadros (ate %lu KB por quadro, %s); %lu quadros esperaram a GPU.\n",
+               g_UploadTotalBytes / (1024.0 * 1024.0), g_UploadFrame - g_UploadFirstFrame,
+               (unsigned long)(g_UploadBudget / 1024), g_UploadMapped != NULL ? "mapeamento persistente" : "glMapBufferRange",
+               g_UploadWaitFrames);
+        g_UploadImages.clear();
+    }
+}
+
+size_t TextureUpload_PendingBytes()
+{
+    size_t pending = 0;
+    for (size_t i = 0; i < g_UploadLevels.size(); ++i)
+        pending += (g_UploadLevels[i].num_rows - g_UploadLevels[i].next_row) * g_UploadLevels[i].row_bytes;
+    return pending;
+}
@@ -0,0 +1,234 @@
+// Rastreamento de zonas exportado como JSON do Chrome/Perfetto. Veja "trace.h".
+//
+// Cada thread possui uma lista encadeada de blocos de tamanho fixo. Somente a
+// propria thread escreve nos blocos; o numero de eventos validos de cada
+// bloco e publicado com um store "release", de forma que
+// Trace_WriteJson() possa ler os eventos de outras threads (com "acquire")
+// sem travas e sem que os blocos jamais sejam realocados.
+#include <cstdio>
+#include <cstring>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "trace.h"
+
+#define TRACE_BLOCK_EVENTS 4096 // Eventos por bloco
+#define TRACE_MAX_DEPTH    64   // Profundidade maxima de zonas aninhadas
+#define TRACE_DETAIL_SIZE  48   // Tamanho maximo do texto de detalhe
+
+std::atomic<bool> g_TraceEnabled(false);
+
+struct TraceEvent
+{
+    const char* name;
+    char        detail[TRACE_DETAIL_SIZE];
+    double      begin_us;
+    double      end_us;
+};
+
+struct TraceBlock
+{
+    TraceEvent               events[TRACE_BLOCK_EVENTS];
+    std::atomic<int>         count;
+    std::atomic<TraceBlock*> next;
+    TraceBlock() : count(0), next(NULL) {}
+};
+
+struct TraceThreadBuffer
+{
+    int         tid;
+    std::string name;
+    TraceBlock* first;
+    TraceBlock* last;
+
+    // Pilha de zonas abertas (acessada somente pela propria thread). Zonas
+    // abertas alem de TRACE_MAX_DEPTH nao sao gravadas, mas sao contadas em
+    // "overflow_depth" para que os Trace_End() correspondentes nao fechem
+    // as zonas de fora.
+    int         depth;
+    int         overflow_depth;
+    const char* open_name[TRACE_MAX_DEPTH];
+    char        open_detail[TRACE_MAX_DEPTH][TRACE_DETAIL_SIZE];
+    double      open_begin[TRACE_MAX_DEPTH];
+};
+
+// Lista de buffers de todas as threads. O mutex protege somente o registro
+// de novas threads e a leitura desta lista.
+static std::mutex                       g_TraceRegistryMutex;
+static std::vector<TraceThreadBuffer*>  g_TraceRegistry;
+static thread_local TraceThreadBuffer*  t_TraceBuffer = NULL;
+
+static const std::chrono::steady_clock::time_point g_TraceEpoch = std::chrono::steady_clock::now();
+
+static double NowMicroseconds()
+{
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - g_TraceEpoch).count();
+}
+
+static TraceThreadBuffer* ThreadBuffer()
+{
+    if (t_TraceBuffer == NULL)
+    {
+        TraceThreadBuffer* buffer = new TraceThreadBuffer();
+        buffer->first = buffer->last = new TraceBlock();
+        buffer->depth = 0;
+        buffer->overflow_depth = 0;
+
+        std::lock_guard<std::mutex> lock(g_TraceRegistryMutex);
+        buffer->tid = (int)g_TraceRegistry.size() + 1;
+        g_TraceRegistry.push_back(buffer);
+        t_TraceBuffer = buffer;
+    }
+    return t_TraceBuffer;
+}
+
+void Trace_SetEnabled(bool enabled)
+{
+    g_TraceEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+void Trace_SetThreadName(const char* name)
+{
+    TraceThreadBuffer* buffer = ThreadBuffer();
+    std::lock_guard<std::mutex> lock(g_TraceRegistryMutex);
+    buffer->name = name;
+}
+
+void Trace_Begin(const char* name, const char* detail)
+{
+    if (!g_TraceEnabled.load(std::memory_order_relaxed))
+        return;
+
+    TraceThreadBuffer* buffer = ThreadBuffer();
+    if (buffer->depth >= TRACE_MAX_DEPTH)
+    {
+        ++buffer->overflow_depth;
+        return;
+    }
+
+    int d = buffer->depth++;
+    buffer->open_name[d] = name;
+    buffer->open_detail[d][0] = '\0';
+    if (detail != NULL)
+    {
+        strncpy(buffer->open_detail[d], detail, TRACE_DETAIL_SIZE - 1);
+        buffer->open_detail[d][TRACE_DETAIL_SIZE - 1] = '\0';
+    }
+    buffer->open_begin[d] = NowMicroseconds();
+}
+
+void Trace_End()
+{
+    TraceThreadBuffer* buffer = t_TraceBuffer;
+    if (buffer == NULL || buffer->depth == 0)
+        return;
+    if (buffer->overflow_depth > 0)
+    {
+        --buffer->overflow_depth;
+        return;
+    }
+
+    int d = --buffer->depth;
+
+    TraceBlock* block = buffer->last;
+    int index = block->count.load(std::memory_order_relaxed);
+    if (index == TRACE_BLOCK_EVENTS)
+    {
+        TraceBlock* next = new TraceBlock();
+        block->next.store(next, std::memory_order_release);
+        buffer->last = block = next;
+        index = 0;
+    }
+
+    TraceEvent& e = block->events[index];
+    e.name = buffer->open_name[d];
+    memcpy(e.detail, buffer->open_detail[d], TRACE_DETAIL_SIZE);
+    e.begin_us = buffer->open_begin[d];
+    e.end_us = NowMicroseconds();
+
+    // Publica o evento para leitores em outras threads
+    block->count.store(index + 1, std::memory_order_release);
+}
+
+// Escreve uma string JSON, escapando aspas, barras e caracteres de controle
+static void WriteJsonString(FILE* file, const char* str)
+{
+    fputc('"', file);
+    for (const char* c = str; *c != '\0'; ++c)
+    {
+        if (*c == '"' || *c == '\\')
+            fprintf(file, "\\%c", *c);
+        else if ((unsigned char)*c < 0x20)
+            fprintf(file, "\\u%04x", (unsigned char)*c);
+        else
+            fputc(*c, file);
+    }
+    fputc('"', file);
+}
+
+bool Trace_WriteJson(const char* filename)
+{
+    FILE* file = fopen(filename, "w");
+    if (file == NULL)
+    {
+        fprintf(stderr, "ERROR: Cannot open file \"%s\".\n", filename);
+        return false;
+    }
+
+    std::vector<TraceThreadBuffer*> buffers;
+    {
+        std::lock_guard<std::mutex> lock(g_TraceRegistryMutex);
+        buffers = g_TraceRegistry;
+    }
+
+    size_t num_events = 0;
+    bool first = true;
+    fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+
+    for (size_t i = 0; i < buffers.size(); ++i)
+    {
+        TraceThreadBuffer* buffer = buffers[i];
+
+        std::string name;
+        {
+            std::lock_guard<std::mutex> lock(g_TraceRegistryMutex);
+            name = buffer->name;
+        }
+        if (!name.empty())
+        {
+            fprintf(file, "%s{\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"name\":\"thread_name\",\"args\":{\"name\":", first ? "" : ",\n", buffer->tid);
+            WriteJsonString(file, name.c_str());
+            fprintf(file, "}}");
+            first = false;
+        }
+
+        for (TraceBlock* block = buffer->first; block != NULL; block = block->next.load(std::memory_order_acquire))
+        {
+            int count = block->count.load(std::memory_order_acquire);
+            for (int j = 0; j < count; ++j)
+            {
+                const TraceEvent& e = block->events[j];
+                fprintf(file, "%s{\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f,\"name\":",
+                        first ? "" : ",\n", buffer->tid, e.begin_us, e.end_us - e.begin_us);
+                WriteJsonString(file, e.name);
+                if (e.detail[0] != '\0')
+                {
+                    fprintf(file, ",\"args\":{\"detail\":");
+                    WriteJsonString(file, e.detail);
+                    fprintf(file, "}");
+                }
+                fprintf(file, "}");
+                first = false;
+                num_events += 1;
+            }
+        }
+    }
+
+    fprintf(file, "\n]}\n");
+    fclose(file);
+
+    printf("Trace: %lu eventos salvos em \"%s\".\n", (unsigned long)num_events, filename);
+    return true;
+}
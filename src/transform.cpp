@@ -0,0 +1,158 @@
+// Transformacoes compactas (translacao, quaternion e escala). Veja
+// "transform.h".
+#include <cmath>
+
+#include "transform.h"
+
+// Tamanho de uma transformacao: 3 + 4 + 3 floats, contra 16 de uma matriz
+static_assert(sizeof(Transform) == 40, "Transform deve ocupar 40 bytes");
+
+glm::vec4 Quaternion_Identity()
+{
+    return glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+}
+
+glm::vec4 Quaternion_AxisAngle(glm::vec3 axis, float angle)
+{
+    float s = std::sin(angle / 2.0f) / std::sqrt(axis.x*axis.x + axis.y*axis.y + axis.z*axis.z);
+    return glm::vec4(axis.x * s, axis.y * s, axis.z * s, std::cos(angle / 2.0f));
+}
+
+glm::vec4 Quaternion_Euler(float x, float y, float z)
+{
+    glm::vec4 qx = Quaternion_AxisAngle(glm::vec3(1.0f, 0.0f, 0.0f), x);
+    glm::vec4 qy = Quaternion_AxisAngle(glm::vec3(0.0f, 1.0f, 0.0f), y);
+    glm::vec4 qz = Quaternion_AxisAngle(glm::vec3(0.0f, 0.0f, 1.0f), z);
+    return Quaternion_Multiply(Quaternion_Multiply(qz, qy), qx);
+}
+
+glm::vec4 Quaternion_Multiply(const glm::vec4& a, const glm::vec4& b)
+{
+    return glm::vec4(
+        a.w*b.x + a.x*b.w + a.y*b.z - a.z*b.y,
+        a.w*b.y - a.x*b.z + a.y*b.w + a.z*b.x,
+        a.w*b.z + a.x*b.y - a.y*b.x + a.z*b.w,
+        a.w*b.w - a.x*b.x - a.y*b.y - a.z*b.z);
+}
+
+glm::vec3 Quaternion_Rotate(const glm::vec4& q, glm::vec3 v)
+{
+    // v + w*t + u x t, com u = (x, y, z) e t = 2 * (u x v)
+    glm::vec3 u(q.x, q.y, q.z);
+    glm::vec3 t = 2.0f * glm::cross(u, v);
+    return v + q.w * t + glm::cross(u, t);
+}
+
+Transform Transform_Identity()
+{
+    return Transform_Make(glm::vec3(0.0f, 0.0f, 0.0f), Quaternion_Identity(), glm::vec3(1.0f, 1.0f, 1.0f));
+}
+
+Transform Transform_Make(glm::vec3 translation, const glm::vec4& rotation, glm::vec3 scale)
+{
+    Transform t;
+    t.translation = translation;
+    t.rotation = rotation;
+    t.scale = scale;
+    return t;
+}
+
+Transform Transform_Compose(const Transform& parent, const Transform& child)
+{
+    // Tp*Rp*Sp * Tc*Rc*Sc = T(tp + Rp*Sp*tc) * Rp*Rc * Sp*Sc, se Sp comuta
+    // com Rc (escala uniforme)
+    Transform t;
+    t.translation = parent.translation + Quaternion_Rotate(parent.rotation, parent.scale * child.translation);
+    t.rotation = Quaternion_Multiply(parent.rotation, child.rotation);
+    t.scale = parent.scale * child.scale;
+    return t;
+}
+
+glm::vec3 Transform_Point(const Transform& t, glm::vec3 p)
+{
+    return t.translation + Quaternion_Rotate(t.rotation, t.scale * p);
+}
+
+// Colunas da matriz de rotacao do quaternion q
+static void RotationColumns(const glm::vec4& q, glm::vec3* c0, glm::vec3* c1, glm::vec3* c2)
+{
+    float xx = q.x*q.x, yy = q.y*q.y, zz = q.z*q.z;
+    float xy = q.x*q.y, xz = q.x*q.z, yz = q.y*q.z;
+    float wx = q.w*q.x, wy = q.w*q.y, wz = q.w*q.z;
+    *c0 = glm::vec3(1.0f - 2.0f*(yy + zz), 2.0f*(xy + wz),        2.0f*(xz - wy));
+    *c1 = glm::vec3(2.0f*(xy - wz),        1.0f - 2.0f*(xx + zz), 2.0f*(yz + wx));
+    *c2 = glm::vec3(2.0f*(xz + wy),        2.0f*(yz - wx),        1.0f - 2.0f*(xx + yy));
+}
+
+glm::mat4 Transform_ToMatrix(const Transform& t)
+{
+    glm::vec3 c0, c1, c2;
+    RotationColumns(t.rotation, &c0, &c1, &c2);
+    return glm::mat4(
+        glm::vec4(c0 * t.scale.x, 0.0f),         // COLUNA 1
+        glm::vec4(c1 * t.scale.y, 0.0f),         // COLUNA 2
+        glm::vec4(c2 * t.scale.z, 0.0f),         // COLUNA 3
+        glm::vec4(t.translation, 1.0f));         // COLUNA 4
+}
+
+glm::mat4 Transform_InverseMatrix(const Transform& t)
+{
+    // As linhas de S^-1 * R^T sao as colunas de R divididas pela escala
+    glm::vec3 c0, c1, c2;
+    RotationColumns(t.rotation, &c0, &c1, &c2);
+    c0 /= t.scale.x;
+    c1 /= t.scale.y;
+    c2 /= t.scale.z;
+    return glm::mat4(
+        glm::vec4(c0.x, c1.x, c2.x, 0.0f),       // COLUNA 1
+        glm::vec4(c0.y, c1.y, c2.y, 0.0f),       // COLUNA 2
+        glm::vec4(c0.z, c1.z, c2.z, 0.0f),       // COLUNA 3
+        glm::vec4(-glm::dot(c0, t.translation), -glm::dot(c1, t.translation), -glm::dot(c2, t.translation), 1.0f));
+}
+
+glm::mat4 Transform_NormalMatrix(const Transform& t)
+{
+    glm::vec3 c0, c1, c2;
+    RotationColumns(t.rotation, &c0, &c1, &c2);
+    return glm::mat4(
+        glm::vec4(c0 / t.scale.x, 0.0f),
+        glm::vec4(c1 / t.scale.y, 0.0f),
+        glm::vec4(c2 / t.scale.z, 0.0f),
+        glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
+}
+
+// Linhas da inversa da parte linear de m, cujas colunas sao a, b e c:
+// (b x c, c x a, a x b) / det
+static void InverseRows(const glm::mat4& m, glm::vec3* r0, glm::vec3* r1, glm::vec3* r2)
+{
+    glm::vec3 a(m[0]), b(m[1]), c(m[2]);
+    glm::vec3 bc = glm::cross(b, c);
+    float inv_det = 1.0f / glm::dot(a, bc);
+    *r0 = bc * inv_det;
+    *r1 = glm::cross(c, a) * inv_det;
+    *r2 = glm::cross(a, b) * inv_det;
+}
+
+glm::mat4 Matrix_AffineInverse(const glm::mat4& m)
+{
+    glm::vec3 r0, r1, r2;
+    InverseRows(m, &r0, &r1, &r2);
+    glm::vec3 t(m[3]);
+    return glm::mat4(
+        glm::vec4(r0.x, r1.x, r2.x, 0.0f),
+        glm::vec4(r0.y, r1.y, r2.y, 0.0f),
+        glm::vec4(r0.z, r1.z, r2.z, 0.0f),
+        glm::vec4(-glm::dot(r0, t), -glm::dot(r1, t), -glm::dot(r2, t), 1.0f));
+}
+
+glm::mat4 Matrix_Normal(const glm::mat4& m)
+{
+    // A transposta da inversa tem as linhas da inversa como colunas
+    glm::vec3 r0, r1, r2;
+    InverseRows(m, &r0, &r1, &r2);
+    return glm::mat4(
+        glm::vec4(r0, 0.0f),
+        glm::vec4(r1, 0.0f),
+        glm::vec4(r2, 0.0f),
+        glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
+}